@@ -1,6 +1,6 @@
 #include <stdio.h>
 #include <string.h>
-#include "..\SDL\include\SDL.h"
+#include "../SDL/include/SDL.h"
 
 #define BE_ST_MAXJOYSTICKS 8
 #define BE_ST_EMU_JOYSTICK_RANGEMAX 5000 // id_in.c MaxJoyValue
@@ -18,7 +18,7 @@
  */
 #include <string.h>
 #include <stdlib.h>
-#include "..\SDL\include\SDL.h"
+#include "../SDL/include/SDL.h"
 #include "be_st.h"
 #include "../opl/dbopl.h"
 
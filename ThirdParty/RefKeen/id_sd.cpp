@@ -109,7 +109,7 @@ SDL_SetIntsPerSec(uint16_t ints)
 #ifdef	_MUSE_
 void
 #else
-static void
+void
 #endif
 SDL_PCPlaySound(PCSound *sound)
 {
@@ -130,7 +130,7 @@ SDL_PCPlaySound(PCSound *sound)
 //
 ///////////////////////////////////////////////////////////////////////////
 
-static void
+void
 SDL_PCStopSound(void)
 {
 	BE_ST_LockAudioRecursively();
@@ -219,7 +219,7 @@ alOut(uint8_t n,uint8_t b)
 //
 ///////////////////////////////////////////////////////////////////////////
 
-static void
+void
 SDL_ALStopSound(void)
 {
 	BE_ST_LockAudioRecursively();
@@ -0,0 +1,2951 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+#include "DecorateAll.h"
+
+//
+// PLAYER SHOT
+//
+
+constexpr DecorateAnimationFrame playerShotFlyAnimation[] =
+{
+    { PSHOT1PIC , 8, ActionPlayerProjectile },
+    { PSHOT2PIC , 8, ActionPlayerProjectile }
+};
+
+constexpr DecorateState playerShotStateFly = 
+{
+    playerShotFlyAnimation,
+    StateIdProjectileFly   // Loop
+};
+
+constexpr DecorateAnimationFrame playerShotDyingAnimation[] =
+{
+    { PSHOT_EXP1PIC , 7, ActionNone },
+    { PSHOT_EXP2PIC , 7, ActionNone },
+    { PSHOT_EXP3PIC , 7, ActionNone },
+    { 0 , 7, ActionRemove },
+};
+
+constexpr DecorateState playerShotStateDying = 
+{
+    playerShotDyingAnimation,
+    StateIdDying   // Loop
+};
+
+constexpr DecorateStatePair playerShotStates[] =
+{
+    std::make_pair(StateIdProjectileFly, playerShotStateFly),
+    std::make_pair(StateIdDying, playerShotStateDying)
+};
+
+constexpr DecorateActor decoratePlayerShot =
+{
+    actorIdProjectilePlayerShot,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard;
+    1,  // initialHealth;
+    7 * pixelRadius,    // size;
+    Flickering,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    playerShotStates,
+    StateIdProjectileFly,   // initialState;
+    1,  // damage;
+    0, // hitSound;
+    10000,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// PLAYER BIG SHOT
+// Fired by the nuke / X-terminator
+//
+
+constexpr DecorateActor decoratePlayerBigShot =
+{
+    actorIdProjectilePlayerBigShot,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard;
+    1,  // initialHealth;
+    24 * pixelRadius,    // size;
+    Flickering,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    playerShotStates,
+    StateIdProjectileFly,   // initialState;
+    3,  // damage;
+    0, // hitSound;
+    10000,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// MAGE SHOT
+//
+
+constexpr DecorateAnimationFrame mageShotFlyAnimation[] =
+{
+    { PSHOT1PIC , 8, ActionMonsterProjectile },
+    { PSHOT2PIC , 8, ActionMonsterProjectile }
+};
+
+constexpr DecorateState mageShotStateFly = 
+{
+    mageShotFlyAnimation,
+    StateIdProjectileFly   // Loop
+};
+
+constexpr DecorateStatePair mageShotStates[] =
+{
+    std::make_pair(StateIdProjectileFly, mageShotStateFly),
+    std::make_pair(StateIdDying, playerShotStateDying)
+};
+
+constexpr DecorateActor decorateMageShot =
+{
+    actorIdProjectileMageShot,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard;
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    mageShotStates,
+    StateIdProjectileFly,   // initialState;
+    2,  // damage;
+    0, // hitSound;
+    10000,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// EYE SHOT
+//
+
+constexpr DecorateAnimationFrame eyeShotFlyAnimation[] =
+{
+    { EYE_SHOT1PIC , 8, ActionMonsterProjectile },
+    { EYE_SHOT2PIC , 8, ActionMonsterProjectile }
+};
+
+constexpr DecorateState eyeShotStateFly = 
+{
+    eyeShotFlyAnimation,
+    StateIdProjectileFly   // Loop
+};
+
+constexpr DecorateStatePair eyeShotStates[] =
+{
+    std::make_pair(StateIdProjectileFly, eyeShotStateFly),
+    std::make_pair(StateIdDying, playerShotStateDying)
+};
+
+constexpr DecorateActor decorateEyeShot =
+{
+    actorIdProjectileEyeShot,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard;
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    eyeShotStates,
+    StateIdProjectileFly,   // initialState;
+    1,  // damage;
+    0, // hitSound;
+    5000,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// NEMESIS SHOT (FLAMING SKULL)
+//
+
+constexpr DecorateAnimationFrame nemesisShotFlyAnimation[] =
+{
+    { SKULL_SHOTPIC , 8, ActionMonsterProjectile }
+};
+
+constexpr DecorateState nemesisShotStateFly = 
+{
+    nemesisShotFlyAnimation,
+    StateIdProjectileFly   // Loop
+};
+
+constexpr DecorateStatePair nemesisShotStates[] =
+{
+    std::make_pair(StateIdProjectileFly, nemesisShotStateFly),
+    std::make_pair(StateIdDying, playerShotStateDying)
+};
+
+constexpr DecorateActor decorateNemesisShot =
+{
+    actorIdProjectileNemesisShot,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard;
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    nemesisShotStates,
+    StateIdProjectileFly,   // initialState;
+    25,  // damage;
+    0, // hitSound;
+    10000,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// TOMBSTONE 1
+//
+
+constexpr DecorateAnimationFrame tomb1DecorationAnimation[] =
+{
+    { TOMB1PIC, 8, ActionNone }
+};
+
+constexpr DecorateState tomb1StateDecoration =
+{
+    tomb1DecorationAnimation,
+    StateIdDecoration // Loop
+};
+
+constexpr DecorateStatePair tomb1States[] =
+{
+    std::make_pair(StateIdDecoration, tomb1StateDecoration)
+};
+
+constexpr DecorateActor decorateTomb1 =
+{
+    actorIdTomb1,   // Id
+    46, // spawnOnAllDifficulties;
+    46, // spawnOnNormalAndHard;
+    46,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    tomb1States,
+    StateIdDecoration,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter,
+    0 // ProjectileId
+};
+
+//
+// TOMBSTONE 2
+//
+
+constexpr DecorateAnimationFrame tomb2DecorationAnimation[] =
+{
+    { TOMB2PIC, 8, ActionNone }
+};
+
+constexpr DecorateState tomb2StateDecoration =
+{
+    tomb2DecorationAnimation,
+    StateIdDecoration // Loop
+};
+
+constexpr DecorateStatePair tomb2States[] =
+{
+    std::make_pair(StateIdDecoration, tomb2StateDecoration)
+};
+
+constexpr DecorateActor decorateTomb2 =
+{
+    actorIdTomb2,   // Id
+    47, // spawnOnAllDifficulties;
+    47, // spawnOnNormalAndHard;
+    47,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    tomb2States,
+    StateIdDecoration,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// TOMBSTONE 3
+//
+
+constexpr DecorateAnimationFrame tomb3DecorationAnimation[] =
+{
+    { TOMB3PIC, 8, ActionNone }
+};
+
+constexpr DecorateState tomb3StateDecoration =
+{
+    tomb3DecorationAnimation,
+    StateIdDecoration // Loop
+};
+
+constexpr DecorateStatePair tomb3States[] =
+{
+    std::make_pair(StateIdDecoration, tomb3StateDecoration)
+};
+
+constexpr DecorateActor decorateTomb3 =
+{
+    actorIdTomb3,   // Id
+    48, // spawnOnAllDifficulties;
+    48, // spawnOnNormalAndHard;
+    48,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    tomb3States,
+    StateIdDecoration,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// EXPLODING WALL
+//
+
+constexpr DecorateAnimationFrame explodingWallDeadAnimation[] =
+{
+    { 0, 20, ActionExplodeWall1 },
+    { 0, 20, ActionExplodeWall2 },
+    { 0, 20, ActionExplodeWall3 },
+    { 0, 8, ActionExplodeWall4 },
+    { 0, 8, ActionRemove }
+};
+
+constexpr DecorateState explodingWallStateDead =
+{
+    explodingWallDeadAnimation,
+    StateIdDead // Loop
+};
+
+constexpr DecorateStatePair explodingWallStates[] =
+{
+    std::make_pair(StateIdDead, explodingWallStateDead)
+};
+
+constexpr DecorateActor decorateExplodingWall =
+{
+    actorIdExplodingWall,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard
+    1,  // initialHealth;
+    5 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    explodingWallStates,
+    StateIdDead,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// WARP PIT
+//
+
+constexpr DecorateAnimationFrame warpPitWaitForPickupAnimation[] =
+{
+    { PITOBJPIC, 8, ActionWaitForPickup }
+};
+
+constexpr DecorateState warpPitStateWaitForPickup =
+{
+    warpPitWaitForPickupAnimation,
+    StateIdWaitForPickup // Loop
+};
+
+constexpr DecorateAnimationFrame warpPitPickupAnimation[] =
+{
+    { PITOBJPIC, 8, ActionWarpToOtherLevel }
+};
+
+constexpr DecorateState warpPitStatePickup =
+{
+    warpPitPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair warpPitStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, warpPitStateWaitForPickup),
+    std::make_pair(StateIdPickup, warpPitStatePickup)
+};
+
+constexpr DecorateActor decorateWarpPit =
+{
+    actorIdWarpPit,   // Id
+    54, // spawnOnAllDifficulties;
+    54, // spawnOnNormalAndHard;
+    54,  // spawnOnHard
+    1,  // initialHealth;
+    0.333f,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    warpPitStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// WARP PORTAL
+//
+
+constexpr DecorateAnimationFrame warpPortalWaitForPickupAnimation[] =
+{
+    { OBJ_WARP1PIC, 10, ActionWaitForPickup },
+    { OBJ_WARP2PIC, 10, ActionWaitForPickup },
+    { OBJ_WARP3PIC, 10, ActionWaitForPickup },
+    { OBJ_WARP4PIC, 10, ActionWaitForPickup }
+};
+
+constexpr DecorateState warpPortalStateWaitForPickup =
+{
+    warpPortalWaitForPickupAnimation,
+    StateIdWaitForPickup // Loop
+};
+
+constexpr DecorateAnimationFrame warpPortalPickupAnimation[] =
+{
+    { OBJ_WARP1PIC, 8, ActionWarpInsideLevel }
+};
+
+constexpr DecorateState warpPortalStatePickup =
+{
+    warpPortalPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair warpPortalStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, warpPortalStateWaitForPickup),
+    std::make_pair(StateIdPickup, warpPortalStatePickup)
+};
+
+constexpr DecorateActor decorateWarpPortal1 =
+{
+    actorIdWarpPortal1,   // Id
+    31, // spawnOnAllDifficulties;
+    31, // spawnOnNormalAndHard;
+    31,  // spawnOnHard
+    1,  // initialHealth;
+    0.333f,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    warpPortalStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    1, // actionParameter
+    0 // ProjectileId
+};
+
+constexpr DecorateActor decorateWarpPortal2 =
+{
+    actorIdWarpPortal2,   // Id
+    32, // spawnOnAllDifficulties;
+    32, // spawnOnNormalAndHard;
+    32,  // spawnOnHard
+    1,  // initialHealth;
+    0.333f,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    warpPortalStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    2, // actionParameter
+    0 // ProjectileId
+};
+
+constexpr DecorateActor decorateWarpPortal3 =
+{
+    actorIdWarpPortal3,   // Id
+    33, // spawnOnAllDifficulties;
+    33, // spawnOnNormalAndHard;
+    33,  // spawnOnHard
+    1,  // initialHealth;
+    0.333f,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    warpPortalStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    3, // actionParameter
+    0 // ProjectileId
+};
+
+constexpr DecorateActor decorateWarpPortal4 =
+{
+    actorIdWarpPortal4,   // Id
+    34, // spawnOnAllDifficulties;
+    34, // spawnOnNormalAndHard;
+    34,  // spawnOnHard
+    1,  // initialHealth;
+    0.333f,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    warpPortalStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    4, // actionParameter
+    0 // ProjectileId
+};
+
+constexpr DecorateActor decorateWarpPortal5 =
+{
+    actorIdWarpPortal5,   // Id
+    35, // spawnOnAllDifficulties;
+    35, // spawnOnNormalAndHard;
+    35,  // spawnOnHard
+    1,  // initialHealth;
+    0.333f,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    warpPortalStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    5, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// PLAYER
+//
+
+constexpr DecorateAnimationFrame playerWalkAnimation[] =
+{
+    { 0, 8, ActionNone }
+};
+
+constexpr DecorateState playerStateWalk =
+{
+    playerWalkAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame playerDyingAnimation[] =
+{
+    { 0, 8, ActionNone }
+};
+
+constexpr DecorateState playerStateDying =
+{
+    playerDyingAnimation,
+    StateIdDying
+};
+
+constexpr DecorateStatePair playerStates[] =
+{
+    std::make_pair(StateIdWalk, playerStateWalk),
+    std::make_pair(StateIdDying, playerStateDying)
+};
+
+constexpr DecorateActor decoratePlayer =
+{
+    actorIdPlayer,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard
+    100,  // initialHealth;
+    0.4f,    // size;
+    Always,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    playerStates,
+    StateIdWalk,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    actorIdProjectilePlayerShot // ProjectileId
+};
+
+//
+// BONUS ITEM DESTROYED
+//
+
+constexpr DecorateAnimationFrame bonusDyingAnimation[] =
+{
+    { PSHOT_EXP1PIC, 7, ActionItemDestroyed },
+    { PSHOT_EXP2PIC , 7, ActionNone },
+    { PSHOT_EXP3PIC , 7, ActionNone },
+    { 0 , 7, ActionRemove },
+};
+constexpr DecorateState bonusStateDying = 
+{
+    bonusDyingAnimation,
+    StateIdDying   // Loop
+};
+
+//
+// EXPLOSION
+//
+
+constexpr DecorateAnimationFrame explosionHiddenAnimation[] =
+{
+    { 0 , 2, ActionExplosionDelay }
+}; 
+
+constexpr DecorateState explosionStateHidden = 
+{
+    explosionHiddenAnimation,
+    StateIdHidden   // Loop
+};
+
+constexpr DecorateAnimationFrame explosionDyingAnimation[] =
+{
+    { PSHOT_EXP1PIC , 7, ActionNone },
+    { PSHOT_EXP2PIC , 7, ActionNone },
+    { PSHOT_EXP3PIC , 7, ActionNone },
+    { 0 , 7, ActionRemove },
+};
+
+constexpr DecorateState explosionStateDying = 
+{
+    explosionDyingAnimation,
+    StateIdDying   // Loop
+};
+
+constexpr DecorateStatePair explosionStates[] =
+{
+    std::make_pair(StateIdHidden, explosionStateHidden),
+    std::make_pair(StateIdDying, explosionStateDying)
+};
+
+constexpr DecorateActor decorateExplosion =
+{
+    actorIdBonusExplosion,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    explosionStates,
+    StateIdHidden,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// BOLT
+//
+
+constexpr DecorateAnimationFrame boltWaitForPickupAnimation[] =
+{
+    { BOLTOBJPIC, 8, ActionWaitForPickup },
+    { BOLT2OBJPIC, 8, ActionWaitForPickup },
+    { BOLT3OBJPIC, 8, ActionWaitForPickup },
+};
+
+constexpr DecorateState boltWaitForPickup =
+{
+    boltWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame boltPickupAnimation[] =
+{
+    { 0, 6, ActionGiveBolt },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState boltPickup =
+{
+    boltPickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair boltStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, boltWaitForPickup),
+    std::make_pair(StateIdPickup, boltPickup),
+    std::make_pair(StateIdDying, bonusStateDying)
+};
+
+constexpr DecorateActor decorateBolt =
+{
+    actorIdBonusBolt,   // Id
+    5, // spawnOnAllDifficulties;
+    5, // spawnOnNormalAndHard;
+    5,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    boltStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// NUKE
+//
+
+constexpr DecorateAnimationFrame nukeWaitForPickupAnimation[] =
+{
+    { NUKEOBJPIC, 8, ActionWaitForPickup },
+    { NUKE2OBJPIC, 8, ActionWaitForPickup },
+    { NUKE3OBJPIC, 8, ActionWaitForPickup },
+};
+
+constexpr DecorateState nukeWaitForPickup =
+{
+    nukeWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame nukePickupAnimation[] =
+{
+    { 0, 6, ActionGiveNuke },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState nukePickup =
+{
+    nukePickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair nukeStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, nukeWaitForPickup),
+    std::make_pair(StateIdPickup, nukePickup),
+    std::make_pair(StateIdDying, bonusStateDying)
+};
+
+constexpr DecorateActor decorateNuke =
+{
+    actorIdBonusNuke,   // Id
+    6, // spawnOnAllDifficulties;
+    6, // spawnOnNormalAndHard;
+    6,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    nukeStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// POTION
+//
+
+constexpr DecorateAnimationFrame potionWaitForPickupAnimation[] =
+{
+    { POTIONOBJPIC, 8, ActionWaitForPickup }
+};
+
+constexpr DecorateState potionWaitForPickup =
+{
+    potionWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame potionPickupAnimation[] =
+{
+    { 0, 6, ActionGivePotion },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState potionPickup =
+{
+    potionPickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair potionStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, potionWaitForPickup),
+    std::make_pair(StateIdPickup, potionPickup),
+    std::make_pair(StateIdDying, bonusStateDying)
+};
+
+constexpr DecorateActor decoratePotion =
+{
+    actorIdBonusPotion,   // Id
+    7, // spawnOnAllDifficulties;
+    7, // spawnOnNormalAndHard;
+    7,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    potionStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// CHEST
+//
+
+constexpr DecorateAnimationFrame chestWaitForPickupAnimation[]
+{
+    { CHESTOBJPIC, 8, ActionWaitForPickup }
+};
+
+constexpr DecorateState chestWaitForPickup =
+{
+    chestWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame chestPickupAnimation[] =
+{
+    { 0, 6, ActionGiveChest },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState chestPickup =
+{
+    chestPickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair chestStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, chestWaitForPickup),
+    std::make_pair(StateIdPickup, chestPickup),
+    std::make_pair(StateIdDying, bonusStateDying)
+};
+
+constexpr DecorateActor decorateChest =
+{
+    actorIdBonusChest,   // Id
+    21, // spawnOnAllDifficulties;
+    21, // spawnOnNormalAndHard;
+    21,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    chestStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// WATER CHEST
+//
+
+constexpr DecorateAnimationFrame waterChestWaitForPickupAnimation[] =
+{
+    { O_WATER_CHEST1PIC, 8, ActionWaitForPickup },
+    { O_WATER_CHEST2PIC, 8, ActionWaitForPickup }
+};
+
+constexpr DecorateState waterChestWaitForPickup =
+{
+    waterChestWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair waterChestStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, waterChestWaitForPickup),
+    std::make_pair(StateIdPickup, chestPickup),
+    std::make_pair(StateIdDying, bonusStateDying)
+};
+
+constexpr DecorateActor decorateWaterChest =
+{
+    actorIdBonusWaterChest,   // Id
+    21, // spawnOnAllDifficulties;
+    21, // spawnOnNormalAndHard;
+    21,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    waterChestStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// FREEZE TIME
+//
+
+constexpr DecorateAnimationFrame freezeTimeWaitForPickupAnimation[] =
+{
+    { TIMEOBJ1PIC, 6, ActionWaitForPickup },
+    { TIMEOBJ2PIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState freezeTimeWaitForPickup =
+{
+    freezeTimeWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame freezeTimePickupAnimation[] =
+{
+    { 0, 6, ActionFreezeTime },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState freezeTimePickup =
+{
+    freezeTimePickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair freezeTimeStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, freezeTimeWaitForPickup),
+    std::make_pair(StateIdPickup, freezeTimePickup),
+};
+
+constexpr DecorateActor decorateFreezeTime =
+{
+    actorIdBonusFreezeTime,   // Id
+    57, // spawnOnAllDifficulties;
+    57, // spawnOnNormalAndHard;
+    57,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    freezeTimeStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// SCROLLS
+//
+
+constexpr DecorateAnimationFrame scrollWaitForPickupAnimation[] =
+{
+    { SCROLLOBJPIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState scrollWaitForPickup =
+{
+    scrollWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame scrollPickupAnimation[] =
+{
+    { 0, 6, ActionGiveScroll },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState scrollPickup =
+{
+    scrollPickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair scrollStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, scrollWaitForPickup),
+    std::make_pair(StateIdPickup, scrollPickup),
+};
+
+constexpr DecorateActor decorateScroll1 =
+{
+    actorIdBonusScroll1,   // Id
+    12, // spawnOnAllDifficulties;
+    12, // spawnOnNormalAndHard;
+    12,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    scrollStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+constexpr DecorateActor decorateScroll2 =
+{
+    actorIdBonusScroll2,   // Id
+    13, // spawnOnAllDifficulties;
+    13, // spawnOnNormalAndHard;
+    13,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    scrollStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    1, // actionParameter
+    0 // ProjectileId
+};
+
+constexpr DecorateActor decorateScroll3 =
+{
+    actorIdBonusScroll3,   // Id
+    14, // spawnOnAllDifficulties;
+    14, // spawnOnNormalAndHard;
+    14,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    scrollStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    2, // actionParameter
+    0 // ProjectileId
+};
+
+constexpr DecorateActor decorateScroll4 =
+{
+    actorIdBonusScroll4,   // Id
+    15, // spawnOnAllDifficulties;
+    15, // spawnOnNormalAndHard;
+    15,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    scrollStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    3, // actionParameter
+    0 // ProjectileId
+};
+
+constexpr DecorateActor decorateScroll5 =
+{
+    actorIdBonusScroll5,   // Id
+    16, // spawnOnAllDifficulties;
+    16, // spawnOnNormalAndHard;
+    16,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    scrollStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    4, // actionParameter
+    0 // ProjectileId
+};
+
+constexpr DecorateActor decorateScroll6 =
+{
+    actorIdBonusScroll6,   // Id
+    17, // spawnOnAllDifficulties;
+    17, // spawnOnNormalAndHard;
+    17,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    scrollStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    5, // actionParameter
+    0 // ProjectileId
+};
+
+constexpr DecorateActor decorateScroll7 =
+{
+    actorIdBonusScroll7,   // Id
+    18, // spawnOnAllDifficulties;
+    18, // spawnOnNormalAndHard;
+    18,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    scrollStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    6, // actionParameter
+    0 // ProjectileId
+};
+
+constexpr DecorateActor decorateScroll8 =
+{
+    actorIdBonusScroll8,   // Id
+    19, // spawnOnAllDifficulties;
+    19, // spawnOnNormalAndHard;
+    19,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    scrollStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    7, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// KEY RED
+//
+
+constexpr DecorateAnimationFrame keyRedWaitForPickupAnimation[] =
+{
+    { RKEYOBJPIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState keyRedWaitForPickup =
+{
+    keyRedWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame keyPickupAnimation[] =
+{
+    { 0, 6, ActionGiveKey },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState keyPickup =
+{
+    keyPickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair keyRedStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, keyRedWaitForPickup),
+    std::make_pair(StateIdPickup, keyPickup),
+};
+
+constexpr DecorateActor decorateKeyRed =
+{
+    actorIdBonusKeyRed,   // Id
+    8, // spawnOnAllDifficulties;
+    8, // spawnOnNormalAndHard;
+    8,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    keyRedStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// KEY YELLOW
+//
+
+constexpr DecorateAnimationFrame keyYellowWaitForPickupAnimation[] =
+{
+    { YKEYOBJPIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState keyYellowWaitForPickup =
+{
+    keyYellowWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair keyYellowStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, keyYellowWaitForPickup),
+    std::make_pair(StateIdPickup, keyPickup),
+};
+
+constexpr DecorateActor decorateKeyYellow =
+{
+    actorIdBonusKeyYellow,   // Id
+    9, // spawnOnAllDifficulties;
+    9, // spawnOnNormalAndHard;
+    9,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    keyYellowStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    1, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// KEY GREEN
+//
+
+constexpr DecorateAnimationFrame keyGreenWaitForPickupAnimation[] =
+{
+    { GKEYOBJPIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState keyGreenWaitForPickup =
+{
+    keyGreenWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair keyGreenStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, keyGreenWaitForPickup),
+    std::make_pair(StateIdPickup, keyPickup),
+};
+
+constexpr DecorateActor decorateKeyGreen =
+{
+    actorIdBonusKeyGreen,   // Id
+    10, // spawnOnAllDifficulties;
+    10, // spawnOnNormalAndHard;
+    10,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    keyGreenStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    2, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// KEY BLUE
+//
+
+constexpr DecorateAnimationFrame keyBlueWaitForPickupAnimation[] =
+{
+    { BKEYOBJPIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState keyBlueWaitForPickup =
+{
+    keyBlueWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair keyBlueStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, keyBlueWaitForPickup),
+    std::make_pair(StateIdPickup, keyPickup),
+};
+
+constexpr DecorateActor decorateKeyBlue =
+{
+    actorIdBonusKeyBlue,   // Id
+    11, // spawnOnAllDifficulties;
+    11, // spawnOnNormalAndHard;
+    11,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    keyBlueStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    3, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// KEY RED 2
+//
+
+constexpr DecorateAnimationFrame keyRed2WaitForPickupAnimation[] =
+{
+    { RKEY2PIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState keyRed2WaitForPickup =
+{
+    keyRed2WaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair keyRed2States[] =
+{
+    std::make_pair(StateIdWaitForPickup, keyRed2WaitForPickup),
+    std::make_pair(StateIdPickup, keyPickup),
+};
+
+constexpr DecorateActor decorateKeyRed2 =
+{
+    actorIdBonusKeyRed2,   // Id
+    29, // spawnOnAllDifficulties;
+    29, // spawnOnNormalAndHard;
+    29,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    keyRed2States,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    4, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// GEM RED
+//
+
+constexpr DecorateAnimationFrame gemRedWaitForPickupAnimation[] =
+{
+    { RGEM1PIC, 30, ActionWaitForPickup },
+    { RGEM2PIC, 30, ActionWaitForPickup }
+};
+
+constexpr DecorateState gemRedWaitForPickup =
+{
+    gemRedWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame gemPickupAnimation[] =
+{
+    { 0, 6, ActionGiveGem },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState gemPickup =
+{
+    gemPickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair gemRedStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, gemRedWaitForPickup),
+    std::make_pair(StateIdPickup, gemPickup),
+};
+
+constexpr DecorateActor decorateGemRed =
+{
+    actorIdBonusGemRed,   // Id
+    58, // spawnOnAllDifficulties;
+    58, // spawnOnNormalAndHard;
+    58,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    gemRedStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// GEM YELLOW
+//
+
+constexpr DecorateAnimationFrame gemYellowWaitForPickupAnimation[] =
+{
+    { YGEM1PIC, 30, ActionWaitForPickup },
+    { YGEM2PIC, 30, ActionWaitForPickup }
+};
+
+constexpr DecorateState gemYellowWaitForPickup =
+{
+    gemYellowWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair gemYellowStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, gemYellowWaitForPickup),
+    std::make_pair(StateIdPickup, gemPickup),
+};
+
+constexpr DecorateActor decorateGemYellow =
+{
+    actorIdBonusGemYellow,   // Id
+    59, // spawnOnAllDifficulties;
+    59, // spawnOnNormalAndHard;
+    59,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    gemYellowStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    3, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// GEM GREEN
+//
+
+constexpr DecorateAnimationFrame gemGreenWaitForPickupAnimation[] =
+{
+    { GGEM1PIC, 30, ActionWaitForPickup },
+    { GGEM2PIC, 30, ActionWaitForPickup }
+};
+
+constexpr DecorateState gemGreenWaitForPickup =
+{
+    gemGreenWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair gemGreenStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, gemGreenWaitForPickup),
+    std::make_pair(StateIdPickup, gemPickup),
+};
+
+constexpr DecorateActor decorateGemGreen =
+{
+    actorIdBonusGemGreen,   // Id
+    60, // spawnOnAllDifficulties;
+    60, // spawnOnNormalAndHard;
+    60,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    gemGreenStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    1, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// GEM BLUE
+//
+
+constexpr DecorateAnimationFrame gemBlueWaitForPickupAnimation[] =
+{
+    { BGEM1PIC, 30, ActionWaitForPickup },
+    { BGEM2PIC, 30, ActionWaitForPickup }
+};
+
+constexpr DecorateState gemBlueWaitForPickup =
+{
+    gemBlueWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair gemBlueStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, gemBlueWaitForPickup),
+    std::make_pair(StateIdPickup, gemPickup),
+};
+
+constexpr DecorateActor decorateGemBlue =
+{
+    actorIdBonusGemBlue,   // Id
+    61, // spawnOnAllDifficulties;
+    61, // spawnOnNormalAndHard;
+    61,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    gemBlueStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    2, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// GEM PURPLE
+//
+
+constexpr DecorateAnimationFrame gemPurpleWaitForPickupAnimation[] =
+{
+    { PGEM1PIC, 30, ActionWaitForPickup },
+    { PGEM2PIC, 30, ActionWaitForPickup }
+};
+
+constexpr DecorateState gemPurpleWaitForPickup =
+{
+    gemPurpleWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair gemPurpleStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, gemPurpleWaitForPickup),
+    std::make_pair(StateIdPickup, gemPickup),
+};
+
+constexpr DecorateActor decorateGemPurple =
+{
+    actorIdBonusGemPurple,   // Id
+    62, // spawnOnAllDifficulties;
+    62, // spawnOnNormalAndHard;
+    62,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    gemPurpleStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    4, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// ZOMBIE
+//
+
+constexpr DecorateAnimationFrame zombieHiddenAnimation[] =
+{
+    { 0 , 13, ActionHide }
+};
+
+constexpr DecorateState zombieStateHidden = 
+{
+    zombieHiddenAnimation,
+    StateIdHidden   // Loop
+};
+
+constexpr DecorateAnimationFrame zombieRiseAnimation[] =
+{
+    { ZOMB_APPEAR1PIC, 24, ActionNone },
+    { ZOMB_APPEAR2PIC, 24, ActionNone },
+    { ZOMB_APPEAR3PIC, 24, ActionNone },
+    { ZOMB_APPEAR4PIC, 24, ActionNone },
+    { ZOMB_WALK3PIC, 1, ActionNone }
+};
+
+constexpr DecorateState zombieStateRise =
+{
+    zombieRiseAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame zombieWalkAnimation[] =
+{
+    { ZOMB_WALK1PIC, 13, ActionChase },
+    { ZOMB_WALK2PIC, 13, ActionChase },
+    { ZOMB_WALK3PIC, 13, ActionChase }
+};
+
+constexpr DecorateState zombieStateWalk =
+{
+    zombieWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame zombieAttackAnimation[] =
+{
+    { ZOMB_ATTACKPIC, 15, ActionAttack },
+    { ZOMB_WALK1PIC, 20, ActionNone }
+};
+
+constexpr DecorateState zombieStateAttack =
+{
+    zombieAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame zombiePainAnimation[] =
+{
+    { ZOMB_OUCHPIC, 15, ActionNone }
+};
+
+constexpr DecorateState zombieStatePain =
+{
+    zombiePainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame zombieDyingAnimation[] =
+{
+    { ZOMB_DIE1PIC, 16, ActionNone },
+    { ZOMB_DIE2PIC, 16, ActionNone },
+    { ZOMB_DIE3PIC, 16, ActionNone }
+};
+
+constexpr DecorateState zombieStateDying =
+{
+    zombieDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateAnimationFrame zombieDeadAnimation[] =
+{
+    { ZOMB_DIE3PIC, 16, ActionNone }
+};
+
+constexpr DecorateState zombieStateDead =
+{
+    zombieDeadAnimation,
+    StateIdDead //  Loop
+};
+
+constexpr DecorateStatePair zombieStates[] =
+{
+    std::make_pair(StateIdHidden, zombieStateHidden),
+    std::make_pair(StateIdRise, zombieStateRise),
+    std::make_pair(StateIdWalk, zombieStateWalk),
+    std::make_pair(StateIdAttack, zombieStateAttack),
+    std::make_pair(StateIdPain, zombieStatePain),
+    std::make_pair(StateIdDying, zombieStateDying),
+    std::make_pair(StateIdDead, zombieStateDead)
+};
+
+constexpr DecorateActor decorateZombie =
+{
+    actorIdMonsterZombie,   // Id
+    53, // spawnOnAllDifficulties;
+    52, // spawnOnNormalAndHard;
+    0,  // spawnOnHard;
+    5,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithPurpleGem,  // radarVisibility;
+    EgaBrightMagenta,   // radarColor;
+    zombieStates,
+    StateIdHidden,   // initialState;
+    8,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    2500,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// SKELETON
+//
+
+constexpr DecorateAnimationFrame skeletonWalkAnimation[] =
+{
+    { SKELETON_1PIC, 10, ActionChase },
+    { SKELETON_2PIC, 10, ActionChase },
+    { SKELETON_3PIC, 10, ActionChase },
+    { SKELETON_4PIC, 10, ActionChase }
+};
+
+constexpr DecorateState skeletonStateWalk =
+{
+    skeletonWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame skeletonAttackAnimation[] =
+{
+    { SKELETON_ATTACK_1PIC, 12, ActionNone },
+    { SKELETON_ATTACK_2PIC, 12, ActionNone },
+    { SKELETON_ATTACK_3PIC, 12, ActionAttack },
+    { SKELETON_1PIC, 40, ActionNone }
+};
+
+constexpr DecorateState skeletonStateAttack =
+{
+    skeletonAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame skeletonPainAnimation[] =
+{
+    { SKELETON_OUCHPIC, 18, ActionNone }
+};
+
+constexpr DecorateState skeletonStatePain =
+{
+    skeletonPainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame skeletonDyingAnimation[] =
+{
+    { SKELETON_OUCHPIC, 18, ActionNone },
+    { SKELETON_DEATH_1PIC, 18, ActionNone },
+    { SKELETON_DEATH_2PIC, 18, ActionNone }
+};
+
+constexpr DecorateState skeletonStateDying =
+{
+    skeletonDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateAnimationFrame skeletonDeadAnimation[] =
+{
+    { SKELETON_DEATH_2PIC, 16, ActionNone }
+};
+
+constexpr DecorateState skeletonStateDead =
+{
+    skeletonDeadAnimation,
+    StateIdDead //  Loop
+};
+
+constexpr DecorateStatePair skeletonStates[] =
+{
+    std::make_pair(StateIdWalk, skeletonStateWalk),
+    std::make_pair(StateIdAttack, skeletonStateAttack),
+    std::make_pair(StateIdPain, skeletonStatePain),
+    std::make_pair(StateIdDying, skeletonStateDying),
+    std::make_pair(StateIdDead, skeletonStateDead)
+};
+
+constexpr DecorateActor decorateSkeleton =
+{
+    actorIdMonsterSkeleton,   // Id
+    55, // spawnOnAllDifficulties;
+    56, // spawnOnNormalAndHard;
+    0,  // spawnOnHard;
+    12,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithYellowGem,  // radarVisibility;
+    EgaBrightYellow,   // radarColor;
+    skeletonStates,
+    StateIdWalk,   // initialState;
+    6,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    2036,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// WALL SKELETON
+//
+
+constexpr DecorateAnimationFrame wallSkeletonHiddenAnimation[] =
+{
+    { 0 , 13, ActionHide }
+};
+
+constexpr DecorateState wallSkeletonStateHidden = 
+{
+    wallSkeletonHiddenAnimation,
+    StateIdHidden   // Loop
+};
+
+constexpr DecorateAnimationFrame wallSkeletonRiseAnimation[] =
+{
+    { 0, 2400, ActionSpawnSkeleton },
+    { 0, 12, ActionRemove }
+};
+
+constexpr DecorateState wallSkeletonStateRise =
+{
+    wallSkeletonRiseAnimation,
+    StateIdRise
+};
+
+constexpr DecorateStatePair wallSkeletonStates[] =
+{
+    std::make_pair(StateIdHidden, wallSkeletonStateHidden),
+    std::make_pair(StateIdRise, wallSkeletonStateRise),
+};
+
+constexpr DecorateActor decorateWallSkeleton =
+{
+    actorIdMonsterWallSkeleton,   // Id
+    69, // spawnOnAllDifficulties;
+    70, // spawnOnNormalAndHard;
+    71,  // spawnOnHard;
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightYellow,   // radarColor;
+    wallSkeletonStates,
+    StateIdHidden,   // initialState;
+    6,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// ORC
+//
+
+constexpr DecorateAnimationFrame orcWalkAnimation[] =
+{
+    { ORC1PIC, 20, ActionChase },
+    { ORC2PIC, 20, ActionChase },
+    { ORC3PIC, 20, ActionChase },
+    { ORC4PIC, 20, ActionChase }
+};
+
+constexpr DecorateState orcStateWalk =
+{
+   orcWalkAnimation,
+   StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame orcAttackAnimation[] =
+{
+    { ORCATTACK1PIC, 20, ActionNone },
+    { ORCATTACK2PIC, 20, ActionNone },
+    { ORCATTACK2PIC, 30, ActionAttack },
+    { ORC1PIC, 40, ActionNone }
+};
+
+constexpr DecorateState orcStateAttack =
+{
+    orcAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame orcPainAnimation[] =
+{
+    { ORCOUCHPIC, 15, ActionNone }
+};
+
+constexpr DecorateState orcStatePain =
+{
+    orcPainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame orcDyingAnimation[] =
+{
+    { ORCDIE1PIC, 18, ActionNone },
+    { ORCDIE1PIC, 18, ActionNone },
+    { ORCDIE3PIC, 18, ActionNone }
+};
+
+constexpr DecorateState orcStateDying =
+{
+    orcDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateAnimationFrame orcDeadAnimation[] =
+{
+    { ORCDIE3PIC, 16, ActionNone }
+};
+
+constexpr DecorateState orcStateDead =
+{
+    orcDeadAnimation,
+    StateIdDead //  Loop
+};
+
+constexpr DecorateStatePair orcStates[] =
+{
+    std::make_pair(StateIdWalk, orcStateWalk),
+    std::make_pair(StateIdAttack, orcStateAttack),
+    std::make_pair(StateIdPain, orcStatePain),
+    std::make_pair(StateIdDying, orcStateDying),
+    std::make_pair(StateIdDead, orcStateDead)
+};
+
+constexpr DecorateActor decorateOrc =
+{
+    actorIdMonsterOrc,   // Id
+    23, // spawnOnAllDifficulties;
+    37, // spawnOnNormalAndHard;
+    42,  // spawnOnHard;
+    6,  // initialHealth;
+    32 * pixelRadius,    // size;
+    WithGreenGem,  // radarVisibility;
+    EgaGreen,   // radarColor;
+    orcStates,
+    StateIdWalk,   // initialState;
+    4,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    1536,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// TROLL
+//
+
+constexpr DecorateAnimationFrame trollWalkAnimation[] =
+{
+    { TROLL1PIC, 13, ActionChase },
+    { TROLL2PIC, 13, ActionChase },
+    { TROLL3PIC, 13, ActionChase },
+    { TROLL4PIC, 13, ActionChase }
+};
+
+constexpr DecorateState trollStateWalk =
+{
+   trollWalkAnimation,
+   StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame trollAttackAnimation[] =
+{
+    { TROLLATTACK1PIC, 15, ActionNone },
+    { TROLLATTACK2PIC, 15, ActionNone },
+    { TROLLATTACK3PIC, 30, ActionAttack },
+    { TROLL1PIC, 40, ActionNone }
+};
+
+constexpr DecorateState trollStateAttack =
+{
+    trollAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame trollPainAnimation[] =
+{
+    { TROLLOUCHPIC, 14, ActionChase }
+};
+
+constexpr DecorateState trollStatePain =
+{
+    trollPainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame trollDyingAnimation[] =
+{
+    { TROLLDIE1PIC, 18, ActionNone },
+    { TROLLDIE2PIC, 18, ActionNone },
+    { TROLLDIE3PIC, 18, ActionNone }
+};
+
+constexpr DecorateState trollStateDying =
+{
+    trollDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateAnimationFrame trollDeadAnimation[] =
+{
+    { TROLLDIE3PIC, 16, ActionNone }
+};
+
+constexpr DecorateState trollStateDead =
+{
+    trollDeadAnimation,
+    StateIdDead //  Loop
+};
+
+constexpr DecorateStatePair trollStates[] =
+{
+    std::make_pair(StateIdWalk, trollStateWalk),
+    std::make_pair(StateIdAttack, trollStateAttack),
+    std::make_pair(StateIdPain, trollStatePain),
+    std::make_pair(StateIdDying, trollStateDying),
+    std::make_pair(StateIdDead, trollStateDead)
+};
+
+constexpr DecorateActor decorateTroll =
+{
+    actorIdMonsterTroll,   // Id
+    22, // spawnOnAllDifficulties;
+    36, // spawnOnNormalAndHard;
+    41,  // spawnOnHard;
+    14,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithGreenGem,  // radarVisibility;
+    EgaBrightGreen,   // radarColor;
+    trollStates,
+    StateIdWalk,   // initialState;
+    8,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    2500,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// DEMON
+//
+
+constexpr DecorateAnimationFrame demonWalkAnimation[] =
+{
+    { DEMON1PIC, 20, ActionChase },
+    { DEMON2PIC, 20, ActionChase },
+    { DEMON3PIC, 20, ActionChase },
+    { DEMON4PIC, 20, ActionChase }
+};
+
+constexpr DecorateState demonStateWalk =
+{
+    demonWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame demonAttackAnimation[] =
+{
+    { DEMONATTACK1PIC, 20, ActionNone },
+    { DEMONATTACK2PIC, 20, ActionNone },
+    { DEMONATTACK3PIC, 30, ActionAttack },
+    { DEMON1PIC, 40, ActionNone }
+};
+
+constexpr DecorateState demonStateAttack =
+{
+    demonAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame demonPainAnimation[] =
+{
+    { DEMONOUCHPIC, 14, ActionChase }
+};
+
+constexpr DecorateState demonStatePain =
+{
+    demonPainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame demonDyingAnimation[] =
+{
+    { DEMONDIE1PIC, 40, ActionNone },
+    { DEMONDIE2PIC, 30, ActionNone },
+    { DEMONDIE3PIC, 30, ActionNone }
+};
+
+constexpr DecorateState demonStateDying =
+{
+    demonDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateAnimationFrame demonDeadAnimation[] =
+{
+    { DEMONDIE3PIC, 16, ActionNone }
+};
+
+constexpr DecorateState demonStateDead =
+{
+    demonDeadAnimation,
+    StateIdDead //  Loop
+};
+
+constexpr DecorateStatePair demonStates[] =
+{
+    std::make_pair(StateIdWalk, demonStateWalk),
+    std::make_pair(StateIdAttack, demonStateAttack),
+    std::make_pair(StateIdPain, demonStatePain),
+    std::make_pair(StateIdDying, demonStateDying),
+    std::make_pair(StateIdDead, demonStateDead)
+};
+
+constexpr DecorateActor decorateDemon =
+{
+    actorIdMonsterDemon,   // Id
+    26, // spawnOnAllDifficulties;
+    39, // spawnOnNormalAndHard;
+    44,  // spawnOnHard;
+    50,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithBlueGem,  // radarVisibility;
+    EgaBlue,   // radarColor;
+    demonStates,
+    StateIdWalk,   // initialState;
+    15,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    2048,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// RED DEMON
+//
+
+constexpr DecorateAnimationFrame redDemonWalkAnimation[] =
+{
+    { RED_DEMON1PIC, 20, ActionChase },
+    { RED_DEMON2PIC, 20, ActionChase },
+    { RED_DEMON3PIC, 20, ActionChase },
+    { RED_DEMON4PIC, 20, ActionChase }
+};
+
+constexpr DecorateState redDemonStateWalk =
+{
+    redDemonWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame redDemonAttackAnimation[] =
+{
+    { RED_DEMONATTACK1PIC, 20, ActionNone },
+    { RED_DEMONATTACK2PIC, 20, ActionNone },
+    { RED_DEMONATTACK3PIC, 30, ActionAttack },
+    { RED_DEMON1PIC, 40, ActionNone }
+};
+
+constexpr DecorateState redDemonStateAttack =
+{
+    redDemonAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame redDemonPainAnimation[] =
+{
+    { RED_DEMONOUCHPIC, 15, ActionChase }
+};
+
+constexpr DecorateState redDemonStatePain =
+{
+    redDemonPainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame redDemonDyingAnimation[] =
+{
+    { RED_DEMONDIE1PIC, 40, ActionNone },
+    { RED_DEMONDIE2PIC, 30, ActionNone },
+    { RED_DEMONDIE3PIC, 30, ActionNone }
+};
+
+constexpr DecorateState redDemonStateDying =
+{
+    redDemonDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateAnimationFrame redDemonDeadAnimation[] =
+{
+    { RED_DEMONDIE3PIC, 16, ActionNone }
+};
+
+constexpr DecorateState redDemonStateDead =
+{
+    redDemonDeadAnimation,
+    StateIdDead //  Loop
+};
+
+constexpr DecorateStatePair redDemonStates[] =
+{
+    std::make_pair(StateIdWalk, redDemonStateWalk),
+    std::make_pair(StateIdAttack, redDemonStateAttack),
+    std::make_pair(StateIdPain, redDemonStatePain),
+    std::make_pair(StateIdDying, redDemonStateDying),
+    std::make_pair(StateIdDead, redDemonStateDead)
+};
+
+constexpr DecorateActor decorateRedDemon =
+{
+    actorIdMonsterRedDemon,   // Id
+    20, // spawnOnAllDifficulties;
+    24, // spawnOnNormalAndHard;
+    30,  // spawnOnHard; Actually, should include 20 and 24 as well.
+    50,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithRedGem,  // radarVisibility;
+    EgaRed,   // radarColor;
+    redDemonStates,
+    StateIdWalk,   // initialState;
+    15,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    2048,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// SPOOK
+//
+
+constexpr DecorateAnimationFrame spookHiddenAnimation[] =
+{
+    { 0 , 13, ActionHide }
+};
+
+constexpr DecorateState spookStateHidden = 
+{
+    spookHiddenAnimation,
+    StateIdHidden   // Loop
+};
+
+constexpr DecorateAnimationFrame spookRiseAnimation[] =
+{
+    { SPOOK_INOUTPIC, 7, ActionNone },
+    { 0, 7, ActionNone },
+    { SPOOK_INOUTPIC, 7, ActionNone }
+};
+
+constexpr DecorateState spookStateRise =
+{
+    spookRiseAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame spookWalkAnimation[] =
+{
+    { SPOOK1PIC, 10, ActionNone },
+    { SPOOK2PIC, 10, ActionChase },
+    { SPOOK3PIC, 10, ActionChase },
+    { SPOOK4PIC, 10, ActionChase },
+    { SPOOK3PIC, 10, ActionChase },
+    { SPOOK2PIC, 10, ActionChase }
+};
+
+constexpr DecorateState spookStateWalk =
+{
+    spookWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame spookAttackAnimation[] =
+{
+    { SPOOK_ATTACKPIC, 35, ActionNone },
+    { SPOOK3PIC, 20, ActionAttack }
+};
+
+constexpr DecorateState spookStateAttack =
+{
+    spookAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame spookPainAnimation[] =
+{
+    { SPOOKHITPIC, 5, ActionNone }
+};
+
+constexpr DecorateState spookStatePain =
+{
+    spookPainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame spookDyingAnimation[] =
+{
+    { SPOOK_INOUTPIC, 9, ActionNone },
+    { SPOOK4PIC, 9, ActionNone },
+    { SPOOK_INOUTPIC, 9, ActionNone },
+    { SPOOK4PIC, 9, ActionNone },
+    { SPOOK_INOUTPIC, 9, ActionNone },
+    { 0, 11, ActionRemove },
+};
+
+constexpr DecorateState spookStateDying =
+{
+    spookDyingAnimation,
+    StateIdDying  // Will not loop, due to the ActionRemove.
+};
+
+constexpr DecorateStatePair spookStates[] =
+{
+    std::make_pair(StateIdHidden, spookStateHidden),
+    std::make_pair(StateIdRise, spookStateRise),
+    std::make_pair(StateIdWalk, spookStateWalk),
+    std::make_pair(StateIdAttack, spookStateAttack),
+    std::make_pair(StateIdPain,spookStatePain),
+    std::make_pair(StateIdDying, spookStateDying)
+};
+
+constexpr DecorateActor decorateSpook =
+{
+    actorIdMonsterSpook,   // Id
+    49, // spawnOnAllDifficulties;
+    50, // spawnOnNormalAndHard;
+    51,  // spawnOnHard; Actually, should include 20 and 24 as well.
+    5,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithYellowGem,  // radarVisibility;
+    EgaBrown,   // radarColor;
+    spookStates,
+    StateIdHidden,   // initialState;
+    2,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    1900,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// BAT
+//
+
+constexpr DecorateAnimationFrame batWalkAnimation[] =
+{
+    { BAT1PIC, 6, ActionNone },
+    { BAT2PIC, 6, ActionChase },
+    { BAT3PIC, 6, ActionChase },
+    { BAT4PIC, 6, ActionChase }
+};
+
+constexpr DecorateState batStateWalk =
+{
+    batWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame batAttackAnimation[] =
+{
+    { BAT4PIC, 5, ActionAttack },
+    { BAT4PIC, 75, ActionRunAway }
+};
+
+constexpr DecorateState batStateAttack =
+{
+    batAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame batDyingAnimation[] =
+{
+    { BATDIE1PIC, 18, ActionNone },
+    { BATDIE2PIC, 18, ActionNone },
+    { NULL, 18, ActionRemove }
+};
+
+constexpr DecorateState batStateDying =
+{
+    batDyingAnimation,
+    StateIdDying  // Will not loop, due to the ActionRemove.
+};
+
+constexpr DecorateStatePair batStates[] =
+{
+    std::make_pair(StateIdWalk, batStateWalk),
+    std::make_pair(StateIdAttack, batStateAttack),
+    std::make_pair(StateIdDying, batStateDying)
+};
+
+constexpr DecorateActor decorateBat =
+{
+    actorIdMonsterBat,   // Id
+    25, // spawnOnAllDifficulties;
+    38, // spawnOnNormalAndHard;
+    43,  // spawnOnHard; Actually, should include 20 and 24 as well.
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Always,  // radarVisibility;
+    EgaDarkGray,   // radarColor;
+    batStates,
+    StateIdWalk,   // initialState;
+    4,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    2000,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// MAGE
+//
+
+constexpr DecorateAnimationFrame mageWalkAnimation[] =
+{
+    { MAGE1PIC, 20, ActionChaseLikeMage },
+    { MAGE2PIC, 20, ActionChaseLikeMage }
+};
+
+constexpr DecorateState mageStateWalk =
+{
+    mageWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame mageAttackAnimation[] =
+{
+    { MAGEATTACKPIC, 30, ActionAttack },
+    { MAGE1PIC, 10, ActionChase }
+};
+
+constexpr DecorateState mageStateAttack =
+{
+    mageAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame magePainAnimation[] =
+{
+    { MAGEOUCHPIC, 10, ActionNone }
+};
+
+constexpr DecorateState mageStatePain =
+{
+    magePainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame mageDyingAnimation[] =
+{
+    { MAGEDIE1PIC, 20, ActionNone }
+};
+
+constexpr DecorateState mageStateDying =
+{
+    mageDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateAnimationFrame mageDeadAnimation[] =
+{
+    { MAGEDIE2PIC, 20, ActionNone }
+};
+
+constexpr DecorateState mageStateDead =
+{
+    mageDeadAnimation,
+    StateIdDead // Loop
+};
+
+constexpr DecorateStatePair mageStates[] =
+{
+    std::make_pair(StateIdWalk, mageStateWalk),
+    std::make_pair(StateIdAttack, mageStateAttack),
+    std::make_pair(StateIdPain, mageStatePain),
+    std::make_pair(StateIdDying, mageStateDying),
+    std::make_pair(StateIdDead, mageStateDead)
+};
+
+constexpr DecorateActor decorateMage =
+{
+    actorIdMonsterMage,   // Id
+    27, // spawnOnAllDifficulties;
+    40, // spawnOnNormalAndHard;
+    45,  // spawnOnHard
+    5,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithAllGems,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    mageStates,
+    StateIdWalk,   // initialState;
+    0,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    3072,    // speed;
+    0, // actionParameter
+    actorIdProjectileMageShot // ProjectileId
+};
+
+//
+// EYE
+//
+
+constexpr DecorateAnimationFrame eyeWalkAnimation[] =
+{
+    { EYE_WALK1PIC, 20, ActionChaseLikeMage },
+    { EYE_WALK2PIC, 20, ActionChaseLikeMage },
+    { EYE_WALK3PIC, 20, ActionChaseLikeMage },
+    { EYE_WALK2PIC, 20, ActionChaseLikeMage }
+};
+
+constexpr DecorateState eyeStateWalk =
+{
+    eyeWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame eyeAttackAnimation[] =
+{
+    { EYE_WALK1PIC, 40, ActionAttack }
+};
+
+constexpr DecorateState eyeStateAttack =
+{
+    eyeAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame eyePainAnimation[] =
+{
+    { EYE_OUCH1PIC, 8, ActionNone },
+    { EYE_OUCH2PIC, 8, ActionNone }
+};
+
+constexpr DecorateState eyeStatePain =
+{
+    eyePainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame eyeDyingAnimation[] =
+{
+    { EYE_DEATH1PIC, 22, ActionNone },
+    { EYE_DEATH2PIC, 22, ActionNone },
+    { NULL, 22, ActionRemove }
+};
+
+constexpr DecorateState eyeStateDying =
+{
+    eyeDyingAnimation,
+    StateIdDying  // Will not loop, due to the ActionRemove.
+};
+
+constexpr DecorateStatePair eyeStates[] =
+{
+    std::make_pair(StateIdWalk, eyeStateWalk),
+    std::make_pair(StateIdAttack, eyeStateAttack),
+    std::make_pair(StateIdPain,eyeStatePain),
+    std::make_pair(StateIdDying, eyeStateDying)
+};
+
+constexpr DecorateActor decorateEye =
+{
+    actorIdMonsterEye,   // Id
+    66, // spawnOnAllDifficulties;
+    67, // spawnOnNormalAndHard;
+    68,  // spawnOnHard
+    14,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithRedGem,  // radarVisibility;
+    EgaRed,   // radarColor;
+    eyeStates,
+    StateIdWalk,   // initialState;
+    0,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    1200,    // speed;
+    0, // actionParameter
+    actorIdProjectileEyeShot // ProjectileId
+};
+
+//
+// WETMAN
+//
+
+constexpr DecorateAnimationFrame wetManHiddenAnimation[] =
+{
+    { WET_BUBBLE1PIC, 13, ActionHideUnderWater },
+    { WET_BUBBLE2PIC, 15, ActionHideUnderWater },
+    { 0, 18, ActionHideUnderWater }
+};
+
+constexpr DecorateState wetManStateHidden = 
+{
+    wetManHiddenAnimation,
+    StateIdHidden   // Loop
+};
+
+constexpr DecorateAnimationFrame wetManRiseAnimation[] =
+{
+    { WET_BUBBLE2PIC, 15, ActionNone },
+    { WET_EYESPIC, 20, ActionNone },
+    { WET_RISE1PIC, 20, ActionNone },
+    { WET_RISE2PIC, 20, ActionNone }
+};
+
+constexpr DecorateState wetManStateRise =
+{
+    wetManRiseAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame wetManSinkAnimation[] =
+{
+    { WET_RISE2PIC, 20, ActionNone },
+    { WET_RISE1PIC, 20, ActionNone },
+    { WET_EYESPIC, 20, ActionNone }
+};
+
+constexpr DecorateState wetManStateSink =
+{
+    wetManSinkAnimation,
+    StateIdHidden
+};
+
+constexpr DecorateAnimationFrame wetManPeekAnimation[] =
+{
+    { WET_EYESPIC, 45, ActionNone }
+};
+
+constexpr DecorateState wetManStatePeek =
+{
+    wetManPeekAnimation,
+    StateIdHidden
+};
+
+constexpr DecorateAnimationFrame wetManWalkAnimation[] =
+{
+    { WET_WALK1PIC, 12, ActionChaseLikeWetMan },
+    { WET_WALK2PIC, 12, ActionChaseLikeWetMan },
+    { WET_WALK3PIC, 12, ActionChaseLikeWetMan },
+    { WET_WALK4PIC, 12, ActionChaseLikeWetMan }
+};
+
+constexpr DecorateState wetManStateWalk =
+{
+    wetManWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame wetManAttackAnimation[] =
+{
+    { WET_ATTACK1PIC, 10, ActionNone },
+    { WET_ATTACK2PIC, 20, ActionNone },
+    { WET_ATTACK3PIC, 10, ActionAttack }
+};
+
+constexpr DecorateState wetManStateAttack =
+{
+    wetManAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame wetManPainAnimation[] =
+{
+    { WET_OUCHPIC, 10, ActionNone }
+};
+
+constexpr DecorateState wetManStatePain =
+{
+    wetManPainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame wetManDyingAnimation[] =
+{
+    { WET_DIE1PIC, 27, ActionNone },
+    { WET_DIE2PIC, 29, ActionNone },
+    { WET_DIE3PIC, 44, ActionNone },
+    { WET_BUBBLE2PIC, 26, ActionNone },
+    { WET_BUBBLE1PIC, 23, ActionNone },
+    { 0, 22, ActionRemove }
+};
+
+constexpr DecorateState wetManStateDying =
+{
+    wetManDyingAnimation,
+    StateIdDying  // Will not loop, due to the ActionRemove.
+};
+
+constexpr DecorateStatePair wetManStates[] =
+{
+    std::make_pair(StateIdHidden, wetManStateHidden),
+    std::make_pair(StateIdRise, wetManStateRise),
+    std::make_pair(StateIdSink, wetManStateSink),
+    std::make_pair(StateIdPeek, wetManStatePeek),
+    std::make_pair(StateIdWalk, wetManStateWalk),
+    std::make_pair(StateIdAttack, wetManStateAttack),
+    std::make_pair(StateIdPain, wetManStatePain),
+    std::make_pair(StateIdDying, wetManStateDying)
+};
+
+constexpr DecorateActor decorateWetMan =
+{
+    actorIdMonsterWetMan,   // Id
+    63, // spawnOnAllDifficulties;
+    64, // spawnOnNormalAndHard;
+    65,  // spawnOnHard
+    18,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithBlueGem,  // radarVisibility;
+    EgaBrightBlue,   // radarColor;
+    wetManStates,
+    StateIdHidden,   // initialState;
+    7,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    1000,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// NEMESIS
+//
+
+constexpr DecorateAnimationFrame nemesisWalkAnimation[] =
+{
+    { GREL1PIC, 20, ActionChase },
+    { GREL2PIC, 20, ActionChase }
+};
+
+constexpr DecorateState nemesisStateWalk =
+{
+    nemesisWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame nemesisAttackAnimation[] =
+{
+    { GRELATTACKPIC, 30, ActionAttack },
+    { GREL1PIC, 50, ActionNone }
+};
+
+constexpr DecorateState nemesisStateAttack =
+{
+    nemesisAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame nemesisPainAnimation[] =
+{
+    { GRELHITPIC, 6, ActionNone }
+};
+
+constexpr DecorateState nemesisStatePain =
+{
+    nemesisPainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame nemesisDyingAnimation[] =
+{
+    { GRELDIE1PIC, 22, ActionNone },
+    { GRELDIE2PIC, 22, ActionNone },
+    { GRELDIE3PIC, 22, ActionNone },
+    { GRELDIE4PIC, 22, ActionNone },
+    { GRELDIE5PIC, 22, ActionNone },
+    { GRELDIE5PIC, 1, ActionDropRedKey }
+};
+
+constexpr DecorateState nemesisStateDying =
+{
+    nemesisDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateAnimationFrame nemesisDeadAnimation[] =
+{
+    { GRELDIE6PIC, 20, ActionNone }
+};
+
+constexpr DecorateState nemesisStateDead =
+{
+    nemesisDeadAnimation,
+    StateIdDead // Loop
+};
+
+constexpr DecorateStatePair nemesisStates[] =
+{
+    std::make_pair(StateIdWalk, nemesisStateWalk),
+    std::make_pair(StateIdAttack, nemesisStateAttack),
+    std::make_pair(StateIdPain, nemesisStatePain),
+    std::make_pair(StateIdDying, nemesisStateDying),
+    std::make_pair(StateIdDead, nemesisStateDead)
+};
+
+constexpr DecorateActor decorateNemesis =
+{
+    actorIdMonsterNemesis,   // Id
+    28, // spawnOnAllDifficulties;
+    28, // spawnOnNormalAndHard;
+    28,  // spawnOnHard
+    100,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithAllGems,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    nemesisStates,
+    StateIdWalk,   // initialState;
+    0,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    2048,    // speed;
+    0, // actionParameter
+    actorIdProjectileNemesisShot // ProjectileId
+};
+
+// Validate all actor definitions at compile time
+static_assert(DecorateIsValid(decorateTomb1, actorIdTomb1), "decorateTomb1 is not valid");
+static_assert(DecorateIsValid(decorateTomb2, actorIdTomb2), "decorateTomb2 is not valid");
+static_assert(DecorateIsValid(decorateTomb3, actorIdTomb3), "decorateTomb3 is not valid");
+static_assert(DecorateIsValid(decorateExplodingWall, actorIdExplodingWall), "decorateExplodingWall is not valid");
+static_assert(DecorateIsValid(decorateWarpPit, actorIdWarpPit), "decorateWarpPit is not valid");
+static_assert(DecorateIsValid(decorateWarpPortal1, actorIdWarpPortal1), "decorateWarpPortal1 is not valid");
+static_assert(DecorateIsValid(decorateWarpPortal2, actorIdWarpPortal2), "decorateWarpPortal2 is not valid");
+static_assert(DecorateIsValid(decorateWarpPortal3, actorIdWarpPortal3), "decorateWarpPortal3 is not valid");
+static_assert(DecorateIsValid(decorateWarpPortal4, actorIdWarpPortal4), "decorateWarpPortal4 is not valid");
+static_assert(DecorateIsValid(decorateWarpPortal5, actorIdWarpPortal5), "decorateWarpPortal5 is not valid");
+static_assert(DecorateIsValid(decoratePlayer, actorIdPlayer), "decoratePlayer is not valid");
+static_assert(DecorateIsValid(decorateExplosion, actorIdBonusExplosion), "decorateExplosion is not valid");
+static_assert(DecorateIsValid(decorateBolt, actorIdBonusBolt), "decorateBolt is not valid");
+static_assert(DecorateIsValid(decorateNuke, actorIdBonusNuke), "decorateNuke is not valid");
+static_assert(DecorateIsValid(decoratePotion, actorIdBonusPotion), "decoratePotion is not valid");
+static_assert(DecorateIsValid(decorateChest, actorIdBonusChest), "decorateChest is not valid");
+static_assert(DecorateIsValid(decorateWaterChest, actorIdBonusWaterChest), "decorateWaterChest is not valid");
+static_assert(DecorateIsValid(decorateFreezeTime, actorIdBonusFreezeTime), "decorateFreezeTime is not valid");
+static_assert(DecorateIsValid(decorateScroll1, actorIdBonusScroll1), "decorateScroll1 is not valid");
+static_assert(DecorateIsValid(decorateScroll2, actorIdBonusScroll2), "decorateScroll2 is not valid");
+static_assert(DecorateIsValid(decorateScroll3, actorIdBonusScroll3), "decorateScroll3 is not valid");
+static_assert(DecorateIsValid(decorateScroll4, actorIdBonusScroll4), "decorateScroll4 is not valid");
+static_assert(DecorateIsValid(decorateScroll5, actorIdBonusScroll5), "decorateScroll5 is not valid");
+static_assert(DecorateIsValid(decorateScroll6, actorIdBonusScroll6), "decorateScroll6 is not valid");
+static_assert(DecorateIsValid(decorateScroll7, actorIdBonusScroll7), "decorateScroll7 is not valid");
+static_assert(DecorateIsValid(decorateScroll8, actorIdBonusScroll8), "decorateScroll8 is not valid");
+static_assert(DecorateIsValid(decorateKeyRed, actorIdBonusKeyRed), "decorateKeyRed is not valid");
+static_assert(DecorateIsValid(decorateKeyYellow, actorIdBonusKeyYellow), "decorateKeyYellow is not valid");
+static_assert(DecorateIsValid(decorateKeyGreen, actorIdBonusKeyGreen), "decorateKeyGreen is not valid");
+static_assert(DecorateIsValid(decorateKeyBlue, actorIdBonusKeyBlue), "decorateKeyBlue is not valid");
+static_assert(DecorateIsValid(decorateKeyRed2, actorIdBonusKeyRed2), "decorateKeyRed2 is not valid");
+static_assert(DecorateIsValid(decorateGemRed, actorIdBonusGemRed), "decorateGemRed is not valid");
+static_assert(DecorateIsValid(decorateGemYellow, actorIdBonusGemYellow), "decorateGemYellow is not valid");
+static_assert(DecorateIsValid(decorateGemGreen, actorIdBonusGemGreen), "decorateGemGreen is not valid");
+static_assert(DecorateIsValid(decorateGemBlue, actorIdBonusGemBlue), "decorateGemBlue is not valid");
+static_assert(DecorateIsValid(decorateGemPurple, actorIdBonusGemPurple), "decorateGemPurple is not valid");
+static_assert(DecorateIsValid(decorateZombie, actorIdMonsterZombie), "decorateZombie is not valid");
+static_assert(DecorateIsValid(decorateSkeleton, actorIdMonsterSkeleton), "decorateSkeleton is not valid");
+static_assert(DecorateIsValid(decorateWallSkeleton, actorIdMonsterWallSkeleton), "decorateWallSkeleton is not valid");
+static_assert(DecorateIsValid(decorateOrc, actorIdMonsterOrc), "decorateOrc is not valid");
+static_assert(DecorateIsValid(decorateTroll, actorIdMonsterTroll), "decorateTroll is not valid");
+static_assert(DecorateIsValid(decorateDemon, actorIdMonsterDemon), "decorateDemon is not valid");
+static_assert(DecorateIsValid(decorateRedDemon, actorIdMonsterRedDemon), "decorateRedDemon is not valid");
+static_assert(DecorateIsValid(decorateSpook, actorIdMonsterSpook), "decorateSpook is not valid");
+static_assert(DecorateIsValid(decorateBat, actorIdMonsterBat), "decorateBat is not valid");
+static_assert(DecorateIsValid(decorateMage, actorIdMonsterMage), "decorateMage is not valid");
+static_assert(DecorateIsValid(decorateEye, actorIdMonsterEye), "decorateEye is not valid");
+static_assert(DecorateIsValid(decorateWetMan, actorIdMonsterWetMan), "decorateWetMan is not valid");
+static_assert(DecorateIsValid(decorateNemesis, actorIdMonsterNemesis), "decorateNemesis is not valid");
+static_assert(DecorateIsValid(decoratePlayerShot, actorIdProjectilePlayerShot), "decoratePlayerShot is not valid");
+static_assert(DecorateIsValid(decoratePlayerBigShot, actorIdProjectilePlayerBigShot), "decoratePlayerBigShot is not valid");
+static_assert(DecorateIsValid(decorateMageShot, actorIdProjectileMageShot), "decorateMageShot is not valid");
+static_assert(DecorateIsValid(decorateEyeShot, actorIdProjectileEyeShot), "decorateEyeShot is not valid");
+static_assert(DecorateIsValid(decorateNemesisShot, actorIdProjectileNemesisShot), "decorateNemesisShot is not valid");
+
+const std::map<uint16_t, const DecorateActor> decorateAbyssAll =
+{
+    std::make_pair(actorIdTomb1, decorateTomb1),
+    std::make_pair(actorIdTomb2, decorateTomb2),
+    std::make_pair(actorIdTomb3, decorateTomb3),
+    std::make_pair(actorIdExplodingWall, decorateExplodingWall),
+    std::make_pair(actorIdWarpPit, decorateWarpPit),
+    std::make_pair(actorIdWarpPortal1, decorateWarpPortal1),
+    std::make_pair(actorIdWarpPortal2, decorateWarpPortal2),
+    std::make_pair(actorIdWarpPortal3, decorateWarpPortal3),
+    std::make_pair(actorIdWarpPortal4, decorateWarpPortal4),
+    std::make_pair(actorIdWarpPortal5, decorateWarpPortal5),
+    std::make_pair(actorIdPlayer, decoratePlayer),
+    std::make_pair(actorIdBonusExplosion, decorateExplosion),
+    std::make_pair(actorIdBonusBolt, decorateBolt),
+    std::make_pair(actorIdBonusNuke, decorateNuke),
+    std::make_pair(actorIdBonusPotion, decoratePotion),
+    std::make_pair(actorIdBonusChest, decorateChest),
+    std::make_pair(actorIdBonusWaterChest, decorateWaterChest),
+    std::make_pair(actorIdBonusFreezeTime, decorateFreezeTime),
+    std::make_pair(actorIdBonusScroll1, decorateScroll1),
+    std::make_pair(actorIdBonusScroll2, decorateScroll2),
+    std::make_pair(actorIdBonusScroll3, decorateScroll3),
+    std::make_pair(actorIdBonusScroll4, decorateScroll4),
+    std::make_pair(actorIdBonusScroll5, decorateScroll5),
+    std::make_pair(actorIdBonusScroll6, decorateScroll6),
+    std::make_pair(actorIdBonusScroll7, decorateScroll7),
+    std::make_pair(actorIdBonusScroll8, decorateScroll8),
+    std::make_pair(actorIdBonusKeyRed, decorateKeyRed),
+    std::make_pair(actorIdBonusKeyYellow, decorateKeyYellow),
+    std::make_pair(actorIdBonusKeyGreen, decorateKeyGreen),
+    std::make_pair(actorIdBonusKeyBlue, decorateKeyBlue),
+    std::make_pair(actorIdBonusKeyRed2, decorateKeyRed2),
+    std::make_pair(actorIdBonusGemRed, decorateGemRed),
+    std::make_pair(actorIdBonusGemYellow, decorateGemYellow),
+    std::make_pair(actorIdBonusGemGreen, decorateGemGreen),
+    std::make_pair(actorIdBonusGemBlue, decorateGemBlue),
+    std::make_pair(actorIdBonusGemPurple, decorateGemPurple),
+    std::make_pair(actorIdMonsterZombie, decorateZombie),
+    std::make_pair(actorIdMonsterSkeleton, decorateSkeleton),
+    std::make_pair(actorIdMonsterWallSkeleton, decorateWallSkeleton),
+    std::make_pair(actorIdMonsterOrc, decorateOrc),
+    std::make_pair(actorIdMonsterTroll, decorateTroll),
+    std::make_pair(actorIdMonsterDemon, decorateDemon),
+    std::make_pair(actorIdMonsterRedDemon, decorateRedDemon),
+    std::make_pair(actorIdMonsterSpook, decorateSpook),
+    std::make_pair(actorIdMonsterBat, decorateBat),
+    std::make_pair(actorIdMonsterMage, decorateMage),
+    std::make_pair(actorIdMonsterEye, decorateEye),
+    std::make_pair(actorIdMonsterWetMan, decorateWetMan),
+    std::make_pair(actorIdMonsterNemesis, decorateNemesis),
+    std::make_pair(actorIdProjectilePlayerShot, decoratePlayerShot),
+    std::make_pair(actorIdProjectilePlayerBigShot, decoratePlayerBigShot),
+    std::make_pair(actorIdProjectileMageShot, decorateMageShot),
+    std::make_pair(actorIdProjectileEyeShot, decorateEyeShot),
+    std::make_pair(actorIdProjectileNemesisShot, decorateNemesisShot)
+};
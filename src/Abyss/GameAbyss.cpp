@@ -16,7 +16,7 @@
 #include "GameAbyss.h"
 #include "GameMapsAbyss.h"
 #include "IntroViewAbyss.h"
-#include "..\Engine\IRenderer.h"
+#include "../Engine/IRenderer.h"
 
 // Decorate
 #include "DecorateAll.h"
@@ -61,9 +61,8 @@ GameAbyss::~GameAbyss()
     }
 }
 
-void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
+void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel, Random& random)
 {
-    Actor** actors = level->GetBlockingActors();
     Actor* const playerState = level->GetPlayerActor();
 
     for (uint16_t y = 0; y < level->GetLevelHeight(); y++)
@@ -86,65 +85,65 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
             case 5:
                 {
                     Actor* bonusActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateBolt);
-                    actors[(y * level->GetLevelWidth()) + x] = bonusActor;
+                    level->SetBlockingActor(x, y, bonusActor);
                     break;
                 }
             case 6:
                 {
                     Actor* bonusActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateNuke);
-                    actors[(y * level->GetLevelWidth()) + x] = bonusActor;
+                    level->SetBlockingActor(x, y, bonusActor);
                     break;
                 }
             case 7:
 
                 {
                     Actor* bonusActor = new Actor(x + 0.5f, y + 0.5f, 0, decoratePotion);
-                    actors[(y * level->GetLevelWidth()) + x] = bonusActor;
+                    level->SetBlockingActor(x, y, bonusActor);
                     break;
                 }
             case 8:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyRed);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyRed));
                 break;
             case 9:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyYellow);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyYellow));
                 break;
             case 10:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyGreen);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyGreen));
                 break;
             case 11:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyBlue);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyBlue));
                 break;
             case 12:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll1);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll1));
                 break;
             case 13:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll2);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll2));
                 break;
             case 14:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll3);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll3));
                 break;
             case 15:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll4);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll4));
                 break;
             case 16:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll5);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll5));
                 break;
             case 17:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll6);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll6));
                 break;
             case 18:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll7);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll7));
                 break;
             case 19:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll8);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateScroll8));
                 break;
             case 29:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyRed2);;
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyRed2));
                 break;
             case 21:
                 {
                     Actor* bonusActorChest = level->IsWaterLevel() ? new Actor(x + 0.5f, y + 0.5f, 0, decorateWaterChest) : new Actor(x + 0.5f, y + 0.5f, 0, decorateChest);
-                    actors[(y * level->GetLevelWidth()) + x] = bonusActorChest;
+                    level->SetBlockingActor(x, y, bonusActorChest);
                     break;
                 }
             case 20:
@@ -152,7 +151,7 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
             case 30:
                 {
                     Actor* redDemonActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateRedDemon);
-                    actors[(y * level->GetLevelWidth()) + x] = redDemonActor;
+                    level->SetBlockingActor(x, y, redDemonActor);
                     break;
                 }
             case 43:
@@ -168,7 +167,7 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
             case 25:
                 {
                     Actor* batActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateBat);
-                    actors[(y * level->GetLevelWidth()) + x] = batActor;
+                    level->SetBlockingActor(x, y, batActor);
                     break;
                 }
             case 44:
@@ -184,7 +183,7 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
             case 26:
                 {
                     Actor* demonActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateDemon);
-                    actors[(y * level->GetLevelWidth()) + x] = demonActor;
+                    level->SetBlockingActor(x, y, demonActor);
                     break;
                 }
             case 41:
@@ -200,7 +199,7 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
             case 22:
                 {
                     Actor* trollActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateTroll);
-                    actors[(y * level->GetLevelWidth()) + x] = trollActor;
+                    level->SetBlockingActor(x, y, trollActor);
                     break;
                 }
             case 42:
@@ -216,7 +215,7 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
             case 23:
                 {
                     Actor* orcActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateOrc);
-                    actors[(y * level->GetLevelWidth()) + x] = orcActor;
+                    level->SetBlockingActor(x, y, orcActor);
                     break;
                 }
             case 65:
@@ -231,10 +230,10 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
                 }
             case 63:
                 {
-                    const int16_t wetManDelay = (5*60)+ rand() % (5*60);
+                    const int16_t wetManDelay = (5*60)+ random.Next(5*60);
                     Actor* wetManActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateWetMan);
                     wetManActor->SetTemp2(wetManDelay);
-                    actors[(y * level->GetLevelWidth()) + x] = wetManActor;
+                    level->SetBlockingActor(x, y, wetManActor);
                     break;
                 }
             case 68:
@@ -250,7 +249,7 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
             case 66:
                 {
                     Actor*eyeActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateEye);
-                    actors[(y * level->GetLevelWidth()) + x] = eyeActor;
+                    level->SetBlockingActor(x, y, eyeActor);
                     break;
                 }
             case 45:
@@ -266,53 +265,53 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
             case 27:
                 {
                     Actor* mageActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateMage);
-                    actors[(y * level->GetLevelWidth()) + x] = mageActor;
+                    level->SetBlockingActor(x, y, mageActor);
                     break;
                 }
             case 28:
                 {
                     Actor* nemesisActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateNemesis);
-                    actors[(y * level->GetLevelWidth()) + x] = nemesisActor;
+                    level->SetBlockingActor(x, y, nemesisActor);
                     break;
                 }
             case 31:
                 {
-                    actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPortal1);
+                    level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPortal1));
                     break;
                 }
             case 32:
                 {
-                    actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPortal2);
+                    level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPortal2));
                     break;
                 }
             case 33:
                 {
-                    actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPortal3);
+                    level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPortal3));
                     break;
                 }
             case 34:
                 {
-                    actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPortal4);
+                    level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPortal4));
                     break;
                 }
             case 35:
                 {
-                    actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPortal5);
+                    level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPortal5));
                     break;
                 }
             case 54:
                 {
-                    actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPit);
+                    level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateWarpPit));
                     break;
                 }
             case 46:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb1);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb1));
                 break;
             case 47:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb2);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb2));
                 break;
             case 48:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb3);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb3));
                 break;
             case 51:
                 if (difficultyLevel < Hard)
@@ -332,11 +331,11 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
                         spook_delay = (tile>>8)*30;
                     else
                     {
-                        spook_delay = (2*60)+ rand() % (5*60);
+                        spook_delay = (2*60)+ random.Next(5*60);
                     }
                     Actor* spookActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateSpook);
                     spookActor->SetTemp2(spook_delay);
-                    actors[(y * level->GetLevelWidth()) + x] = spookActor;
+                    level->SetBlockingActor(x, y, spookActor);
                     break;
                 }
             case 53:
@@ -353,7 +352,7 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
                         zombie_delay = (tile>>8)*30;
                     else
                     {
-                        const int16_t current_zombie_delay = (2*60)+ rand() % (4*60);
+                        const int16_t current_zombie_delay = (2*60)+ random.Next(4*60);
                         zombie_delay = m_zombie_base_delay+current_zombie_delay;
                         m_zombie_base_delay += current_zombie_delay;
                         if (m_zombie_base_delay > 8*60)
@@ -361,7 +360,7 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
                     }
                     Actor* zombieActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateZombie);
                     zombieActor->SetTemp2(zombie_delay);
-                    actors[(y * level->GetLevelWidth()) + x] = zombieActor;
+                    level->SetBlockingActor(x, y, zombieActor);
                     break;
                 }
             case 56:
@@ -372,29 +371,29 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
             case 55:
                 {
                     Actor* skeletonActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateSkeleton);
-                    actors[(y * level->GetLevelWidth()) + x] = skeletonActor;
+                    level->SetBlockingActor(x, y, skeletonActor);
                     break;
                 }
             case 57:
                 {
                     Actor* freezeTimeActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateFreezeTime);
-                    actors[(y * level->GetLevelWidth()) + x] = freezeTimeActor;
+                    level->SetBlockingActor(x, y, freezeTimeActor);
                     break;
                 }
             case 58:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateGemRed);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateGemRed));
                 break;
             case 59:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateGemGreen);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateGemGreen));
                 break;
             case 60:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateGemBlue);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateGemBlue));
                 break;
             case 61:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateGemYellow);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateGemYellow));
                 break;
             case 62:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateGemPurple);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateGemPurple));
                 break;
             case 71:
                 if (difficultyLevel < Hard)
@@ -427,7 +426,7 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
                     }
                     else
                     {
-                        const int16_t current_zombie_delay = (2*60)+ rand() % (4*60);
+                        const int16_t current_zombie_delay = (2*60)+ random.Next(4*60);
                         zombie_delay = m_zombie_base_delay+current_zombie_delay;
                         m_zombie_base_delay += current_zombie_delay;
                         if (m_zombie_base_delay > 8*60)
@@ -435,7 +434,7 @@ void GameAbyss::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
                     }
                     Actor* wallSkeletonActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateWallSkeleton);
                     wallSkeletonActor->SetTemp2(zombie_delay);
-                    actors[(y * level->GetLevelWidth()) + x] = wallSkeletonActor;
+                    level->SetBlockingActor(x, y, wallSkeletonActor);
                     break;
                 }
             default:
@@ -20,8 +20,8 @@
 //
 #pragma once
 
-#include "..\Engine\IGame.h"
-#include "..\Engine\IRenderer.h"
+#include "../Engine/IGame.h"
+#include "../Engine/IRenderer.h"
 #include <map>
 
 class GameAbyss: public IGame
@@ -30,7 +30,7 @@ public:
     GameAbyss(const uint8_t gameId, const std::string gamePath, IRenderer& renderer);
     ~GameAbyss();
 
-    void SpawnActors(Level* level, const DifficultyLevel difficultyLevel);
+    void SpawnActors(Level* level, const DifficultyLevel difficultyLevel, Random& random);
     void DrawStatusBar(const int16_t health, const std::string& locationMessage, const PlayerInventory& playerInventory);
     GameMaps* GetGameMaps();
     EgaGraph* GetEgaGraph();
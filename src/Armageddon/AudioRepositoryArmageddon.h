@@ -21,7 +21,7 @@
 //
 #pragma once
 
-#include "..\Engine\AudioRepository.h"
+#include "../Engine/AudioRepository.h"
 #include <vector>
 
 const huffmanTable audioDictionaryArmageddon =
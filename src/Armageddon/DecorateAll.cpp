@@ -0,0 +1,1730 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+#include "DecorateAll.h"
+
+namespace Armageddon
+{
+
+//
+// PLAYER SHOT
+//
+
+constexpr DecorateAnimationFrame playerShotFlyAnimation[] =
+{
+    { PSHOT1PIC , 8, ActionPlayerProjectile },
+    { PSHOT2PIC , 8, ActionPlayerProjectile }
+};
+
+constexpr DecorateState playerShotStateFly = 
+{
+    playerShotFlyAnimation,
+    StateIdProjectileFly   // Loop
+};
+
+constexpr DecorateAnimationFrame playerShotDyingAnimation[] =
+{
+    { PSHOT_EXP1PIC , 7, ActionNone },
+    { PSHOT_EXP2PIC , 7, ActionNone },
+    { PSHOT_EXP3PIC , 7, ActionNone },
+    { 0 , 7, ActionRemove },
+};
+
+constexpr DecorateState playerShotStateDying = 
+{
+    playerShotDyingAnimation,
+    StateIdDying   // Loop
+};
+
+constexpr DecorateStatePair playerShotStates[] =
+{
+    std::make_pair(StateIdProjectileFly, playerShotStateFly),
+    std::make_pair(StateIdDying, playerShotStateDying)
+};
+
+constexpr DecorateActor decoratePlayerShot =
+{
+    actorIdProjectilePlayerShot,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard;
+    1,  // initialHealth;
+    7 * pixelRadius,    // size;
+    Flickering,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    playerShotStates,
+    StateIdProjectileFly,   // initialState;
+    1,  // damage;
+    0, // hitSound;
+    10000,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// PLAYER BIG SHOT
+// Fired by the nuke / X-terminator
+//
+
+constexpr DecorateActor decoratePlayerBigShot =
+{
+    actorIdProjectilePlayerBigShot,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard;
+    1,  // initialHealth;
+    24 * pixelRadius,    // size;
+    Flickering,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    playerShotStates,
+    StateIdProjectileFly,   // initialState;
+    3,  // damage;
+    0, // hitSound;
+    10000,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// NEMESIS SHOT (FLAMING SKULL)
+//
+
+constexpr DecorateAnimationFrame nemesisShotFlyAnimation[] =
+{
+    { SKULL_SHOTPIC , 8, ActionMonsterProjectile }
+};
+
+constexpr DecorateState nemesisShotStateFly = 
+{
+    nemesisShotFlyAnimation,
+    StateIdProjectileFly   // Loop
+};
+
+constexpr DecorateStatePair nemesisShotStates[] =
+{
+    std::make_pair(StateIdProjectileFly, nemesisShotStateFly),
+    std::make_pair(StateIdDying, playerShotStateDying)
+};
+
+constexpr DecorateActor decorateNemesisShot =
+{
+    actorIdProjectileNemesisShot,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard;
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    nemesisShotStates,
+    StateIdProjectileFly,   // initialState;
+    25,  // damage;
+    0, // hitSound;
+    10000,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// TOMBSTONE 1
+//
+
+constexpr DecorateAnimationFrame tomb1DecorationAnimation[] =
+{
+    { TOMB1PIC, 8, ActionNone }
+};
+
+constexpr DecorateState tomb1StateDecoration =
+{
+    tomb1DecorationAnimation,
+    StateIdDecoration // Loop
+};
+
+constexpr DecorateStatePair tomb1States[] =
+{
+    std::make_pair(StateIdDecoration, tomb1StateDecoration)
+};
+
+constexpr DecorateActor decorateTomb1 =
+{
+    actorIdTomb1,   // Id
+    45, // spawnOnAllDifficulties;
+    45, // spawnOnNormalAndHard;
+    45,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    tomb1States,
+    StateIdDecoration,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter,
+    0 // ProjectileId
+};
+
+//
+// TOMBSTONE 2
+//
+
+constexpr DecorateAnimationFrame tomb2DecorationAnimation[] =
+{
+    { TOMB2PIC, 8, ActionNone }
+};
+
+constexpr DecorateState tomb2StateDecoration =
+{
+    tomb2DecorationAnimation,
+    StateIdDecoration // Loop
+};
+
+constexpr DecorateStatePair tomb2States[] =
+{
+    std::make_pair(StateIdDecoration, tomb2StateDecoration)
+};
+
+constexpr DecorateActor decorateTomb2 =
+{
+    actorIdTomb2,   // Id
+    46, // spawnOnAllDifficulties;
+    46, // spawnOnNormalAndHard;
+    46,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    tomb2States,
+    StateIdDecoration,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// TOMBSTONE 3
+//
+
+constexpr DecorateAnimationFrame tomb3DecorationAnimation[] =
+{
+    { TOMB3PIC, 8, ActionNone }
+};
+
+constexpr DecorateState tomb3StateDecoration =
+{
+    tomb3DecorationAnimation,
+    StateIdDecoration // Loop
+};
+
+constexpr DecorateStatePair tomb3States[] =
+{
+    std::make_pair(StateIdDecoration, tomb3StateDecoration)
+};
+
+constexpr DecorateActor decorateTomb3 =
+{
+    actorIdTomb3,   // Id
+    47, // spawnOnAllDifficulties;
+    47, // spawnOnNormalAndHard;
+    47,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    tomb3States,
+    StateIdDecoration,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// PLAYER
+//
+
+constexpr DecorateAnimationFrame playerWalkAnimation[] =
+{
+    { 0, 8, ActionNone }
+};
+
+constexpr DecorateState playerStateWalk =
+{
+    playerWalkAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame playerDyingAnimation[] =
+{
+    { 0, 8, ActionNone }
+};
+
+constexpr DecorateState playerStateDying =
+{
+    playerDyingAnimation,
+    StateIdDying
+};
+
+constexpr DecorateStatePair playerStates[] =
+{
+    std::make_pair(StateIdWalk, playerStateWalk),
+    std::make_pair(StateIdDying, playerStateDying)
+};
+
+constexpr DecorateActor decoratePlayer =
+{
+    actorIdPlayer,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard
+    100,  // initialHealth;
+    0.4f,    // size;
+    Always,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    playerStates,
+    StateIdWalk,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// COLUMN
+//
+
+constexpr DecorateAnimationFrame columnDecorationAnimation[] =
+{
+    { COLUMNPIC, 20, ActionNone }
+};
+
+constexpr DecorateState columnStateDecoration =
+{
+    columnDecorationAnimation,
+    StateIdDecoration // Loop
+};
+
+constexpr DecorateStatePair columnStates[] =
+{
+    std::make_pair(StateIdDecoration, columnStateDecoration)
+};
+
+constexpr DecorateActor decorateColumn =
+{
+    actorIdColumn,   // Id
+    54, // spawnOnAllDifficulties;
+    54, // spawnOnNormalAndHard;
+    54,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    columnStates,
+    StateIdDecoration,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter,
+    0 // ProjectileId
+};
+
+//
+// SULPHUR GAS
+//
+
+constexpr DecorateAnimationFrame sulphurGasDecorationAnimation[] =
+{
+    { SULPHUR_GAS_1PIC, 20, ActionNone },
+    { SULPHUR_GAS_2PIC, 20, ActionNone },
+    { SULPHUR_GAS_3PIC, 20, ActionNone }
+};
+
+constexpr DecorateState sulphurGasStateDecoration =
+{
+    sulphurGasDecorationAnimation,
+    StateIdDecoration // Loop
+};
+
+constexpr DecorateStatePair sulphurGasStates[] =
+{
+    std::make_pair(StateIdDecoration, sulphurGasStateDecoration)
+};
+
+constexpr DecorateActor decorateSulphurGas =
+{
+    actorIdSulphurGas,   // Id
+    55, // spawnOnAllDifficulties;
+    55, // spawnOnNormalAndHard;
+    55,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    sulphurGasStates,
+    StateIdDecoration,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter,
+    0 // ProjectileId
+};
+
+//
+// FIRE POT
+//
+
+constexpr DecorateAnimationFrame firePotDecorationAnimation[] =
+{
+    { FIRE_POT_1PIC, 20, ActionNone },
+    { FIRE_POT_2PIC, 20, ActionNone }
+};
+
+constexpr DecorateState firePotStateDecoration =
+{
+    firePotDecorationAnimation,
+    StateIdDecoration // Loop
+};
+
+constexpr DecorateStatePair firePotStates[] =
+{
+    std::make_pair(StateIdDecoration, firePotStateDecoration)
+};
+
+constexpr DecorateActor decorateFirePot =
+{
+    actorIdFirePot,   // Id
+    56, // spawnOnAllDifficulties;
+    56, // spawnOnNormalAndHard;
+    56,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    firePotStates,
+    StateIdDecoration,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter,
+    0 // ProjectileId
+};
+
+//
+// FOUNTAIN
+//
+
+constexpr DecorateAnimationFrame fountainDecorationAnimation[] =
+{
+    { WFOUNTAINPIC, 20, ActionNone }
+};
+
+constexpr DecorateState  fountainStateDecoration =
+{
+    fountainDecorationAnimation,
+    StateIdDecoration // Loop
+};
+
+constexpr DecorateStatePair  fountainStates[] =
+{
+    std::make_pair(StateIdDecoration,  fountainStateDecoration)
+};
+
+constexpr DecorateActor decorateFountain =
+{
+    actorIdFountain,   // Id
+    58, // spawnOnAllDifficulties;
+    58, // spawnOnNormalAndHard;
+    58,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    fountainStates,
+    StateIdDecoration,   // initialState;
+    0,  // meleeDamage;
+    SHOOTWALLSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter,
+    0 // ProjectileId
+};
+
+//
+// BONUS ITEM DESTROYED
+//
+
+constexpr DecorateAnimationFrame bonusDyingAnimation[] =
+{
+    { PSHOT_EXP1PIC, 7, ActionItemDestroyed },
+    { PSHOT_EXP2PIC , 7, ActionNone },
+    { PSHOT_EXP3PIC , 7, ActionNone },
+    { 0 , 7, ActionRemove },
+};
+constexpr DecorateState bonusStateDying =
+{
+    bonusDyingAnimation,
+    StateIdDying   // Loop
+};
+
+//
+// EXPLOSION
+//
+
+constexpr DecorateAnimationFrame explosionHiddenAnimation[] =
+{
+    { 0 , 2, ActionExplosionDelay }
+};
+
+constexpr DecorateState explosionStateHidden =
+{
+    explosionHiddenAnimation,
+    StateIdHidden   // Loop
+};
+
+constexpr DecorateAnimationFrame explosionDyingAnimation[] =
+{
+    { PSHOT_EXP1PIC , 7, ActionNone },
+    { PSHOT_EXP2PIC , 7, ActionNone },
+    { PSHOT_EXP3PIC , 7, ActionNone },
+    { 0 , 7, ActionRemove },
+};
+
+constexpr DecorateState explosionStateDying =
+{
+    explosionDyingAnimation,
+    StateIdDying   // Loop
+};
+
+constexpr DecorateStatePair explosionStates[] =
+{
+    std::make_pair(StateIdHidden, explosionStateHidden),
+    std::make_pair(StateIdDying, explosionStateDying)
+};
+
+constexpr DecorateActor decorateExplosion =
+{
+    actorIdBonusExplosion,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    explosionStates,
+    StateIdHidden,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// BOLT
+//
+
+constexpr DecorateAnimationFrame boltWaitForPickupAnimation[] =
+{
+    { BOLTOBJPIC, 8, ActionWaitForPickup },
+    { BOLT2OBJPIC, 8, ActionWaitForPickup },
+    { BOLT3OBJPIC, 8, ActionWaitForPickup },
+};
+
+constexpr DecorateState boltWaitForPickup =
+{
+    boltWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame boltPickupAnimation[] =
+{
+    { 0, 6, ActionGiveBolt },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState boltPickup =
+{
+    boltPickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair boltStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, boltWaitForPickup),
+    std::make_pair(StateIdPickup, boltPickup),
+    std::make_pair(StateIdDying, bonusStateDying)
+};
+
+constexpr DecorateActor decorateBolt =
+{
+    actorIdBonusBolt,   // Id
+    5, // spawnOnAllDifficulties;
+    5, // spawnOnNormalAndHard;
+    5,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    boltStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// NUKE
+//
+
+constexpr DecorateAnimationFrame nukeWaitForPickupAnimation[] =
+{
+    { NUKEOBJPIC, 8, ActionWaitForPickup },
+    { NUKE2OBJPIC, 8, ActionWaitForPickup },
+    { NUKE3OBJPIC, 8, ActionWaitForPickup },
+};
+
+constexpr DecorateState nukeWaitForPickup =
+{
+    nukeWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame nukePickupAnimation[] =
+{
+    { 0, 6, ActionGiveNuke },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState nukePickup =
+{
+    nukePickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair nukeStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, nukeWaitForPickup),
+    std::make_pair(StateIdPickup, nukePickup),
+    std::make_pair(StateIdDying, bonusStateDying)
+};
+
+constexpr DecorateActor decorateNuke =
+{
+    actorIdBonusNuke,   // Id
+    6, // spawnOnAllDifficulties;
+    6, // spawnOnNormalAndHard;
+    6,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    nukeStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// POTION
+//
+
+constexpr DecorateAnimationFrame potionWaitForPickupAnimation[] =
+{
+    { POTIONOBJPIC, 8, ActionWaitForPickup }
+};
+
+constexpr DecorateState potionWaitForPickup =
+{
+    potionWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame potionPickupAnimation[] =
+{
+    { 0, 6, ActionGivePotion },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState potionPickup =
+{
+    potionPickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair potionStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, potionWaitForPickup),
+    std::make_pair(StateIdPickup, potionPickup),
+    std::make_pair(StateIdDying, bonusStateDying)
+};
+
+constexpr DecorateActor decoratePotion =
+{
+    actorIdBonusPotion,   // Id
+    7, // spawnOnAllDifficulties;
+    7, // spawnOnNormalAndHard;
+    7,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    potionStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// CHEST
+//
+
+constexpr DecorateAnimationFrame chestWaitForPickupAnimation[]
+{
+    { CHESTOBJPIC, 8, ActionWaitForPickup }
+};
+
+constexpr DecorateState chestWaitForPickup =
+{
+    chestWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame chestPickupAnimation[] =
+{
+    { 0, 6, ActionGiveChest },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState chestPickup =
+{
+    chestPickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair chestStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, chestWaitForPickup),
+    std::make_pair(StateIdPickup, chestPickup),
+    std::make_pair(StateIdDying, bonusStateDying)
+};
+
+constexpr DecorateActor decorateChest =
+{
+    actorIdBonusChest,   // Id
+    21, // spawnOnAllDifficulties;
+    21, // spawnOnNormalAndHard;
+    21,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    chestStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// WATER CHEST
+//
+
+constexpr DecorateAnimationFrame waterChestWaitForPickupAnimation[] =
+{
+    { O_WATER_CHEST1PIC, 8, ActionWaitForPickup },
+    { O_WATER_CHEST2PIC, 8, ActionWaitForPickup }
+};
+
+constexpr DecorateState waterChestWaitForPickup =
+{
+    waterChestWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair waterChestStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, waterChestWaitForPickup),
+    std::make_pair(StateIdPickup, chestPickup),
+    std::make_pair(StateIdDying, bonusStateDying)
+};
+
+constexpr DecorateActor decorateWaterChest =
+{
+    actorIdBonusWaterChest,   // Id
+    21, // spawnOnAllDifficulties;
+    21, // spawnOnNormalAndHard;
+    21,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    waterChestStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// FREEZE TIME
+//
+
+constexpr DecorateAnimationFrame freezeTimeWaitForPickupAnimation[] =
+{
+    { TIMEOBJ1PIC, 6, ActionWaitForPickup },
+    { TIMEOBJ2PIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState freezeTimeWaitForPickup =
+{
+    freezeTimeWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame freezeTimePickupAnimation[] =
+{
+    { 0, 6, ActionFreezeTime },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState freezeTimePickup =
+{
+    freezeTimePickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair freezeTimeStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, freezeTimeWaitForPickup),
+    std::make_pair(StateIdPickup, freezeTimePickup),
+};
+
+constexpr DecorateActor decorateFreezeTime =
+{
+    actorIdBonusFreezeTime,   // Id
+    57, // spawnOnAllDifficulties;
+    57, // spawnOnNormalAndHard;
+    57,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    freezeTimeStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    BOOMSND, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// KEY RED
+//
+
+constexpr DecorateAnimationFrame keyRedWaitForPickupAnimation[] =
+{
+    { RKEYOBJPIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState keyRedWaitForPickup =
+{
+    keyRedWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame keyPickupAnimation[] =
+{
+    { 0, 6, ActionGiveKey },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState keyPickup =
+{
+    keyPickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair keyRedStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, keyRedWaitForPickup),
+    std::make_pair(StateIdPickup, keyPickup),
+};
+
+constexpr DecorateActor decorateKeyRed =
+{
+    actorIdBonusKeyRed,   // Id
+    8, // spawnOnAllDifficulties;
+    8, // spawnOnNormalAndHard;
+    8,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    keyRedStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// KEY YELLOW
+//
+
+constexpr DecorateAnimationFrame keyYellowWaitForPickupAnimation[] =
+{
+    { YKEYOBJPIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState keyYellowWaitForPickup =
+{
+    keyYellowWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair keyYellowStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, keyYellowWaitForPickup),
+    std::make_pair(StateIdPickup, keyPickup),
+};
+
+constexpr DecorateActor decorateKeyYellow =
+{
+    actorIdBonusKeyYellow,   // Id
+    9, // spawnOnAllDifficulties;
+    9, // spawnOnNormalAndHard;
+    9,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    keyYellowStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    1, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// KEY GREEN
+//
+
+constexpr DecorateAnimationFrame keyGreenWaitForPickupAnimation[] =
+{
+    { GKEYOBJPIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState keyGreenWaitForPickup =
+{
+    keyGreenWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair keyGreenStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, keyGreenWaitForPickup),
+    std::make_pair(StateIdPickup, keyPickup),
+};
+
+constexpr DecorateActor decorateKeyGreen =
+{
+    actorIdBonusKeyGreen,   // Id
+    10, // spawnOnAllDifficulties;
+    10, // spawnOnNormalAndHard;
+    10,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    keyGreenStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    2, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// KEY BLUE
+//
+
+constexpr DecorateAnimationFrame keyBlueWaitForPickupAnimation[] =
+{
+    { BKEYOBJPIC, 6, ActionWaitForPickup }
+};
+
+constexpr DecorateState keyBlueWaitForPickup =
+{
+    keyBlueWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair keyBlueStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, keyBlueWaitForPickup),
+    std::make_pair(StateIdPickup, keyPickup),
+};
+
+constexpr DecorateActor decorateKeyBlue =
+{
+    actorIdBonusKeyBlue,   // Id
+    11, // spawnOnAllDifficulties;
+    11, // spawnOnNormalAndHard;
+    11,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    keyBlueStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    3, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// GEM RED
+//
+
+constexpr DecorateAnimationFrame gemRedWaitForPickupAnimation[] =
+{
+    { RGEM1PIC, 30, ActionWaitForPickup },
+    { RGEM2PIC, 30, ActionWaitForPickup }
+};
+
+constexpr DecorateState gemRedWaitForPickup =
+{
+    gemRedWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateAnimationFrame gemPickupAnimation[] =
+{
+    { 0, 6, ActionGiveGem },
+    { 0, 6, ActionRemove }
+};
+
+constexpr DecorateState gemPickup =
+{
+    gemPickupAnimation,
+    StateIdPickup
+};
+
+constexpr DecorateStatePair gemRedStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, gemRedWaitForPickup),
+    std::make_pair(StateIdPickup, gemPickup),
+};
+
+constexpr DecorateActor decorateGemRed =
+{
+    actorIdBonusGemRed,   // Id
+    58, // spawnOnAllDifficulties;
+    58, // spawnOnNormalAndHard;
+    58,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    gemRedStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// GEM YELLOW
+//
+
+constexpr DecorateAnimationFrame gemYellowWaitForPickupAnimation[] =
+{
+    { YGEM1PIC, 30, ActionWaitForPickup },
+    { YGEM2PIC, 30, ActionWaitForPickup }
+};
+
+constexpr DecorateState gemYellowWaitForPickup =
+{
+    gemYellowWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair gemYellowStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, gemYellowWaitForPickup),
+    std::make_pair(StateIdPickup, gemPickup),
+};
+
+constexpr DecorateActor decorateGemYellow =
+{
+    actorIdBonusGemYellow,   // Id
+    59, // spawnOnAllDifficulties;
+    59, // spawnOnNormalAndHard;
+    59,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    gemYellowStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    3, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// GEM GREEN
+//
+
+constexpr DecorateAnimationFrame gemGreenWaitForPickupAnimation[] =
+{
+    { GGEM1PIC, 30, ActionWaitForPickup },
+    { GGEM2PIC, 30, ActionWaitForPickup }
+};
+
+constexpr DecorateState gemGreenWaitForPickup =
+{
+    gemGreenWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair gemGreenStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, gemGreenWaitForPickup),
+    std::make_pair(StateIdPickup, gemPickup),
+};
+
+constexpr DecorateActor decorateGemGreen =
+{
+    actorIdBonusGemGreen,   // Id
+    60, // spawnOnAllDifficulties;
+    60, // spawnOnNormalAndHard;
+    60,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    gemGreenStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    1, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// GEM BLUE
+//
+
+constexpr DecorateAnimationFrame gemBlueWaitForPickupAnimation[] =
+{
+    { BGEM1PIC, 30, ActionWaitForPickup },
+    { BGEM2PIC, 30, ActionWaitForPickup }
+};
+
+constexpr DecorateState gemBlueWaitForPickup =
+{
+    gemBlueWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair gemBlueStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, gemBlueWaitForPickup),
+    std::make_pair(StateIdPickup, gemPickup),
+};
+
+constexpr DecorateActor decorateGemBlue =
+{
+    actorIdBonusGemBlue,   // Id
+    61, // spawnOnAllDifficulties;
+    61, // spawnOnNormalAndHard;
+    61,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    gemBlueStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    2, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// GEM PURPLE
+//
+
+constexpr DecorateAnimationFrame gemPurpleWaitForPickupAnimation[] =
+{
+    { PGEM1PIC, 30, ActionWaitForPickup },
+    { PGEM2PIC, 30, ActionWaitForPickup }
+};
+
+constexpr DecorateState gemPurpleWaitForPickup =
+{
+    gemPurpleWaitForPickupAnimation,
+    StateIdWaitForPickup
+};
+
+constexpr DecorateStatePair gemPurpleStates[] =
+{
+    std::make_pair(StateIdWaitForPickup, gemPurpleWaitForPickup),
+    std::make_pair(StateIdPickup, gemPickup),
+};
+
+constexpr DecorateActor decorateGemPurple =
+{
+    actorIdBonusGemPurple,   // Id
+    62, // spawnOnAllDifficulties;
+    62, // spawnOnNormalAndHard;
+    62,  // spawnOnHard
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Never,  // radarVisibility;
+    EgaBrightWhite,   // radarColor;
+    gemPurpleStates,
+    StateIdWaitForPickup,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    4, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// ZOMBIE
+//
+
+constexpr DecorateAnimationFrame zombieHiddenAnimation[] =
+{
+    { 0 , 13, ActionHide }
+};
+
+constexpr DecorateState zombieStateHidden =
+{
+    zombieHiddenAnimation,
+    StateIdHidden   // Loop
+};
+
+constexpr DecorateAnimationFrame zombieRiseAnimation[] =
+{
+    { ZOMB_APPEAR1PIC, 24, ActionNone },
+    { ZOMB_APPEAR2PIC, 24, ActionNone },
+    { ZOMB_APPEAR3PIC, 24, ActionNone },
+    { ZOMB_APPEAR4PIC, 24, ActionNone },
+    { ZOMB_WALK3PIC, 1, ActionNone }
+};
+
+constexpr DecorateState zombieStateRise =
+{
+    zombieRiseAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame zombieWalkAnimation[] =
+{
+    { ZOMB_WALK1PIC, 13, ActionChase },
+    { ZOMB_WALK2PIC, 13, ActionChase },
+    { ZOMB_WALK3PIC, 13, ActionChase }
+};
+
+constexpr DecorateState zombieStateWalk =
+{
+    zombieWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame zombieAttackAnimation[] =
+{
+    { ZOMB_ATTACKPIC, 15, ActionAttack },
+    { ZOMB_WALK1PIC, 20, ActionNone }
+};
+
+constexpr DecorateState zombieStateAttack =
+{
+    zombieAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame zombiePainAnimation[] =
+{
+    { ZOMB_OUCHPIC, 15, ActionNone }
+};
+
+constexpr DecorateState zombieStatePain =
+{
+    zombiePainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame zombieDyingAnimation[] =
+{
+    { ZOMB_DIE1PIC, 16, ActionNone },
+    { ZOMB_DIE2PIC, 16, ActionNone },
+    { ZOMB_DIE3PIC, 16, ActionNone }
+};
+
+constexpr DecorateState zombieStateDying =
+{
+    zombieDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateAnimationFrame zombieDeadAnimation[] =
+{
+    { ZOMB_DIE3PIC, 16, ActionNone }
+};
+
+constexpr DecorateState zombieStateDead =
+{
+    zombieDeadAnimation,
+    StateIdDead //  Loop
+};
+
+constexpr DecorateStatePair zombieStates[] =
+{
+    std::make_pair(StateIdHidden, zombieStateHidden),
+    std::make_pair(StateIdRise, zombieStateRise),
+    std::make_pair(StateIdWalk, zombieStateWalk),
+    std::make_pair(StateIdAttack, zombieStateAttack),
+    std::make_pair(StateIdPain, zombieStatePain),
+    std::make_pair(StateIdDying, zombieStateDying),
+    std::make_pair(StateIdDead, zombieStateDead)
+};
+
+constexpr DecorateActor decorateZombie =
+{
+    actorIdMonsterZombie,   // Id
+    36, // spawnOnAllDifficulties;
+    36, // spawnOnNormalAndHard;
+    36, // spawnOnHard;
+    5,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithPurpleGem,  // radarVisibility;
+    EgaBrightMagenta,   // radarColor;
+    zombieStates,
+    StateIdHidden,   // initialState;
+    8,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    2500,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// TREE
+//
+
+constexpr DecorateAnimationFrame treeHiddenAnimation[] =
+{
+    { TREE_IDLEPIC , 13, ActionHide }
+};
+
+constexpr DecorateState treeStateHidden =
+{
+    treeHiddenAnimation,
+    StateIdHidden   // Loop
+};
+
+constexpr DecorateAnimationFrame treeRiseAnimation[] =
+{
+    { TREE_AWAKENINGPIC, 50, ActionNone }
+};
+
+constexpr DecorateState treeStateRise =
+{
+    treeRiseAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame treeWalkAnimation[] =
+{
+    { TREE_WALK1PIC, 13, ActionChase },
+    { TREE_WALK2PIC, 13, ActionChase }
+};
+
+constexpr DecorateState treeStateWalk =
+{
+    treeWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame treeAttackAnimation[] =
+{
+    { TREE_ATTACK1PIC, 15, ActionAttack },
+    { TREE_ATTACK2PIC, 15, ActionAttack },
+    { TREE_ATTACK3PIC, 15, ActionNone }
+};
+
+constexpr DecorateState treeStateAttack =
+{
+    treeAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame treePainAnimation[] =
+{
+    { TREE_AWAKENINGPIC, 15, ActionNone }
+};
+
+constexpr DecorateState treeStatePain =
+{
+    treePainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame treeDyingAnimation[] =
+{
+    { TREE_DEATH1PIC, 45, ActionNone },
+    { TREE_DEATH2PIC, 25, ActionNone }
+};
+
+constexpr DecorateState treeStateDying =
+{
+    treeDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateAnimationFrame treeDeadAnimation[] =
+{
+    { TREE_DEATH1PIC, 15, ActionNone },
+    { TREE_DEATH2PIC, 15, ActionNone },
+    { TREE_DEATH3PIC, 15, ActionNone }
+};
+
+constexpr DecorateState treeStateDead =
+{
+    treeDeadAnimation,
+    StateIdDead //  Loop
+};
+
+constexpr DecorateStatePair treeStates[] =
+{
+    std::make_pair(StateIdHidden, treeStateHidden),
+    std::make_pair(StateIdRise, treeStateRise),
+    std::make_pair(StateIdWalk, treeStateWalk),
+    std::make_pair(StateIdAttack, treeStateAttack),
+    std::make_pair(StateIdPain, treeStatePain),
+    std::make_pair(StateIdDying, treeStateDying),
+    std::make_pair(StateIdDead, treeStateDead)
+};
+
+constexpr DecorateActor decorateTree =
+{
+    actorIdMonsterTree,   // Id
+    50, // spawnOnAllDifficulties;
+    50, // spawnOnNormalAndHard;
+    50, // spawnOnHard;
+    12,  // initialHealth;
+    35 * pixelRadius,    // size;
+    WithYellowGem,  // radarVisibility;
+    EgaBrown,   // radarColor;
+    treeStates,
+    StateIdHidden,   // initialState;
+    7,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    2500,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// BUNNY
+//
+
+constexpr DecorateAnimationFrame bunnyHiddenAnimation[] =
+{
+    { BUNNY_LEFT1PIC , 10, ActionHide },
+    { BUNNY_LEFT2PIC , 30, ActionHide }
+};
+
+constexpr DecorateState bunnyStateHidden =
+{
+    bunnyHiddenAnimation,
+    StateIdHidden   // Loop
+};
+
+constexpr DecorateAnimationFrame bunnyRiseAnimation[] =
+{
+    { BUNNY_META1PIC, 30, ActionNone },
+    { BUNNY_META2PIC, 30, ActionNone }
+};
+
+constexpr DecorateState bunnyStateRise =
+{
+    bunnyRiseAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame bunnyWalkAnimation[] =
+{
+    { BUNNY_WALK1PIC, 25, ActionChase },
+    { BUNNY_WALK2PIC, 25, ActionChase }
+};
+
+constexpr DecorateState bunnyStateWalk =
+{
+    bunnyWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame bunnyAttackAnimation[] =
+{
+    { BUNNY_WALK1PIC, 25, ActionNone },
+    { BUNNY_WALK2PIC, 25, ActionAttack }
+};
+
+constexpr DecorateState bunnyStateAttack =
+{
+    bunnyAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame bunnyPainAnimation[] =
+{
+    { BUNNY_OUCHPIC, 30, ActionNone },
+    { BUNNY_WALK1PIC, 50, ActionNone }
+};
+
+constexpr DecorateState bunnyStatePain =
+{
+    bunnyPainAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame bunnyDyingAnimation[] =
+{
+    { BUNNY_OUCHPIC, 40, ActionNone },
+    { BUNNY_DEATH1PIC, 50, ActionNone },
+    { BUNNY_DEATH2PIC, 20, ActionNone }
+};
+
+constexpr DecorateState bunnyStateDying =
+{
+    bunnyDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateAnimationFrame bunnyDeadAnimation[] =
+{
+    { BUNNY_DEATH2PIC, 20, ActionNone }
+};
+
+constexpr DecorateState bunnyStateDead =
+{
+    bunnyDeadAnimation,
+    StateIdDead //  Loop
+};
+
+constexpr DecorateStatePair bunnyStates[] =
+{
+    std::make_pair(StateIdHidden, bunnyStateHidden),
+    std::make_pair(StateIdRise, bunnyStateRise),
+    std::make_pair(StateIdWalk, bunnyStateWalk),
+    std::make_pair(StateIdAttack, bunnyStateAttack),
+    std::make_pair(StateIdPain, bunnyStatePain),
+    std::make_pair(StateIdDying, bunnyStateDying),
+    std::make_pair(StateIdDead, bunnyStateDead)
+};
+
+constexpr DecorateActor decorateBunny =
+{
+    actorIdMonsterBunny,   // Id
+    51, // spawnOnAllDifficulties;
+    51, // spawnOnNormalAndHard;
+    51, // spawnOnHard;
+    10,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Always,  // radarVisibility;
+    EgaLightGray,   // radarColor;
+    bunnyStates,
+    StateIdHidden,   // initialState;
+    4,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    1947,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+//
+// BAT
+//
+
+constexpr DecorateAnimationFrame batWalkAnimation[] =
+{
+    { BAT1PIC, 6, ActionNone },
+    { BAT2PIC, 6, ActionChase },
+    { BAT3PIC, 6, ActionChase },
+    { BAT4PIC, 6, ActionChase }
+};
+
+constexpr DecorateState batStateWalk =
+{
+    batWalkAnimation,
+    StateIdWalk // Loop
+};
+
+constexpr DecorateAnimationFrame batAttackAnimation[] =
+{
+    { BAT4PIC, 5, ActionAttack },
+    { BAT4PIC, 75, ActionRunAway }
+};
+
+constexpr DecorateState batStateAttack =
+{
+    batAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame batDyingAnimation[] =
+{
+    { BATDIE1PIC, 18, ActionNone },
+    { BATDIE2PIC, 18, ActionNone },
+    { NULL, 18, ActionRemove }
+};
+
+constexpr DecorateState batStateDying =
+{
+    batDyingAnimation,
+    StateIdDying  // Will not loop, due to the ActionRemove.
+};
+
+constexpr DecorateStatePair batStates[] =
+{
+    std::make_pair(StateIdWalk, batStateWalk),
+    std::make_pair(StateIdAttack, batStateAttack),
+    std::make_pair(StateIdDying, batStateDying)
+};
+
+constexpr DecorateActor decorateBat =
+{
+    actorIdMonsterBat,   // Id
+    25, // spawnOnAllDifficulties;
+    25, // spawnOnNormalAndHard;
+    25,  // spawnOnHard; Actually, should include 20 and 24 as well.
+    1,  // initialHealth;
+    35 * pixelRadius,    // size;
+    Always,  // radarVisibility;
+    EgaDarkGray,   // radarColor;
+    batStates,
+    StateIdWalk,   // initialState;
+    4,  // meleeDamage;
+    SHOOTMONSTERSND, // hitSound;
+    2000,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+// Validate all actor definitions at compile time
+static_assert(DecorateIsValid(decorateTomb1, actorIdTomb1), "decorateTomb1 is not valid");
+static_assert(DecorateIsValid(decorateTomb2, actorIdTomb2), "decorateTomb2 is not valid");
+static_assert(DecorateIsValid(decorateTomb3, actorIdTomb3), "decorateTomb3 is not valid");
+static_assert(DecorateIsValid(decorateColumn, actorIdColumn), "decorateColumn is not valid");
+static_assert(DecorateIsValid(decorateSulphurGas, actorIdSulphurGas), "decorateSulphurGas is not valid");
+static_assert(DecorateIsValid(decorateFirePot, actorIdFirePot), "decorateFirePot is not valid");
+static_assert(DecorateIsValid(decorateFountain, actorIdFountain), "decorateFountain is not valid");
+static_assert(DecorateIsValid(decoratePlayer, actorIdPlayer), "decoratePlayer is not valid");
+static_assert(DecorateIsValid(decorateExplosion, actorIdBonusExplosion), "decorateExplosion is not valid");
+static_assert(DecorateIsValid(decorateBolt, actorIdBonusBolt), "decorateBolt is not valid");
+static_assert(DecorateIsValid(decorateNuke, actorIdBonusNuke), "decorateNuke is not valid");
+static_assert(DecorateIsValid(decoratePotion, actorIdBonusPotion), "decoratePotion is not valid");
+static_assert(DecorateIsValid(decorateChest, actorIdBonusChest), "decorateChest is not valid");
+static_assert(DecorateIsValid(decorateWaterChest, actorIdBonusWaterChest), "decorateWaterChest is not valid");
+static_assert(DecorateIsValid(decorateFreezeTime, actorIdBonusFreezeTime), "decorateFreezeTime is not valid");
+static_assert(DecorateIsValid(decorateKeyRed, actorIdBonusKeyRed), "decorateKeyRed is not valid");
+static_assert(DecorateIsValid(decorateKeyYellow, actorIdBonusKeyYellow), "decorateKeyYellow is not valid");
+static_assert(DecorateIsValid(decorateKeyGreen, actorIdBonusKeyGreen), "decorateKeyGreen is not valid");
+static_assert(DecorateIsValid(decorateKeyBlue, actorIdBonusKeyBlue), "decorateKeyBlue is not valid");
+static_assert(DecorateIsValid(decorateGemRed, actorIdBonusGemRed), "decorateGemRed is not valid");
+static_assert(DecorateIsValid(decorateGemYellow, actorIdBonusGemYellow), "decorateGemYellow is not valid");
+static_assert(DecorateIsValid(decorateGemGreen, actorIdBonusGemGreen), "decorateGemGreen is not valid");
+static_assert(DecorateIsValid(decorateGemBlue, actorIdBonusGemBlue), "decorateGemBlue is not valid");
+static_assert(DecorateIsValid(decorateGemPurple, actorIdBonusGemPurple), "decorateGemPurple is not valid");
+static_assert(DecorateIsValid(decorateZombie, actorIdMonsterZombie), "decorateZombie is not valid");
+static_assert(DecorateIsValid(decorateTree, actorIdMonsterTree), "decorateTree is not valid");
+static_assert(DecorateIsValid(decorateBunny, actorIdMonsterBunny), "decorateBunny is not valid");
+static_assert(DecorateIsValid(decorateBat, actorIdMonsterBat), "decorateBat is not valid");
+static_assert(DecorateIsValid(decoratePlayerShot, actorIdProjectilePlayerShot), "decoratePlayerShot is not valid");
+static_assert(DecorateIsValid(decoratePlayerBigShot, actorIdProjectilePlayerBigShot), "decoratePlayerBigShot is not valid");
+static_assert(DecorateIsValid(decorateNemesisShot, actorIdProjectileNemesisShot), "decorateNemesisShot is not valid");
+
+const std::map<uint16_t, const DecorateActor> decorateArmageddonAll =
+{
+    std::make_pair(actorIdTomb1, decorateTomb1),
+    std::make_pair(actorIdTomb2, decorateTomb2),
+    std::make_pair(actorIdTomb3, decorateTomb3),
+    std::make_pair(actorIdColumn, decorateColumn),
+    std::make_pair(actorIdSulphurGas, decorateSulphurGas),
+    std::make_pair(actorIdFirePot, decorateFirePot),
+    std::make_pair(actorIdFountain, decorateFountain),
+    std::make_pair(actorIdPlayer, decoratePlayer),
+    std::make_pair(actorIdBonusExplosion, decorateExplosion),
+    std::make_pair(actorIdBonusBolt, decorateBolt),
+    std::make_pair(actorIdBonusNuke, decorateNuke),
+    std::make_pair(actorIdBonusPotion, decoratePotion),
+    std::make_pair(actorIdBonusChest, decorateChest),
+    std::make_pair(actorIdBonusWaterChest, decorateWaterChest),
+    std::make_pair(actorIdBonusFreezeTime, decorateFreezeTime),
+    std::make_pair(actorIdBonusKeyRed, decorateKeyRed),
+    std::make_pair(actorIdBonusKeyYellow, decorateKeyYellow),
+    std::make_pair(actorIdBonusKeyGreen, decorateKeyGreen),
+    std::make_pair(actorIdBonusKeyBlue, decorateKeyBlue),
+    std::make_pair(actorIdBonusGemRed, decorateGemRed),
+    std::make_pair(actorIdBonusGemYellow, decorateGemYellow),
+    std::make_pair(actorIdBonusGemGreen, decorateGemGreen),
+    std::make_pair(actorIdBonusGemBlue, decorateGemBlue),
+    std::make_pair(actorIdBonusGemPurple, decorateGemPurple),
+    std::make_pair(actorIdMonsterZombie, decorateZombie),
+    std::make_pair(actorIdMonsterTree, decorateTree),
+    std::make_pair(actorIdMonsterBunny, decorateBunny),
+    std::make_pair(actorIdMonsterBat, decorateBat),
+    std::make_pair(actorIdProjectilePlayerShot, decoratePlayerShot),
+    std::make_pair(actorIdProjectilePlayerBigShot, decoratePlayerBigShot),
+    std::make_pair(actorIdProjectileNemesisShot, decorateNemesisShot)
+};
+
+}
@@ -20,10 +20,13 @@
 //
 #pragma once
 
-#include "..\Engine\Decorate.h"
+#include "../Engine/Decorate.h"
 #include "EgaGraphArmageddon.h"
 #include "AudioRepositoryArmageddon.h"
 
+namespace Armageddon
+{
+
 const uint16_t actorIdBonusExplosion = 20;
 const uint16_t actorIdBonusBolt = 21;
 const uint16_t actorIdBonusNuke = 22;
@@ -41,774 +44,21 @@ const uint16_t actorIdBonusGemGreen = 42;
 const uint16_t actorIdBonusGemBlue = 43;
 const uint16_t actorIdBonusGemPurple = 44;
 
-//
-// BONUS ITEM DESTROYED
-//
-
-const DecorateAnimation bonusDyingAnimation =
-{
-    { PSHOT_EXP1PIC, 7, ActionItemDestroyed },
-    { PSHOT_EXP2PIC , 7, ActionNone },
-    { PSHOT_EXP3PIC , 7, ActionNone },
-    { 0 , 7, ActionRemove },
-};
-const DecorateState bonusStateDying =
-{
-    bonusDyingAnimation,
-    StateIdDying   // Loop
-};
-
-//
-// EXPLOSION
-//
-
-const DecorateAnimation explosionHiddenAnimation =
-{
-    { 0 , 2, ActionExplosionDelay }
-};
-
-const DecorateState explosionStateHidden =
-{
-    explosionHiddenAnimation,
-    StateIdHidden   // Loop
-};
-
-const DecorateAnimation explosionDyingAnimation =
-{
-    { PSHOT_EXP1PIC , 7, ActionNone },
-    { PSHOT_EXP2PIC , 7, ActionNone },
-    { PSHOT_EXP3PIC , 7, ActionNone },
-    { 0 , 7, ActionRemove },
-};
-
-const DecorateState explosionStateDying =
-{
-    explosionDyingAnimation,
-    StateIdDying   // Loop
-};
-
-const std::map<DecorateStateId, DecorateState> explosionStates =
-{
-    std::make_pair(StateIdHidden, explosionStateHidden),
-    std::make_pair(StateIdDying, explosionStateDying)
-};
-
-const DecorateActor decorateExplosion =
-{
-    actorIdBonusExplosion,   // Id
-    0, // spawnOnAllDifficulties;
-    0, // spawnOnNormalAndHard;
-    0,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    explosionStates,
-    StateIdHidden,   // initialState;
-    0,  // meleeDamage;
-    0, // hitSound;
-    0,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// BOLT
-//
-
-const DecorateAnimation boltWaitForPickupAnimation =
-{
-    { BOLTOBJPIC, 8, ActionWaitForPickup },
-    { BOLT2OBJPIC, 8, ActionWaitForPickup },
-    { BOLT3OBJPIC, 8, ActionWaitForPickup },
-};
-
-const DecorateState boltWaitForPickup =
-{
-    boltWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const DecorateAnimation boltPickupAnimation =
-{
-    { 0, 6, ActionGiveBolt },
-    { 0, 6, ActionRemove }
-};
-
-const DecorateState boltPickup =
-{
-    boltPickupAnimation,
-    StateIdPickup
-};
-
-const std::map<DecorateStateId, DecorateState> boltStates =
-{
-    std::make_pair(StateIdWaitForPickup, boltWaitForPickup),
-    std::make_pair(StateIdPickup, boltPickup),
-    std::make_pair(StateIdDying, bonusStateDying)
-};
-
-const DecorateActor decorateBolt =
-{
-    actorIdBonusBolt,   // Id
-    5, // spawnOnAllDifficulties;
-    5, // spawnOnNormalAndHard;
-    5,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    boltStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    BOOMSND, // hitSound;
-    0,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// NUKE
-//
-
-const DecorateAnimation nukeWaitForPickupAnimation =
-{
-    { NUKEOBJPIC, 8, ActionWaitForPickup },
-    { NUKE2OBJPIC, 8, ActionWaitForPickup },
-    { NUKE3OBJPIC, 8, ActionWaitForPickup },
-};
-
-const DecorateState nukeWaitForPickup =
-{
-    nukeWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const DecorateAnimation nukePickupAnimation =
-{
-    { 0, 6, ActionGiveNuke },
-    { 0, 6, ActionRemove }
-};
-
-const DecorateState nukePickup =
-{
-    nukePickupAnimation,
-    StateIdPickup
-};
-
-const std::map<DecorateStateId, DecorateState> nukeStates =
-{
-    std::make_pair(StateIdWaitForPickup, nukeWaitForPickup),
-    std::make_pair(StateIdPickup, nukePickup),
-    std::make_pair(StateIdDying, bonusStateDying)
-};
-
-const DecorateActor decorateNuke =
-{
-    actorIdBonusNuke,   // Id
-    6, // spawnOnAllDifficulties;
-    6, // spawnOnNormalAndHard;
-    6,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    nukeStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    BOOMSND, // hitSound;
-    0,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// POTION
-//
-
-const DecorateAnimation potionWaitForPickupAnimation =
-{
-    { POTIONOBJPIC, 8, ActionWaitForPickup }
-};
-
-const DecorateState potionWaitForPickup =
-{
-    potionWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const DecorateAnimation potionPickupAnimation =
-{
-    { 0, 6, ActionGivePotion },
-    { 0, 6, ActionRemove }
-};
-
-const DecorateState potionPickup =
-{
-    potionPickupAnimation,
-    StateIdPickup
-};
-
-const std::map<DecorateStateId, DecorateState> potionStates =
-{
-    std::make_pair(StateIdWaitForPickup, potionWaitForPickup),
-    std::make_pair(StateIdPickup, potionPickup),
-    std::make_pair(StateIdDying, bonusStateDying)
-};
-
-const DecorateActor decoratePotion =
-{
-    actorIdBonusPotion,   // Id
-    7, // spawnOnAllDifficulties;
-    7, // spawnOnNormalAndHard;
-    7,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    potionStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    BOOMSND, // hitSound;
-    0,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// CHEST
-//
-
-const DecorateAnimation chestWaitForPickupAnimation
-{
-    { CHESTOBJPIC, 8, ActionWaitForPickup }
-};
-
-const DecorateState chestWaitForPickup =
-{
-    chestWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const DecorateAnimation chestPickupAnimation =
-{
-    { 0, 6, ActionGiveChest },
-    { 0, 6, ActionRemove }
-};
-
-const DecorateState chestPickup =
-{
-    chestPickupAnimation,
-    StateIdPickup
-};
-
-const std::map<DecorateStateId, DecorateState> chestStates =
-{
-    std::make_pair(StateIdWaitForPickup, chestWaitForPickup),
-    std::make_pair(StateIdPickup, chestPickup),
-    std::make_pair(StateIdDying, bonusStateDying)
-};
-
-const DecorateActor decorateChest =
-{
-    actorIdBonusChest,   // Id
-    21, // spawnOnAllDifficulties;
-    21, // spawnOnNormalAndHard;
-    21,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    chestStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    BOOMSND, // hitSound;
-    0,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// WATER CHEST
-//
-
-const DecorateAnimation waterChestWaitForPickupAnimation =
-{
-    { O_WATER_CHEST1PIC, 8, ActionWaitForPickup },
-    { O_WATER_CHEST2PIC, 8, ActionWaitForPickup }
-};
-
-const DecorateState waterChestWaitForPickup =
-{
-    waterChestWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const std::map<DecorateStateId, DecorateState> waterChestStates =
-{
-    std::make_pair(StateIdWaitForPickup, waterChestWaitForPickup),
-    std::make_pair(StateIdPickup, chestPickup),
-    std::make_pair(StateIdDying, bonusStateDying)
-};
-
-const DecorateActor decorateWaterChest =
-{
-    actorIdBonusWaterChest,   // Id
-    21, // spawnOnAllDifficulties;
-    21, // spawnOnNormalAndHard;
-    21,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    waterChestStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    BOOMSND, // hitSound;
-    0,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// FREEZE TIME
-//
-
-const DecorateAnimation freezeTimeWaitForPickupAnimation =
-{
-    { TIMEOBJ1PIC, 6, ActionWaitForPickup },
-    { TIMEOBJ2PIC, 6, ActionWaitForPickup }
-};
-
-const DecorateState freezeTimeWaitForPickup =
-{
-    freezeTimeWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const DecorateAnimation freezeTimePickupAnimation =
-{
-    { 0, 6, ActionFreezeTime },
-    { 0, 6, ActionRemove }
-};
-
-const DecorateState freezeTimePickup =
-{
-    freezeTimePickupAnimation,
-    StateIdPickup
-};
-
-const std::map<DecorateStateId, DecorateState> freezeTimeStates =
-{
-    std::make_pair(StateIdWaitForPickup, freezeTimeWaitForPickup),
-    std::make_pair(StateIdPickup, freezeTimePickup),
-};
-
-const DecorateActor decorateFreezeTime =
-{
-    actorIdBonusFreezeTime,   // Id
-    57, // spawnOnAllDifficulties;
-    57, // spawnOnNormalAndHard;
-    57,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    freezeTimeStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    BOOMSND, // hitSound;
-    0,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// KEY RED
-//
-
-const DecorateAnimation keyRedWaitForPickupAnimation =
-{
-    { RKEYOBJPIC, 6, ActionWaitForPickup }
-};
-
-const DecorateState keyRedWaitForPickup =
-{
-    keyRedWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const DecorateAnimation keyPickupAnimation =
-{
-    { 0, 6, ActionGiveKey },
-    { 0, 6, ActionRemove }
-};
-
-const DecorateState keyPickup =
-{
-    keyPickupAnimation,
-    StateIdPickup
-};
-
-const std::map<DecorateStateId, DecorateState> keyRedStates =
-{
-    std::make_pair(StateIdWaitForPickup, keyRedWaitForPickup),
-    std::make_pair(StateIdPickup, keyPickup),
-};
-
-const DecorateActor decorateKeyRed =
-{
-    actorIdBonusKeyRed,   // Id
-    8, // spawnOnAllDifficulties;
-    8, // spawnOnNormalAndHard;
-    8,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    keyRedStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    0, // hitSound;
-    0,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// KEY YELLOW
-//
-
-const DecorateAnimation keyYellowWaitForPickupAnimation =
-{
-    { YKEYOBJPIC, 6, ActionWaitForPickup }
-};
-
-const DecorateState keyYellowWaitForPickup =
-{
-    keyYellowWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const std::map<DecorateStateId, DecorateState> keyYellowStates =
-{
-    std::make_pair(StateIdWaitForPickup, keyYellowWaitForPickup),
-    std::make_pair(StateIdPickup, keyPickup),
-};
-
-const DecorateActor decorateKeyYellow =
-{
-    actorIdBonusKeyYellow,   // Id
-    9, // spawnOnAllDifficulties;
-    9, // spawnOnNormalAndHard;
-    9,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    keyYellowStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    0, // hitSound;
-    0,    // speed;
-    1, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// KEY GREEN
-//
-
-const DecorateAnimation keyGreenWaitForPickupAnimation =
-{
-    { GKEYOBJPIC, 6, ActionWaitForPickup }
-};
-
-const DecorateState keyGreenWaitForPickup =
-{
-    keyGreenWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const std::map<DecorateStateId, DecorateState> keyGreenStates =
-{
-    std::make_pair(StateIdWaitForPickup, keyGreenWaitForPickup),
-    std::make_pair(StateIdPickup, keyPickup),
-};
-
-const DecorateActor decorateKeyGreen =
-{
-    actorIdBonusKeyGreen,   // Id
-    10, // spawnOnAllDifficulties;
-    10, // spawnOnNormalAndHard;
-    10,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    keyGreenStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    0, // hitSound;
-    0,    // speed;
-    2, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// KEY BLUE
-//
-
-const DecorateAnimation keyBlueWaitForPickupAnimation =
-{
-    { BKEYOBJPIC, 6, ActionWaitForPickup }
-};
-
-const DecorateState keyBlueWaitForPickup =
-{
-    keyBlueWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const std::map<DecorateStateId, DecorateState> keyBlueStates =
-{
-    std::make_pair(StateIdWaitForPickup, keyBlueWaitForPickup),
-    std::make_pair(StateIdPickup, keyPickup),
-};
-
-const DecorateActor decorateKeyBlue =
-{
-    actorIdBonusKeyBlue,   // Id
-    11, // spawnOnAllDifficulties;
-    11, // spawnOnNormalAndHard;
-    11,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    keyBlueStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    0, // hitSound;
-    0,    // speed;
-    3, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// GEM RED
-//
-
-const DecorateAnimation gemRedWaitForPickupAnimation =
-{
-    { RGEM1PIC, 30, ActionWaitForPickup },
-    { RGEM2PIC, 30, ActionWaitForPickup }
-};
-
-const DecorateState gemRedWaitForPickup =
-{
-    gemRedWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const DecorateAnimation gemPickupAnimation =
-{
-    { 0, 6, ActionGiveGem },
-    { 0, 6, ActionRemove }
-};
-
-const DecorateState gemPickup =
-{
-    gemPickupAnimation,
-    StateIdPickup
-};
-
-const std::map<DecorateStateId, DecorateState>gemRedStates =
-{
-    std::make_pair(StateIdWaitForPickup, gemRedWaitForPickup),
-    std::make_pair(StateIdPickup, gemPickup),
-};
-
-const DecorateActor decorateGemRed =
-{
-    actorIdBonusGemRed,   // Id
-    58, // spawnOnAllDifficulties;
-    58, // spawnOnNormalAndHard;
-    58,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    gemRedStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    0, // hitSound;
-    0,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// GEM YELLOW
-//
-
-const DecorateAnimation gemYellowWaitForPickupAnimation =
-{
-    { YGEM1PIC, 30, ActionWaitForPickup },
-    { YGEM2PIC, 30, ActionWaitForPickup }
-};
-
-const DecorateState gemYellowWaitForPickup =
-{
-    gemYellowWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const std::map<DecorateStateId, DecorateState>gemYellowStates =
-{
-    std::make_pair(StateIdWaitForPickup, gemYellowWaitForPickup),
-    std::make_pair(StateIdPickup, gemPickup),
-};
-
-const DecorateActor decorateGemYellow =
-{
-    actorIdBonusGemYellow,   // Id
-    59, // spawnOnAllDifficulties;
-    59, // spawnOnNormalAndHard;
-    59,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    gemYellowStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    0, // hitSound;
-    0,    // speed;
-    3, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// GEM GREEN
-//
-
-const DecorateAnimation gemGreenWaitForPickupAnimation =
-{
-    { GGEM1PIC, 30, ActionWaitForPickup },
-    { GGEM2PIC, 30, ActionWaitForPickup }
-};
-
-const DecorateState gemGreenWaitForPickup =
-{
-    gemGreenWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const std::map<DecorateStateId, DecorateState>gemGreenStates =
-{
-    std::make_pair(StateIdWaitForPickup, gemGreenWaitForPickup),
-    std::make_pair(StateIdPickup, gemPickup),
-};
-
-const DecorateActor decorateGemGreen =
-{
-    actorIdBonusGemGreen,   // Id
-    60, // spawnOnAllDifficulties;
-    60, // spawnOnNormalAndHard;
-    60,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    gemGreenStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    0, // hitSound;
-    0,    // speed;
-    1, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// GEM BLUE
-//
-
-const DecorateAnimation gemBlueWaitForPickupAnimation =
-{
-    { BGEM1PIC, 30, ActionWaitForPickup },
-    { BGEM2PIC, 30, ActionWaitForPickup }
-};
-
-const DecorateState gemBlueWaitForPickup =
-{
-    gemBlueWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const std::map<DecorateStateId, DecorateState>gemBlueStates =
-{
-    std::make_pair(StateIdWaitForPickup, gemBlueWaitForPickup),
-    std::make_pair(StateIdPickup, gemPickup),
-};
-
-const DecorateActor decorateGemBlue =
-{
-    actorIdBonusGemBlue,   // Id
-    61, // spawnOnAllDifficulties;
-    61, // spawnOnNormalAndHard;
-    61,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    gemBlueStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    0, // hitSound;
-    0,    // speed;
-    2, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// GEM PURPLE
-//
-
-const DecorateAnimation gemPurpleWaitForPickupAnimation =
-{
-    { PGEM1PIC, 30, ActionWaitForPickup },
-    { PGEM2PIC, 30, ActionWaitForPickup }
-};
-
-const DecorateState gemPurpleWaitForPickup =
-{
-    gemPurpleWaitForPickupAnimation,
-    StateIdWaitForPickup
-};
-
-const std::map<DecorateStateId, DecorateState>gemPurpleStates =
-{
-    std::make_pair(StateIdWaitForPickup, gemPurpleWaitForPickup),
-    std::make_pair(StateIdPickup, gemPickup),
-};
-
-const DecorateActor decorateGemPurple =
-{
-    actorIdBonusGemPurple,   // Id
-    62, // spawnOnAllDifficulties;
-    62, // spawnOnNormalAndHard;
-    62,  // spawnOnHard
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    gemPurpleStates,
-    StateIdWaitForPickup,   // initialState;
-    0,  // meleeDamage;
-    0, // hitSound;
-    0,    // speed;
-    4, // actionParameter
-    0 // ProjectileId
-};
-
+extern const DecorateActor decorateExplosion;
+extern const DecorateActor decorateBolt;
+extern const DecorateActor decorateNuke;
+extern const DecorateActor decoratePotion;
+extern const DecorateActor decorateChest;
+extern const DecorateActor decorateWaterChest;
+extern const DecorateActor decorateFreezeTime;
+extern const DecorateActor decorateKeyRed;
+extern const DecorateActor decorateKeyYellow;
+extern const DecorateActor decorateKeyGreen;
+extern const DecorateActor decorateKeyBlue;
+extern const DecorateActor decorateGemRed;
+extern const DecorateActor decorateGemYellow;
+extern const DecorateActor decorateGemGreen;
+extern const DecorateActor decorateGemBlue;
+extern const DecorateActor decorateGemPurple;
+
+}
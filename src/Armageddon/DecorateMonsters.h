@@ -20,436 +20,22 @@
 //
 #pragma once
 
-#include "..\Engine\Decorate.h"
+#include "../Engine/Decorate.h"
 #include "DecorateProjectiles.h"
 #include "EgaGraphArmageddon.h"
 #include "AudioRepositoryArmageddon.h"
 
+namespace Armageddon
+{
+
 const uint16_t actorIdMonsterZombie = 50;
 const uint16_t actorIdMonsterTree = 53;
 const uint16_t actorIdMonsterBunny = 54;
 const uint16_t actorIdMonsterBat = 58;
 
-//
-// ZOMBIE
-//
-
-const DecorateAnimation zombieHiddenAnimation =
-{
-    { 0 , 13, ActionHide }
-};
-
-const DecorateState zombieStateHidden =
-{
-    zombieHiddenAnimation,
-    StateIdHidden   // Loop
-};
-
-const DecorateAnimation zombieRiseAnimation =
-{
-    { ZOMB_APPEAR1PIC, 24, ActionNone },
-    { ZOMB_APPEAR2PIC, 24, ActionNone },
-    { ZOMB_APPEAR3PIC, 24, ActionNone },
-    { ZOMB_APPEAR4PIC, 24, ActionNone },
-    { ZOMB_WALK3PIC, 1, ActionNone }
-};
-
-const DecorateState zombieStateRise =
-{
-    zombieRiseAnimation,
-    StateIdWalk
-};
-
-const DecorateAnimation zombieWalkAnimation =
-{
-    { ZOMB_WALK1PIC, 13, ActionChase },
-    { ZOMB_WALK2PIC, 13, ActionChase },
-    { ZOMB_WALK3PIC, 13, ActionChase }
-};
-
-const DecorateState zombieStateWalk =
-{
-    zombieWalkAnimation,
-    StateIdWalk // Loop
-};
-
-const DecorateAnimation zombieAttackAnimation =
-{
-    { ZOMB_ATTACKPIC, 15, ActionAttack },
-    { ZOMB_WALK1PIC, 20, ActionNone }
-};
-
-const DecorateState zombieStateAttack =
-{
-    zombieAttackAnimation,
-    StateIdWalk
-};
-
-const DecorateAnimation zombiePainAnimation =
-{
-    { ZOMB_OUCHPIC, 15, ActionNone }
-};
-
-const DecorateState zombieStatePain =
-{
-    zombiePainAnimation,
-    StateIdWalk
-};
-
-const DecorateAnimation zombieDyingAnimation =
-{
-    { ZOMB_DIE1PIC, 16, ActionNone },
-    { ZOMB_DIE2PIC, 16, ActionNone },
-    { ZOMB_DIE3PIC, 16, ActionNone }
-};
-
-const DecorateState zombieStateDying =
-{
-    zombieDyingAnimation,
-    StateIdDead
-};
-
-const DecorateAnimation zombieDeadAnimation =
-{
-    { ZOMB_DIE3PIC, 16, ActionNone }
-};
-
-const DecorateState zombieStateDead =
-{
-    zombieDeadAnimation,
-    StateIdDead //  Loop
-};
-
-const std::map<DecorateStateId, DecorateState> zombieStates =
-{
-    std::make_pair(StateIdHidden, zombieStateHidden),
-    std::make_pair(StateIdRise, zombieStateRise),
-    std::make_pair(StateIdWalk, zombieStateWalk),
-    std::make_pair(StateIdAttack, zombieStateAttack),
-    std::make_pair(StateIdPain, zombieStatePain),
-    std::make_pair(StateIdDying, zombieStateDying),
-    std::make_pair(StateIdDead, zombieStateDead)
-};
-
-const DecorateActor decorateZombie =
-{
-    actorIdMonsterZombie,   // Id
-    36, // spawnOnAllDifficulties;
-    36, // spawnOnNormalAndHard;
-    36, // spawnOnHard;
-    5,  // initialHealth;
-    35 * pixelRadius,    // size;
-    WithPurpleGem,  // radarVisibility;
-    EgaBrightMagenta,   // radarColor;
-    zombieStates,
-    StateIdHidden,   // initialState;
-    8,  // meleeDamage;
-    SHOOTMONSTERSND, // hitSound;
-    2500,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// TREE
-//
-
-const DecorateAnimation treeHiddenAnimation =
-{
-    { TREE_IDLEPIC , 13, ActionHide }
-};
-
-const DecorateState treeStateHidden =
-{
-    treeHiddenAnimation,
-    StateIdHidden   // Loop
-};
-
-const DecorateAnimation treeRiseAnimation =
-{
-    { TREE_AWAKENINGPIC, 50, ActionNone }
-};
-
-const DecorateState treeStateRise =
-{
-    treeRiseAnimation,
-    StateIdWalk
-};
-
-const DecorateAnimation treeWalkAnimation =
-{
-    { TREE_WALK1PIC, 13, ActionChase },
-    { TREE_WALK2PIC, 13, ActionChase }
-};
-
-const DecorateState treeStateWalk =
-{
-    treeWalkAnimation,
-    StateIdWalk // Loop
-};
-
-const DecorateAnimation treeAttackAnimation =
-{
-    { TREE_ATTACK1PIC, 15, ActionAttack },
-    { TREE_ATTACK2PIC, 15, ActionAttack },
-    { TREE_ATTACK3PIC, 15, ActionNone }
-};
-
-const DecorateState treeStateAttack =
-{
-    treeAttackAnimation,
-    StateIdWalk
-};
-
-const DecorateAnimation treePainAnimation =
-{
-    { TREE_AWAKENINGPIC, 15, ActionNone }
-};
-
-const DecorateState treeStatePain =
-{
-    treePainAnimation,
-    StateIdWalk
-};
-
-const DecorateAnimation treeDyingAnimation =
-{
-    { TREE_DEATH1PIC, 45, ActionNone },
-    { TREE_DEATH2PIC, 25, ActionNone }
-};
-
-const DecorateState treeStateDying =
-{
-    treeDyingAnimation,
-    StateIdDead
-};
-
-const DecorateAnimation treeDeadAnimation =
-{
-    { TREE_DEATH1PIC, 15, ActionNone },
-    { TREE_DEATH2PIC, 15, ActionNone },
-    { TREE_DEATH3PIC, 15, ActionNone }
-};
-
-const DecorateState treeStateDead =
-{
-    treeDeadAnimation,
-    StateIdDead //  Loop
-};
-
-const std::map<DecorateStateId, DecorateState> treeStates =
-{
-    std::make_pair(StateIdHidden, treeStateHidden),
-    std::make_pair(StateIdRise, treeStateRise),
-    std::make_pair(StateIdWalk, treeStateWalk),
-    std::make_pair(StateIdAttack, treeStateAttack),
-    std::make_pair(StateIdPain, treeStatePain),
-    std::make_pair(StateIdDying, treeStateDying),
-    std::make_pair(StateIdDead, treeStateDead)
-};
-
-const DecorateActor decorateTree =
-{
-    actorIdMonsterTree,   // Id
-    50, // spawnOnAllDifficulties;
-    50, // spawnOnNormalAndHard;
-    50, // spawnOnHard;
-    12,  // initialHealth;
-    35 * pixelRadius,    // size;
-    WithYellowGem,  // radarVisibility;
-    EgaBrown,   // radarColor;
-    treeStates,
-    StateIdHidden,   // initialState;
-    7,  // meleeDamage;
-    SHOOTMONSTERSND, // hitSound;
-    2500,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// BUNNY
-//
-
-const DecorateAnimation bunnyHiddenAnimation =
-{
-    { BUNNY_LEFT1PIC , 10, ActionHide },
-    { BUNNY_LEFT2PIC , 30, ActionHide }
-};
-
-const DecorateState bunnyStateHidden =
-{
-    bunnyHiddenAnimation,
-    StateIdHidden   // Loop
-};
-
-const DecorateAnimation bunnyRiseAnimation =
-{
-    { BUNNY_META1PIC, 30, ActionNone },
-    { BUNNY_META2PIC, 30, ActionNone }
-};
-
-const DecorateState bunnyStateRise =
-{
-    bunnyRiseAnimation,
-    StateIdWalk
-};
-
-const DecorateAnimation bunnyWalkAnimation =
-{
-    { BUNNY_WALK1PIC, 25, ActionChase },
-    { BUNNY_WALK2PIC, 25, ActionChase }
-};
-
-const DecorateState bunnyStateWalk =
-{
-    bunnyWalkAnimation,
-    StateIdWalk // Loop
-};
-
-const DecorateAnimation bunnyAttackAnimation =
-{
-    { BUNNY_WALK1PIC, 25, ActionNone },
-    { BUNNY_WALK2PIC, 25, ActionAttack }
-};
-
-const DecorateState bunnyStateAttack =
-{
-    bunnyAttackAnimation,
-    StateIdWalk
-};
-
-const DecorateAnimation bunnyPainAnimation =
-{
-    { BUNNY_OUCHPIC, 30, ActionNone },
-    { BUNNY_WALK1PIC, 50, ActionNone }
-};
-
-const DecorateState bunnyStatePain =
-{
-    bunnyPainAnimation,
-    StateIdWalk
-};
-
-const DecorateAnimation bunnyDyingAnimation =
-{
-    { BUNNY_OUCHPIC, 40, ActionNone },
-    { BUNNY_DEATH1PIC, 50, ActionNone },
-    { BUNNY_DEATH2PIC, 20, ActionNone }
-};
-
-const DecorateState bunnyStateDying =
-{
-    bunnyDyingAnimation,
-    StateIdDead
-};
-
-const DecorateAnimation bunnyDeadAnimation =
-{
-    { BUNNY_DEATH2PIC, 20, ActionNone }
-};
-
-const DecorateState bunnyStateDead =
-{
-    bunnyDeadAnimation,
-    StateIdDead //  Loop
-};
-
-const std::map<DecorateStateId, DecorateState> bunnyStates =
-{
-    std::make_pair(StateIdHidden, bunnyStateHidden),
-    std::make_pair(StateIdRise, bunnyStateRise),
-    std::make_pair(StateIdWalk, bunnyStateWalk),
-    std::make_pair(StateIdAttack, bunnyStateAttack),
-    std::make_pair(StateIdPain, bunnyStatePain),
-    std::make_pair(StateIdDying, bunnyStateDying),
-    std::make_pair(StateIdDead, bunnyStateDead)
-};
-
-const DecorateActor decorateBunny =
-{
-    actorIdMonsterBunny,   // Id
-    51, // spawnOnAllDifficulties;
-    51, // spawnOnNormalAndHard;
-    51, // spawnOnHard;
-    10,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Always,  // radarVisibility;
-    EgaLightGray,   // radarColor;
-    bunnyStates,
-    StateIdHidden,   // initialState;
-    4,  // meleeDamage;
-    SHOOTMONSTERSND, // hitSound;
-    1947,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// BAT
-//
+extern const DecorateActor decorateZombie;
+extern const DecorateActor decorateTree;
+extern const DecorateActor decorateBunny;
+extern const DecorateActor decorateBat;
 
-const DecorateAnimation batWalkAnimation =
-{
-    { BAT1PIC, 6, ActionNone },
-    { BAT2PIC, 6, ActionChase },
-    { BAT3PIC, 6, ActionChase },
-    { BAT4PIC, 6, ActionChase }
-};
-
-const DecorateState batStateWalk =
-{
-    batWalkAnimation,
-    StateIdWalk // Loop
-};
-
-const DecorateAnimation batAttackAnimation =
-{
-    { BAT4PIC, 5, ActionAttack },
-    { BAT4PIC, 75, ActionRunAway }
-};
-
-const DecorateState batStateAttack =
-{
-    batAttackAnimation,
-    StateIdWalk
-};
-
-const DecorateAnimation batDyingAnimation =
-{
-    { BATDIE1PIC, 18, ActionNone },
-    { BATDIE2PIC, 18, ActionNone },
-    { NULL, 18, ActionRemove }
-};
-
-const DecorateState batStateDying =
-{
-    batDyingAnimation,
-    StateIdDying  // Will not loop, due to the ActionRemove.
-};
-
-const std::map<DecorateStateId, DecorateState> batStates =
-{
-    std::make_pair(StateIdWalk, batStateWalk),
-    std::make_pair(StateIdAttack, batStateAttack),
-    std::make_pair(StateIdDying, batStateDying)
-};
-
-const DecorateActor decorateBat =
-{
-    actorIdMonsterBat,   // Id
-    25, // spawnOnAllDifficulties;
-    25, // spawnOnNormalAndHard;
-    25,  // spawnOnHard; Actually, should include 20 and 24 as well.
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Always,  // radarVisibility;
-    EgaDarkGray,   // radarColor;
-    batStates,
-    StateIdWalk,   // initialState;
-    4,  // meleeDamage;
-    SHOOTMONSTERSND, // hitSound;
-    2000,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
+}
@@ -20,130 +20,19 @@
 //
 #pragma once
 
-#include "..\Engine\Decorate.h"
+#include "../Engine/Decorate.h"
 #include "EgaGraphArmageddon.h"
 #include "AudioRepositoryArmageddon.h"
 
+namespace Armageddon
+{
+
 const uint16_t actorIdProjectilePlayerShot = 70;
 const uint16_t actorIdProjectilePlayerBigShot = 71;
 const uint16_t actorIdProjectileNemesisShot = 74;
 
-//
-// PLAYER SHOT
-//
-
-const DecorateAnimation playerShotFlyAnimation =
-{
-    { PSHOT1PIC , 8, ActionPlayerProjectile },
-    { PSHOT2PIC , 8, ActionPlayerProjectile }
-};
-
-const DecorateState playerShotStateFly = 
-{
-    playerShotFlyAnimation,
-    StateIdProjectileFly   // Loop
-};
-
-const DecorateAnimation playerShotDyingAnimation =
-{
-    { PSHOT_EXP1PIC , 7, ActionNone },
-    { PSHOT_EXP2PIC , 7, ActionNone },
-    { PSHOT_EXP3PIC , 7, ActionNone },
-    { 0 , 7, ActionRemove },
-};
-
-const DecorateState playerShotStateDying = 
-{
-    playerShotDyingAnimation,
-    StateIdDying   // Loop
-};
-
-const std::map<DecorateStateId, DecorateState> playerShotStates =
-{
-    std::make_pair(StateIdProjectileFly, playerShotStateFly),
-    std::make_pair(StateIdDying, playerShotStateDying)
-};
-
-const DecorateActor decoratePlayerShot =
-{
-    actorIdProjectilePlayerShot,   // Id
-    0, // spawnOnAllDifficulties;
-    0, // spawnOnNormalAndHard;
-    0,  // spawnOnHard;
-    1,  // initialHealth;
-    7 * pixelRadius,    // size;
-    Flickering,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    playerShotStates,
-    StateIdProjectileFly,   // initialState;
-    1,  // damage;
-    0, // hitSound;
-    10000,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// PLAYER BIG SHOT
-// Fired by the nuke / X-terminator
-//
-
-const DecorateActor decoratePlayerBigShot =
-{
-    actorIdProjectilePlayerBigShot,   // Id
-    0, // spawnOnAllDifficulties;
-    0, // spawnOnNormalAndHard;
-    0,  // spawnOnHard;
-    1,  // initialHealth;
-    24 * pixelRadius,    // size;
-    Flickering,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    playerShotStates,
-    StateIdProjectileFly,   // initialState;
-    3,  // damage;
-    0, // hitSound;
-    10000,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
-
-//
-// NEMESIS SHOT (FLAMING SKULL)
-//
-
-const DecorateAnimation nemesisShotFlyAnimation =
-{
-    { SKULL_SHOTPIC , 8, ActionMonsterProjectile }
-};
-
-const DecorateState nemesisShotStateFly = 
-{
-    nemesisShotFlyAnimation,
-    StateIdProjectileFly   // Loop
-};
-
-const std::map<DecorateStateId, DecorateState> nemesisShotStates =
-{
-    std::make_pair(StateIdProjectileFly, nemesisShotStateFly),
-    std::make_pair(StateIdDying, playerShotStateDying)
-};
-
-const DecorateActor decorateNemesisShot =
-{
-    actorIdProjectileNemesisShot,   // Id
-    0, // spawnOnAllDifficulties;
-    0, // spawnOnNormalAndHard;
-    0,  // spawnOnHard;
-    1,  // initialHealth;
-    35 * pixelRadius,    // size;
-    Never,  // radarVisibility;
-    EgaBrightWhite,   // radarColor;
-    nemesisShotStates,
-    StateIdProjectileFly,   // initialState;
-    25,  // damage;
-    0, // hitSound;
-    10000,    // speed;
-    0, // actionParameter
-    0 // ProjectileId
-};
+extern const DecorateActor decoratePlayerShot;
+extern const DecorateActor decoratePlayerBigShot;
+extern const DecorateActor decorateNemesisShot;
 
+}
@@ -20,7 +20,7 @@
 //
 #pragma once
 
-#include "..\Engine\EgaGraph.h"
+#include "../Engine/EgaGraph.h"
 
 const huffmanTable egaDictionaryArmageddon =
 {
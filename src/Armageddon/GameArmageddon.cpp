@@ -19,7 +19,9 @@
 #include "IntroViewArmageddon.h"
 #include "AudioRepositoryArmageddon.h"
 #include "DecorateAll.h"
-#include "..\Engine\IRenderer.h"
+#include "../Engine/IRenderer.h"
+
+using namespace Armageddon;
 
 static const std::string ArmageddonName = "Catacomb Armageddon v1.02";
 
@@ -60,9 +62,8 @@ GameArmageddon::~GameArmageddon()
     }
 }
 
-void GameArmageddon::SpawnActors(Level* level, const DifficultyLevel difficultyLevel)
+void GameArmageddon::SpawnActors(Level* level, const DifficultyLevel difficultyLevel, Random& random)
 {
-    Actor** actors = level->GetBlockingActors();
     Actor* const playerState = level->GetPlayerActor();
 
     for (uint16_t y = 0; y < level->GetLevelHeight(); y++)
@@ -85,38 +86,38 @@ void GameArmageddon::SpawnActors(Level* level, const DifficultyLevel difficultyL
             case 5:
             {
                 Actor* bonusActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateBolt);
-                actors[(y * level->GetLevelWidth()) + x] = bonusActor;
+                level->SetBlockingActor(x, y, bonusActor);
                 break;
             }
             case 6:
             {
                 Actor* bonusActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateNuke);
-                actors[(y * level->GetLevelWidth()) + x] = bonusActor;
+                level->SetBlockingActor(x, y, bonusActor);
                 break;
             }
             case 7:
 
             {
                 Actor* bonusActor = new Actor(x + 0.5f, y + 0.5f, 0, decoratePotion);
-                actors[(y * level->GetLevelWidth()) + x] = bonusActor;
+                level->SetBlockingActor(x, y, bonusActor);
                 break;
             }
             case 8:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyRed);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyRed));
                 break;
             case 9:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyYellow);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyYellow));
                 break;
             case 10:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyGreen);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyGreen));
                 break;
             case 11:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyBlue);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateKeyBlue));
                 break;
             case 25:
             {
                 Actor* batActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateBat);
-                actors[(y * level->GetLevelWidth()) + x] = batActor;
+                level->SetBlockingActor(x, y, batActor);
                 break;
             }
             case 36:
@@ -127,7 +128,7 @@ void GameArmageddon::SpawnActors(Level* level, const DifficultyLevel difficultyL
                     zombie_delay = (tile >> 8) * 30;
                 else
                 {
-                    const int16_t current_zombie_delay = (2 * 60) + rand() % (4 * 60);
+                    const int16_t current_zombie_delay = (2 * 60) + random.Next(4 * 60);
                     zombie_delay = m_zombie_base_delay + current_zombie_delay;
                     m_zombie_base_delay += current_zombie_delay;
                     if (m_zombie_base_delay > 8 * 60)
@@ -135,43 +136,43 @@ void GameArmageddon::SpawnActors(Level* level, const DifficultyLevel difficultyL
                 }
                 Actor* zombieActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateZombie);
                 zombieActor->SetTemp2(zombie_delay);
-                actors[(y * level->GetLevelWidth()) + x] = zombieActor;
+                level->SetBlockingActor(x, y, zombieActor);
                 break;
             }
             case 39:
             {
                 Actor* freezeTimeActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateFreezeTime);
-                actors[(y * level->GetLevelWidth()) + x] = freezeTimeActor;
+                level->SetBlockingActor(x, y, freezeTimeActor);
                 break;
             }
             case 40:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateGemRed);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateGemRed));
                 break;
             case 41:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateGemGreen);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateGemGreen));
                 break;
             case 42:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateGemBlue);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateGemBlue));
                 break;
             case 43:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateGemYellow);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateGemYellow));
                 break;
             case 44:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateGemPurple);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateGemPurple));
                 break;
             case 45:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb1);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb1));
                 break;
             case 46:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb2);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb2));
                 break;
             case 47:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb3);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateTomb3));
                 break;
             case 49:
             {
                 Actor* bonusActorChest = level->IsWaterLevel() ? new Actor(x + 0.5f, y + 0.5f, 0, decorateWaterChest) : new Actor(x + 0.5f, y + 0.5f, 0, decorateChest);
-                actors[(y * level->GetLevelWidth()) + x] = bonusActorChest;
+                level->SetBlockingActor(x, y, bonusActorChest);
                 break;
             }
             case 50:
@@ -182,7 +183,7 @@ void GameArmageddon::SpawnActors(Level* level, const DifficultyLevel difficultyL
                     zombie_delay = (tile >> 8) * 30;
                 else
                 {
-                    const int16_t current_zombie_delay = (2 * 60) + rand() % (4 * 60);
+                    const int16_t current_zombie_delay = (2 * 60) + random.Next(4 * 60);
                     zombie_delay = m_zombie_base_delay + current_zombie_delay;
                     m_zombie_base_delay += current_zombie_delay;
                     if (m_zombie_base_delay > 8 * 60)
@@ -190,18 +191,18 @@ void GameArmageddon::SpawnActors(Level* level, const DifficultyLevel difficultyL
                 }
                 Actor* treeActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateTree);
                 treeActor->SetTemp2(zombie_delay);
-                actors[(y * level->GetLevelWidth()) + x] = treeActor;
+                level->SetBlockingActor(x, y, treeActor);
                 break;
             }
             case 51:
             {
-                int16_t zombie_delay = rand() % 30;
+                int16_t zombie_delay = random.Next(30);
                 unsigned int tile = level->GetFloorTile(x, y + 1);
                 if (tile != 0)
                     zombie_delay = (tile >> 8) * 30;
                 else
                 {
-                    const int16_t current_zombie_delay = (2 * 60) + rand() % (4 * 60);
+                    const int16_t current_zombie_delay = (2 * 60) + random.Next(4 * 60);
                     zombie_delay = m_zombie_base_delay + current_zombie_delay;
                     m_zombie_base_delay += current_zombie_delay;
                     if (m_zombie_base_delay > 8 * 60)
@@ -209,20 +210,20 @@ void GameArmageddon::SpawnActors(Level* level, const DifficultyLevel difficultyL
                 }
                 Actor* bunnyActor = new Actor(x + 0.5f, y + 0.5f, 0, decorateBunny);
                 bunnyActor->SetTemp2(zombie_delay);
-                actors[(y * level->GetLevelWidth()) + x] = bunnyActor;
+                level->SetBlockingActor(x, y, bunnyActor);
                 break;
             }
             case 54:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateColumn);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateColumn));
                 break;
             case 55:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateSulphurGas);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateSulphurGas));
                 break;
             case 56:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateFirePot);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateFirePot));
                 break;
             case 58:
-                actors[(y * level->GetLevelWidth()) + x] = new Actor(x + 0.5f, y + 0.5f, 0, decorateFountain);
+                level->SetBlockingActor(x, y, new Actor(x + 0.5f, y + 0.5f, 0, decorateFountain));
                 break;
             default:
                 break;
@@ -14,7 +14,9 @@
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
 
 #include "Actor.h"
-#include "Math.h"
+#include <math.h>
+#include "ActorPool.h"
+#include "ActorStore.h"
 #include <fstream>
 
 Actor::Actor(const float x, const float y, const uint32_t timestamp, const DecorateActor& decorateActor) :
@@ -24,25 +26,41 @@ Actor::Actor(const float x, const float y, const uint32_t timestamp, const Decor
     m_tileY(uint8_t(y)),
     m_timestamp(timestamp),
     m_solid(false),
+    m_health(decorateActor.initialHealth),
+    m_temp1(0),
+    m_temp2(0),
     m_direction(nodir),
     m_active(false),
     m_stateId(StateIdHidden),
-    m_animationFrame(0),
+    m_frameIndex(0),
+    m_actionPerformed(false),
     m_timeToNextAction(0),
-    m_decorateActor(decorateActor),
-    m_health(decorateActor.initialHealth),
     m_angle(0.0f),
-    m_temp1(0),
-    m_temp2(0),
-    m_actionPerformed(false)
-
+    m_previousX(x),
+    m_previousY(y),
+    m_previousAngle(0.0f),
+    m_decorateActor(decorateActor),
+    m_frameTable(DecorateFrameTable::Get(decorateActor)),
+    m_store(NULL),
+    m_storeIndex(0),
+    m_spatialHashIndex(0),
+    m_wakeUpLevel(0),
+    m_wakeUpSlot(0),
+    m_wakeUpIndex(0)
 {
     SetState(decorateActor.initialState, m_timestamp);
     m_solid = (m_stateId != StateIdHidden && m_stateId != StateIdWaitForPickup);
 }
 
 Actor::Actor(std::ifstream& file, const std::map<uint16_t, const DecorateActor>& decorateActors) :
-    m_decorateActor(GetDecorateActorFromFile(file, decorateActors))
+    m_decorateActor(GetDecorateActorFromFile(file, decorateActors)),
+    m_frameTable(DecorateFrameTable::Get(m_decorateActor)),
+    m_store(NULL),
+    m_storeIndex(0),
+    m_spatialHashIndex(0),
+    m_wakeUpLevel(0),
+    m_wakeUpSlot(0),
+    m_wakeUpIndex(0)
 {
     file.read((char*)&m_x, sizeof(m_x));
     file.read((char*)&m_y, sizeof(m_y));
@@ -60,10 +78,46 @@ Actor::Actor(std::ifstream& file, const std::map<uint16_t, const DecorateActor>&
     uint8_t stateId = 0;
     file.read((char*)&stateId, sizeof(stateId));
     m_stateId = (DecorateStateId)stateId;
-    file.read((char*)&m_animationFrame, sizeof(m_animationFrame));
+    uint16_t animationFrame = 0;
+    file.read((char*)&animationFrame, sizeof(animationFrame));
+    m_frameIndex = m_frameTable.GetFirstFrameIndex(m_stateId) + animationFrame;
     file.read((char*)&m_actionPerformed, sizeof(m_actionPerformed));
     file.read((char*)&m_timeToNextAction, sizeof(m_timeToNextAction));
     file.read((char*)&m_angle, sizeof(m_angle));
+    StorePreviousPosition();
+}
+
+// The copy is not part of any ActorStore, but takes over the animation state of the original actor.
+Actor::Actor(const Actor& actor) :
+    m_x(actor.m_x),
+    m_y(actor.m_y),
+    m_tileX(actor.m_tileX),
+    m_tileY(actor.m_tileY),
+    m_timestamp(actor.GetTimestamp()),
+    m_solid(actor.m_solid),
+    m_health(actor.m_health),
+    m_temp1(actor.m_temp1),
+    m_temp2(actor.m_temp2),
+    m_direction(actor.m_direction),
+    m_active(actor.IsActive()),
+    m_stateId(actor.GetStateId()),
+    m_frameIndex(actor.GetFrameIndex()),
+    m_actionPerformed(actor.IsActionPerformed()),
+    m_timeToNextAction(actor.m_timeToNextAction),
+    m_angle(actor.m_angle),
+    m_previousX(actor.m_previousX),
+    m_previousY(actor.m_previousY),
+    m_previousAngle(actor.m_previousAngle),
+    m_decorateActor(actor.m_decorateActor),
+    m_frameTable(actor.m_frameTable),
+    m_store(NULL),
+    m_storeIndex(0),
+    m_spatialHashIndex(0),
+    m_wakeUpLevel(0),
+    m_wakeUpSlot(0),
+    m_wakeUpIndex(0)
+{
+
 }
 
 Actor::~Actor()
@@ -71,6 +125,35 @@ Actor::~Actor()
 
 }
 
+// Actors are spawned and removed all the time, so they are allocated from a dedicated pool. The pool is never
+// destroyed, as actors may still be deleted during static destruction.
+static ActorPool& GetActorPool()
+{
+    static ActorPool* pool = new ActorPool(sizeof(Actor), 256);
+    return *pool;
+}
+
+void* Actor::operator new(size_t size)
+{
+    if (size != sizeof(Actor))
+    {
+        return ::operator new(size);
+    }
+
+    return GetActorPool().Allocate();
+}
+
+void Actor::operator delete(void* actor, size_t size)
+{
+    if (size != sizeof(Actor))
+    {
+        ::operator delete(actor);
+        return;
+    }
+
+    GetActorPool().Free(actor);
+}
+
 const DecorateActor& Actor::GetDecorateActorFromFile(std::ifstream& file, const std::map<uint16_t, const DecorateActor>& decorateActors) const
 {
     uint16_t actorId = 0;
@@ -129,28 +212,18 @@ bool Actor::TargetReached() const
 
 uint16_t Actor::GetPictureIndex() const
 {
-
-    const DecorateState& currentState = m_decorateActor.states.find(m_stateId)->second;
-    return currentState.animation.at(m_animationFrame).pictureIndex;
+    return m_frameTable.GetFrame(GetFrameIndex()).pictureIndex;
 }
 
 void Actor::Think(const uint32_t currentTimestamp)
 {
-    const uint16_t deltaTicks = (uint16_t)(((currentTimestamp - m_timestamp) * 60) / 1000);
-    const DecorateState& currentState = m_decorateActor.states.find(m_stateId)->second;
-    const DecorateAnimationFrame& currentFrame = currentState.animation.at(m_animationFrame);
-    if (deltaTicks > currentFrame.durationInTics)
+    if (m_store != NULL)
+    {
+        m_store->Think(m_storeIndex, currentTimestamp);
+    }
+    else if (ActorStore::AdvanceFrame(m_frameTable, currentTimestamp, m_timestamp, m_frameIndex, m_stateId))
     {
-        // Goto next frame
-        m_animationFrame++;
-        m_timestamp = currentTimestamp;
         m_actionPerformed = false;
-        if (currentState.animation.size() <= m_animationFrame)
-        {
-            // We're at the end of an animation; go to the first frame of the next state
-            m_stateId = currentState.nextState;
-            m_animationFrame = 0;
-        }
     }
 }
 
@@ -161,8 +234,7 @@ bool Actor::IsSolid() const
 
 actorAction Actor::GetAction() const
 {
-    const DecorateState& currentState = m_decorateActor.states.find(m_stateId)->second;
-    return currentState.animation.at(m_animationFrame).action;
+    return m_frameTable.GetFrame(GetFrameIndex()).action;
 }
 
 bool Actor::WouldCollideWithActor(const float x, const float y, const float size) const
@@ -182,7 +254,7 @@ void Actor::SetDirection(const actorDirection direction)
 
 void Actor::Damage(const int16_t points)
 {
-    if (m_decorateActor.states.find(StateIdDying) != m_decorateActor.states.end())
+    if (m_frameTable.HasState(StateIdDying))
     {
         m_health -= points;
         if (m_health < 0)
@@ -199,12 +271,25 @@ bool Actor::IsDead() const
 
 bool Actor::IsActive() const
 {
-    return m_active;
+    return (m_store != NULL) ? m_store->IsActive(m_storeIndex) : m_active;
 }
 
 void Actor::SetActive(const bool active)
 {
-    m_active = active;
+    if (m_store != NULL)
+    {
+        m_store->SetActive(m_storeIndex, active);
+    }
+    else
+    {
+        m_active = active;
+    }
+}
+
+// Only actors in an ActorStore can be put asleep.
+bool Actor::IsAsleep() const
+{
+    return (m_store != NULL) && m_store->IsAsleep(m_storeIndex);
 }
 
 int16_t Actor::GetTemp1() const
@@ -234,12 +319,19 @@ const DecorateActor& Actor::GetDecorateActor() const
 
 void Actor::SetState(const DecorateStateId state, const uint32_t timestamp)
 {
-    if (m_decorateActor.states.find(state) != m_decorateActor.states.end())
+    if (m_frameTable.HasState(state))
     {
-        m_stateId = state;
-        m_timestamp = timestamp;
-        m_animationFrame = 0;
-        m_actionPerformed = false;
+        if (m_store != NULL)
+        {
+            m_store->SetState(m_storeIndex, state, m_frameTable.GetFirstFrameIndex(state), timestamp);
+        }
+        else
+        {
+            m_stateId = state;
+            m_timestamp = timestamp;
+            m_frameIndex = m_frameTable.GetFirstFrameIndex(state);
+        }
+        SetActionPerformed(false);
     }
 }
 
@@ -250,12 +342,19 @@ void Actor::SetSolid(const bool solid)
 
 bool Actor::IsActionPerformed() const
 {
-    return m_actionPerformed;
+    return (m_store != NULL) ? m_store->IsActionPerformed(m_storeIndex) : m_actionPerformed;
 }
 
 void Actor::SetActionPerformed(const bool performed)
 {
-    m_actionPerformed = performed;
+    if (m_store != NULL)
+    {
+        m_store->SetActionPerformed(m_storeIndex, performed);
+    }
+    else
+    {
+        m_actionPerformed = performed;
+    }
 }
 
 void Actor::SetTimeToNextAction(const uint32_t timeToRise)
@@ -268,6 +367,13 @@ uint32_t Actor::GetTimeToNextAction() const
     return m_timeToNextAction;
 }
 
+// Returns the first point in time at which Think moves on to the next animation frame.
+uint32_t Actor::GetTimestampOfNextFrame() const
+{
+    const uint32_t durationInTics = m_frameTable.GetFrame(GetFrameIndex()).durationInTics;
+    return GetTimestamp() + ((((durationInTics + 1) * 1000) + 59) / 60);
+}
+
 void Actor::SetTemp1(const int16_t temp1)
 {
     m_temp1 = temp1;
@@ -296,7 +402,50 @@ void Actor::SetAngle(const float angle)
     }
 }
 
-void Actor::StoreToFile(std::ofstream& file) const
+// Stores the position of the previous simulation tick, such that the actor can be rendered in between ticks.
+void Actor::StorePreviousPosition()
+{
+    m_previousX = m_x;
+    m_previousY = m_y;
+    m_previousAngle = m_angle;
+}
+
+float Actor::GetInterpolatedX(const float interpolation) const
+{
+    return m_previousX + ((m_x - m_previousX) * interpolation);
+}
+
+float Actor::GetInterpolatedY(const float interpolation) const
+{
+    return m_previousY + ((m_y - m_previousY) * interpolation);
+}
+
+float Actor::GetInterpolatedAngle(const float interpolation) const
+{
+    // Turn along the shortest way, also when the angle wrapped around 360 degrees.
+    float deltaAngle = m_angle - m_previousAngle;
+    if (deltaAngle > 180.0f)
+    {
+        deltaAngle -= 360.0f;
+    }
+    else if (deltaAngle < -180.0f)
+    {
+        deltaAngle += 360.0f;
+    }
+
+    float angle = m_previousAngle + (deltaAngle * interpolation);
+    if (angle > 360.0f)
+    {
+        angle -= 360.0f;
+    }
+    else if (angle < 0.0f)
+    {
+        angle += 360.0f;
+    }
+    return angle;
+}
+
+void Actor::StoreToFile(std::ostream& file) const
 {
     const uint16_t id = m_decorateActor.id;
     file.write((const char*)&id, sizeof(id));
@@ -304,18 +453,37 @@ void Actor::StoreToFile(std::ofstream& file) const
     file.write((const char*)&m_y, sizeof(m_y));
     file.write((const char*)&m_tileX, sizeof(m_tileX));
     file.write((const char*)&m_tileY, sizeof(m_tileY));
-    file.write((const char*)&m_timestamp, sizeof(m_timestamp));
+    const uint32_t timestamp = GetTimestamp();
+    file.write((const char*)&timestamp, sizeof(timestamp));
     file.write((const char*)&m_solid, sizeof(m_solid));
     file.write((const char*)&m_health, sizeof(m_health));
     file.write((const char*)&m_temp1, sizeof(m_temp1));
     file.write((const char*)&m_temp2, sizeof(m_temp2));
     uint8_t direction = (uint8_t)m_direction;
     file.write((const char*)&direction, sizeof(direction));
-    file.write((const char*)&m_active, sizeof(m_active));
-    uint8_t stateId = (uint8_t)m_stateId;
+    const bool active = IsActive();
+    file.write((const char*)&active, sizeof(active));
+    uint8_t stateId = (uint8_t)GetStateId();
     file.write((const char*)&stateId, sizeof(stateId));
-    file.write((const char*)&m_animationFrame, sizeof(m_animationFrame));
-    file.write((const char*)&m_actionPerformed, sizeof(m_actionPerformed));
+    const uint16_t animationFrame = GetFrameIndex() - m_frameTable.GetFirstFrameIndex(GetStateId());
+    file.write((const char*)&animationFrame, sizeof(animationFrame));
+    const bool actionPerformed = IsActionPerformed();
+    file.write((const char*)&actionPerformed, sizeof(actionPerformed));
     file.write((const char*)&m_timeToNextAction, sizeof(m_timeToNextAction));
     file.write((const char*)&m_angle, sizeof(m_angle));
-}
\ No newline at end of file
+}
+
+uint32_t Actor::GetTimestamp() const
+{
+    return (m_store != NULL) ? m_store->GetTimestamp(m_storeIndex) : m_timestamp;
+}
+
+DecorateStateId Actor::GetStateId() const
+{
+    return (m_store != NULL) ? m_store->GetStateId(m_storeIndex) : m_stateId;
+}
+
+uint16_t Actor::GetFrameIndex() const
+{
+    return (m_store != NULL) ? m_store->GetFrameIndex(m_storeIndex) : m_frameIndex;
+}
@@ -20,7 +20,10 @@
 //
 #pragma once
 
-#include "Decorate.h"
+#include "DecorateFrameTable.h"
+#include <fstream>
+
+class ActorStore;
 
 typedef enum {north,east,south,west,northeast,southeast,southwest,northwest,nodir} actorDirection;
 
@@ -29,8 +32,12 @@ class Actor
 public:
     Actor(const float x, const float y, const uint32_t timestamp, const DecorateActor& decorateActor);
     Actor(std::ifstream& file, const std::map<uint16_t, const DecorateActor>& decorateActors);
+    Actor(const Actor& actor);
     ~Actor();
 
+    static void* operator new(size_t size);
+    static void operator delete(void* actor, size_t size);
+
     const DecorateActor& GetDecorateActorFromFile(std::ifstream& file, const std::map<uint16_t, const DecorateActor>& decorateActors) const;
 
     float GetX() const;
@@ -52,6 +59,7 @@ public:
     bool IsDead() const;
     bool IsActive() const;
     void SetActive(const bool active);
+    bool IsAsleep() const;
     void SetHealth(const int16_t health);
     int16_t GetHealth() const;
     void Think(const uint32_t currentTimestamp);
@@ -67,13 +75,27 @@ public:
     void SetActionPerformed(const bool performed);
     void SetTimeToNextAction(const uint32_t timeToRise);
     uint32_t GetTimeToNextAction() const;
+    uint32_t GetTimestampOfNextFrame() const;
     float GetAngle() const;
     void SetAngle(const float angle);
 
+    void StorePreviousPosition();
+    float GetInterpolatedX(const float interpolation) const;
+    float GetInterpolatedY(const float interpolation) const;
+    float GetInterpolatedAngle(const float interpolation) const;
+
     const DecorateActor& GetDecorateActor() const;
-    void StoreToFile(std::ofstream& file) const;
+    void StoreToFile(std::ostream& file) const;
 
 protected:
+    friend class ActorStore;
+    friend class SpatialHash;
+    friend class TimerWheel;
+
+    uint32_t GetTimestamp() const;
+    DecorateStateId GetStateId() const;
+    uint16_t GetFrameIndex() const;
+
     float m_x;
     float m_y;
     uint8_t m_tileX;
@@ -85,9 +107,26 @@ protected:
     actorDirection m_direction;
     bool m_active;
     DecorateStateId m_stateId;
-    uint16_t m_animationFrame;
+    uint16_t m_frameIndex;
     bool m_actionPerformed;
     uint32_t m_timeToNextAction;
     float m_angle;
+    float m_previousX;
+    float m_previousY;
+    float m_previousAngle;
     const DecorateActor& m_decorateActor;
+    const DecorateFrameTable& m_frameTable;
+
+    // While the actor is in an ActorStore, its timestamp, state, frame index, active flag and action performed flag
+    // are kept in the store, and the corresponding fields above are not used.
+    ActorStore* m_store;
+    uint32_t m_storeIndex;
+
+    // Position of the actor in the SpatialHash it was last built into, such that it can be removed without a search.
+    uint32_t m_spatialHashIndex;
+
+    // Position of the wake-up of the actor in the TimerWheel, such that it can be cancelled without a search.
+    uint8_t m_wakeUpLevel;
+    uint8_t m_wakeUpSlot;
+    uint32_t m_wakeUpIndex;
 };
@@ -0,0 +1,92 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "ActorPool.h"
+#include <cstddef>
+#include <new>
+
+// The slot size is rounded up, such that every slot is suitably aligned for any type.
+ActorPool::ActorPool(const size_t slotSize, const size_t slotsPerBlock) :
+    m_slotSize(((slotSize + alignof(std::max_align_t) - 1) / alignof(std::max_align_t)) * alignof(std::max_align_t)),
+    m_slotsPerBlock(slotsPerBlock),
+    m_blocks(),
+    m_freeSlots(),
+    m_mutex()
+{
+
+}
+
+ActorPool::~ActorPool()
+{
+    for (void* block : m_blocks)
+    {
+        ::operator delete(block);
+    }
+    m_blocks.clear();
+    m_freeSlots.clear();
+}
+
+void* ActorPool::Allocate()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_freeSlots.empty())
+    {
+        AddBlock();
+    }
+
+    void* slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+    return slot;
+}
+
+void ActorPool::Free(void* slot)
+{
+    if (slot == NULL)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_freeSlots.push_back(slot);
+}
+
+size_t ActorPool::GetSlotSize() const
+{
+    return m_slotSize;
+}
+
+size_t ActorPool::GetNumberOfSlots() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_blocks.size() * m_slotsPerBlock;
+}
+
+size_t ActorPool::GetNumberOfFreeSlots() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_freeSlots.size();
+}
+
+void ActorPool::AddBlock()
+{
+    uint8_t* block = (uint8_t*)::operator new(m_slotSize * m_slotsPerBlock);
+    m_blocks.push_back(block);
+
+    // Push the slots in reverse order, such that they are handed out in order of address.
+    m_freeSlots.reserve(m_freeSlots.size() + m_slotsPerBlock);
+    for (size_t i = m_slotsPerBlock; i > 0; i--)
+    {
+        m_freeSlots.push_back(block + ((i - 1) * m_slotSize));
+    }
+}
@@ -0,0 +1,51 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// ActorPool
+//
+// Fixed size memory allocator for actors. Memory is allocated in blocks of slots, which are never returned to
+// the system; freed slots are kept in a free list and handed out again by the next allocation. This avoids a
+// heap allocation for each projectile and explosion that is spawned during the game.
+// Actors are allocated from the level preloader thread as well, hence the pool is guarded by a mutex.
+//
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include <mutex>
+
+class ActorPool
+{
+public:
+    ActorPool(const size_t slotSize, const size_t slotsPerBlock);
+    ~ActorPool();
+
+    void* Allocate();
+    void Free(void* slot);
+
+    size_t GetSlotSize() const;
+    size_t GetNumberOfSlots() const;
+    size_t GetNumberOfFreeSlots() const;
+
+private:
+    void AddBlock();
+
+    const size_t m_slotSize;
+    const size_t m_slotsPerBlock;
+    std::vector<void*> m_blocks;
+    std::vector<void*> m_freeSlots;
+    mutable std::mutex m_mutex;
+};
+
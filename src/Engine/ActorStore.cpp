@@ -0,0 +1,274 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "ActorStore.h"
+#include "Actor.h"
+
+ActorStore::ActorStore() :
+    m_actors(),
+    m_frameTables(),
+    m_timestamps(),
+    m_frameIndices(),
+    m_stateIds(),
+    m_active(),
+    m_actionPerformed(),
+    m_asleep()
+{
+
+}
+
+// Actors that are still in the store get back their animation state.
+ActorStore::~ActorStore()
+{
+    for (size_t i = 0; i < m_actors.size(); i++)
+    {
+        Detach(m_actors[i], i);
+    }
+}
+
+// Adding an actor that is already in the store has no effect.
+void ActorStore::Add(Actor* actor)
+{
+    if (actor == NULL || Contains(actor))
+    {
+        return;
+    }
+
+    m_actors.push_back(NULL);
+    m_frameTables.push_back(NULL);
+    m_timestamps.push_back(0);
+    m_frameIndices.push_back(0);
+    m_stateIds.push_back(StateIdHidden);
+    m_active.push_back(0);
+    m_actionPerformed.push_back(0);
+    m_asleep.push_back(0);
+    Attach(actor, m_actors.size() - 1);
+}
+
+// Removes the actor from the store without deleting it. The actor gets back its animation state.
+bool ActorStore::Remove(const Actor* actor)
+{
+    const size_t storeIndex = GetIndex(actor);
+    if (storeIndex == NotInStore)
+    {
+        return false;
+    }
+
+    Detach(m_actors[storeIndex], storeIndex);
+
+    // Move the last actor in the store into the freed slot
+    const size_t lastIndex = m_actors.size() - 1;
+    if (storeIndex != lastIndex)
+    {
+        Actor* lastActor = m_actors[lastIndex];
+        m_actors[storeIndex] = lastActor;
+        m_frameTables[storeIndex] = m_frameTables[lastIndex];
+        m_timestamps[storeIndex] = m_timestamps[lastIndex];
+        m_frameIndices[storeIndex] = m_frameIndices[lastIndex];
+        m_stateIds[storeIndex] = m_stateIds[lastIndex];
+        m_active[storeIndex] = m_active[lastIndex];
+        m_actionPerformed[storeIndex] = m_actionPerformed[lastIndex];
+        m_asleep[storeIndex] = m_asleep[lastIndex];
+        lastActor->m_storeIndex = (uint32_t)storeIndex;
+    }
+
+    m_actors.pop_back();
+    m_frameTables.pop_back();
+    m_timestamps.pop_back();
+    m_frameIndices.pop_back();
+    m_stateIds.pop_back();
+    m_active.pop_back();
+    m_actionPerformed.pop_back();
+    m_asleep.pop_back();
+
+    return true;
+}
+
+// Puts the replacement at the position of the given actor, which is removed from the store without being deleted.
+bool ActorStore::Replace(const Actor* actor, Actor* replacement)
+{
+    const size_t storeIndex = GetIndex(actor);
+    if (storeIndex == NotInStore)
+    {
+        return false;
+    }
+
+    Detach(m_actors[storeIndex], storeIndex);
+    Attach(replacement, storeIndex);
+    return true;
+}
+
+bool ActorStore::Contains(const Actor* actor) const
+{
+    return GetIndex(actor) != NotInStore;
+}
+
+void ActorStore::DeleteAll()
+{
+    for (Actor* actor : m_actors)
+    {
+        actor->m_store = NULL;
+        delete actor;
+    }
+    m_actors.clear();
+    m_frameTables.clear();
+    m_timestamps.clear();
+    m_frameIndices.clear();
+    m_stateIds.clear();
+    m_active.clear();
+    m_actionPerformed.clear();
+    m_asleep.clear();
+}
+
+const std::vector<Actor*>& ActorStore::GetActors() const
+{
+    return m_actors;
+}
+
+// Advances the animations of all actors in the store that are awake, or only of the active ones. This is the
+// equivalent of calling Actor::Think on each of them.
+void ActorStore::Think(const uint32_t currentTimestamp, const bool activeOnly)
+{
+    const size_t numberOfActors = m_actors.size();
+    for (size_t i = 0; i < numberOfActors; i++)
+    {
+        if ((activeOnly && m_active[i] == 0) || m_asleep[i] != 0)
+        {
+            continue;
+        }
+
+        if (AdvanceFrame(*m_frameTables[i], currentTimestamp, m_timestamps[i], m_frameIndices[i], m_stateIds[i]))
+        {
+            m_actionPerformed[i] = 0;
+        }
+    }
+}
+
+// Returns false if the actor is not in the store.
+bool ActorStore::SetAsleep(const Actor* actor, const bool asleep)
+{
+    const size_t storeIndex = GetIndex(actor);
+    if (storeIndex == NotInStore)
+    {
+        return false;
+    }
+
+    m_asleep[storeIndex] = asleep ? 1 : 0;
+    return true;
+}
+
+uint32_t ActorStore::GetTimestamp(const uint32_t index) const
+{
+    return m_timestamps[index];
+}
+
+DecorateStateId ActorStore::GetStateId(const uint32_t index) const
+{
+    return m_stateIds[index];
+}
+
+uint16_t ActorStore::GetFrameIndex(const uint32_t index) const
+{
+    return m_frameIndices[index];
+}
+
+void ActorStore::SetState(const uint32_t index, const DecorateStateId stateId, const uint16_t frameIndex, const uint32_t timestamp)
+{
+    m_stateIds[index] = stateId;
+    m_frameIndices[index] = frameIndex;
+    m_timestamps[index] = timestamp;
+    m_asleep[index] = 0;
+}
+
+bool ActorStore::IsActive(const uint32_t index) const
+{
+    return m_active[index] != 0;
+}
+
+void ActorStore::SetActive(const uint32_t index, const bool active)
+{
+    m_active[index] = active ? 1 : 0;
+}
+
+bool ActorStore::IsActionPerformed(const uint32_t index) const
+{
+    return m_actionPerformed[index] != 0;
+}
+
+void ActorStore::SetActionPerformed(const uint32_t index, const bool performed)
+{
+    m_actionPerformed[index] = performed ? 1 : 0;
+}
+
+bool ActorStore::IsAsleep(const uint32_t index) const
+{
+    return m_asleep[index] != 0;
+}
+
+void ActorStore::Think(const uint32_t index, const uint32_t currentTimestamp)
+{
+    if (AdvanceFrame(*m_frameTables[index], currentTimestamp, m_timestamps[index], m_frameIndices[index], m_stateIds[index]))
+    {
+        m_actionPerformed[index] = 0;
+    }
+}
+
+// Moves on to the next animation frame once the current frame has been shown long enough. At the end of an
+// animation, this is the first frame of the next state. Returns true if the frame has changed.
+bool ActorStore::AdvanceFrame(const DecorateFrameTable& frameTable, const uint32_t currentTimestamp, uint32_t& timestamp, uint16_t& frameIndex, DecorateStateId& stateId)
+{
+    const uint16_t deltaTicks = (uint16_t)(((currentTimestamp - timestamp) * 60) / 1000);
+    const DecorateFrame& currentFrame = frameTable.GetFrame(frameIndex);
+    if (deltaTicks > currentFrame.durationInTics)
+    {
+        frameIndex = currentFrame.nextFrameIndex;
+        stateId = frameTable.GetFrame(frameIndex).stateId;
+        timestamp = currentTimestamp;
+        return true;
+    }
+
+    return false;
+}
+
+// Moves the animation state of the actor into the store.
+void ActorStore::Attach(Actor* actor, const size_t index)
+{
+    m_actors[index] = actor;
+    m_frameTables[index] = &actor->m_frameTable;
+    m_timestamps[index] = actor->m_timestamp;
+    m_frameIndices[index] = actor->m_frameIndex;
+    m_stateIds[index] = actor->m_stateId;
+    m_active[index] = actor->m_active ? 1 : 0;
+    m_actionPerformed[index] = actor->m_actionPerformed ? 1 : 0;
+    m_asleep[index] = 0;
+    actor->m_store = this;
+    actor->m_storeIndex = (uint32_t)index;
+}
+
+// Moves the animation state of the actor back into the actor itself.
+void ActorStore::Detach(Actor* actor, const size_t index)
+{
+    actor->m_timestamp = m_timestamps[index];
+    actor->m_frameIndex = m_frameIndices[index];
+    actor->m_stateId = m_stateIds[index];
+    actor->m_active = (m_active[index] != 0);
+    actor->m_actionPerformed = (m_actionPerformed[index] != 0);
+    actor->m_store = NULL;
+    actor->m_storeIndex = 0;
+}
+
+size_t ActorStore::GetIndex(const Actor* actor) const
+{
+    return (actor != NULL && actor->m_store == this) ? actor->m_storeIndex : NotInStore;
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// ActorStore
+//
+// Unordered collection of actors, in which actors can be added and removed in constant time. The actors are kept
+// contiguous, such that iterating over them does not involve any empty slots; when an actor is removed, the last
+// actor in the store takes over its position.
+// The animation state of the actors is stored as a structure of arrays. While an actor is in the store, the Actor
+// object acts as a handle that reads and writes its animation state in these arrays, which allows the animations
+// of all actors to be advanced in a single pass over contiguous memory. Actors that are asleep are skipped; a
+// change of state wakes an actor up.
+// Each actor knows the store it is in and its index in that store, such that it can be found without a search.
+// The store does not own the actors.
+//
+#pragma once
+
+#include <vector>
+#include <stddef.h>
+#include "DecorateFrameTable.h"
+
+class Actor;
+
+class ActorStore
+{
+public:
+    ActorStore();
+    ~ActorStore();
+
+    void Add(Actor* actor);
+    bool Remove(const Actor* actor);
+    bool Replace(const Actor* actor, Actor* replacement);
+    bool Contains(const Actor* actor) const;
+    void DeleteAll();
+    const std::vector<Actor*>& GetActors() const;
+
+    void Think(const uint32_t currentTimestamp, const bool activeOnly);
+    bool SetAsleep(const Actor* actor, const bool asleep);
+
+    uint32_t GetTimestamp(const uint32_t index) const;
+    DecorateStateId GetStateId(const uint32_t index) const;
+    uint16_t GetFrameIndex(const uint32_t index) const;
+    void SetState(const uint32_t index, const DecorateStateId stateId, const uint16_t frameIndex, const uint32_t timestamp);
+    bool IsActive(const uint32_t index) const;
+    void SetActive(const uint32_t index, const bool active);
+    bool IsActionPerformed(const uint32_t index) const;
+    void SetActionPerformed(const uint32_t index, const bool performed);
+    bool IsAsleep(const uint32_t index) const;
+    void Think(const uint32_t index, const uint32_t currentTimestamp);
+
+    static bool AdvanceFrame(const DecorateFrameTable& frameTable, const uint32_t currentTimestamp, uint32_t& timestamp, uint16_t& frameIndex, DecorateStateId& stateId);
+
+private:
+    void Attach(Actor* actor, const size_t index);
+    void Detach(Actor* actor, const size_t index);
+    size_t GetIndex(const Actor* actor) const;
+
+    static const size_t NotInStore = (size_t)-1;
+
+    std::vector<Actor*> m_actors;
+
+    std::vector<const DecorateFrameTable*> m_frameTables;
+    std::vector<uint32_t> m_timestamps;
+    std::vector<uint16_t> m_frameIndices;
+    std::vector<DecorateStateId> m_stateIds;
+    std::vector<uint8_t> m_active;
+    std::vector<uint8_t> m_actionPerformed;
+    std::vector<uint8_t> m_asleep;
+};
+
@@ -15,10 +15,11 @@
 
 #include "AudioPlayer.h"
 #include <stdlib.h>
-#include "..\..\ThirdParty\RefKeen\id_sd.h"
+#include "../../ThirdParty/RefKeen/id_sd.h"
 
 AudioPlayer::AudioPlayer(AudioRepository* audioRepository) :
-    m_audioRepository(audioRepository)
+    m_audioRepository(audioRepository),
+    m_outputEnabled(true)
 {
 
 }
@@ -30,6 +31,11 @@ AudioPlayer::~AudioPlayer()
 
 void AudioPlayer::Play(const uint16_t index)
 {
+    if (!m_outputEnabled)
+    {
+        return;
+    }
+
     AdlibSound* sound = m_audioRepository->GetAdlibSound(index);
     if (sound != NULL)
     {
@@ -39,5 +45,36 @@ void AudioPlayer::Play(const uint16_t index)
 
 bool AudioPlayer::IsPlaying()
 {
-    return SD_SoundPlaying();
+    return m_outputEnabled && SD_SoundPlaying();
+}
+
+// Sound mode as stored in the configuration settings: 0 = off, 1 = AdLib.
+void AudioPlayer::SetSoundMode(const uint8_t soundMode)
+{
+    if (!m_outputEnabled)
+    {
+        return;
+    }
+
+    const SDMode currentSoundMode = SD_GetSoundMode();
+    if (soundMode == 0 && currentSoundMode != sdm_Off)
+    {
+        SD_SetSoundMode(sdm_Off);
+    }
+    if (soundMode == 1 && currentSoundMode != sdm_AdLib)
+    {
+        SD_SetSoundMode(sdm_AdLib);
+    }
+}
+
+// Without output, no sound device is accessed and no sound is ever playing. Used when running without a window,
+// in which case the sound manager is not started.
+void AudioPlayer::SetOutputEnabled(const bool enabled)
+{
+    m_outputEnabled = enabled;
+}
+
+bool AudioPlayer::IsOutputEnabled() const
+{
+    return m_outputEnabled;
 }
\ No newline at end of file
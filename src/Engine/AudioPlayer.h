@@ -24,7 +24,11 @@ public:
 
     void Play(const uint16_t index);
     bool IsPlaying();
+    void SetSoundMode(const uint8_t soundMode);
+    void SetOutputEnabled(const bool enabled);
+    bool IsOutputEnabled() const;
 
 private:
     AudioRepository* m_audioRepository;
+    bool m_outputEnabled;
 };
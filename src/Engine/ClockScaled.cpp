@@ -0,0 +1,47 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "ClockScaled.h"
+
+ClockScaled::ClockScaled(const IClock& sourceClock, const float scale) :
+    m_sourceClock(sourceClock),
+    m_scale(scale),
+    m_sourceTimeAtScaleChange(sourceClock.GetMilliseconds()),
+    m_scaledTimeAtScaleChange(m_sourceTimeAtScaleChange)
+{
+
+}
+
+ClockScaled::~ClockScaled()
+{
+
+}
+
+uint32_t ClockScaled::GetMilliseconds() const
+{
+    const uint32_t elapsedSourceTime = m_sourceClock.GetMilliseconds() - m_sourceTimeAtScaleChange;
+    return m_scaledTimeAtScaleChange + (uint32_t)((double)elapsedSourceTime * m_scale);
+}
+
+void ClockScaled::SetScale(const float scale)
+{
+    m_scaledTimeAtScaleChange = GetMilliseconds();
+    m_sourceTimeAtScaleChange = m_sourceClock.GetMilliseconds();
+    m_scale = scale;
+}
+
+float ClockScaled::GetScale() const
+{
+    return m_scale;
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// ClockScaled
+//
+// Clock that runs a fixed factor faster or slower than another clock, e.g. 0.25 for slow motion or 16 to let hours of
+// game time pass in minutes. Changing the factor does not make the time jump; the clock continues from where it was.
+//
+#pragma once
+
+#include "IClock.h"
+
+class ClockScaled : public IClock
+{
+public:
+    ClockScaled(const IClock& sourceClock, const float scale);
+    ~ClockScaled();
+
+    uint32_t GetMilliseconds() const override;
+    void SetScale(const float scale);
+    float GetScale() const;
+
+private:
+    const IClock& m_sourceClock;
+    float m_scale;
+    uint32_t m_sourceTimeAtScaleChange;
+    uint32_t m_scaledTimeAtScaleChange;
+};
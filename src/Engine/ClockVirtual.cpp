@@ -0,0 +1,41 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "ClockVirtual.h"
+
+ClockVirtual::ClockVirtual(const uint32_t startTime) :
+    m_currentTime(startTime)
+{
+
+}
+
+ClockVirtual::~ClockVirtual()
+{
+
+}
+
+uint32_t ClockVirtual::GetMilliseconds() const
+{
+    return m_currentTime;
+}
+
+void ClockVirtual::Advance(const uint32_t milliseconds)
+{
+    m_currentTime += milliseconds;
+}
+
+void ClockVirtual::SetTime(const uint32_t milliseconds)
+{
+    m_currentTime = milliseconds;
+}
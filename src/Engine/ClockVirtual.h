@@ -0,0 +1,37 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// ClockVirtual
+//
+// Clock that only moves when it is explicitly advanced. Allows tests and headless runs to step through time
+// deterministically, independent of how long the computations take.
+//
+#pragma once
+
+#include "IClock.h"
+
+class ClockVirtual : public IClock
+{
+public:
+    ClockVirtual(const uint32_t startTime = 0);
+    ~ClockVirtual();
+
+    uint32_t GetMilliseconds() const override;
+    void Advance(const uint32_t milliseconds);
+    void SetTime(const uint32_t milliseconds);
+
+private:
+    uint32_t m_currentTime;
+};
@@ -21,7 +21,8 @@
 
 #include <vector>
 #include <map>
-#include "..\..\ThirdParty\SDL\include\SDL_keycode.h"
+#include <string>
+#include "../../ThirdParty/SDL/include/SDL_keycode.h"
 
 enum ControlAction
 {
@@ -17,15 +17,18 @@
 //
 // Data structures for defining actor behavior. Currently all hard-coded, but could
 // potentially be extended to support external DECORATE files.
+// The hard-coded definitions are constexpr, such that they are laid out at compile time, without any
+// initialization at startup.
 //
 #pragma once
 
 #include <stdint.h>
 #include "EgaColor.h"
-#include <vector>
+#include <stddef.h>
+#include <utility>
 #include <map>
 
-const float pixelRadius = 1.0f / 128.0f;
+constexpr float pixelRadius = 1.0f / 128.0f;
 
 typedef enum {ActionNone, ActionChase, ActionChaseLikeMage, ActionChaseLikeWetMan, ActionRunAway, ActionHide, ActionHideUnderWater, ActionAttack,
               ActionRemove, ActionPlayerProjectile, ActionMonsterProjectile, ActionDropRedKey, ActionSpawnSkeleton,
@@ -59,14 +62,39 @@ typedef struct DecorateAnimationFrame
     actorAction action;
 } DecorateAnimationFrame;
 
-typedef std::vector<DecorateAnimationFrame> DecorateAnimation;
+// Read-only view on a constant array.
+template <typename T>
+class DecorateArray
+{
+public:
+    template <size_t N>
+    constexpr DecorateArray(const T (&items)[N]) :
+        m_items(items),
+        m_size((uint16_t)N)
+    {
+    }
+
+    constexpr const T* begin() const { return m_items; }
+    constexpr const T* end() const { return m_items + m_size; }
+    constexpr uint16_t size() const { return m_size; }
+    constexpr bool empty() const { return m_size == 0; }
+    constexpr const T& operator[](const uint16_t index) const { return m_items[index]; }
+
+private:
+    const T* m_items;
+    uint16_t m_size;
+};
+
+typedef DecorateArray<DecorateAnimationFrame> DecorateAnimation;
 
 struct DecorateState
 {
-    std::vector<DecorateAnimationFrame> animation;
+    DecorateAnimation animation;
     DecorateStateId nextState;
 };
 
+typedef std::pair<DecorateStateId, DecorateState> DecorateStatePair;
+
 struct DecorateActor
 {
     uint16_t id;
@@ -77,7 +105,7 @@ struct DecorateActor
     float size;
     actorRadarVisibility radarVisibility;
     egaColor radarColor;
-    std::map<DecorateStateId, DecorateState> states;
+    DecorateArray<DecorateStatePair> states;
     DecorateStateId initialState;
     uint8_t damage;
     uint16_t hitSound;
@@ -85,3 +113,36 @@ struct DecorateActor
     uint16_t actionParameter;
     uint16_t projectileId;
 };
+
+constexpr bool DecorateHasState(const DecorateActor& decorateActor, const DecorateStateId stateId)
+{
+    for (uint16_t i = 0; i < decorateActor.states.size(); i++)
+    {
+        if (decorateActor.states[i].first == stateId)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Checks that the actor can always find the state it goes to. Meant to be used in a static_assert.
+constexpr bool DecorateIsValid(const DecorateActor& decorateActor, const uint16_t id)
+{
+    if (decorateActor.id != id || decorateActor.states.empty() || !DecorateHasState(decorateActor, decorateActor.initialState))
+    {
+        return false;
+    }
+
+    for (uint16_t i = 0; i < decorateActor.states.size(); i++)
+    {
+        const DecorateState& state = decorateActor.states[i].second;
+        if (state.animation.empty() || !DecorateHasState(decorateActor, state.nextState))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
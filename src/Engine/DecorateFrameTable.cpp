@@ -0,0 +1,97 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "DecorateFrameTable.h"
+#include <mutex>
+
+DecorateFrameTable::DecorateFrameTable(const DecorateActor& decorateActor) :
+    m_frames()
+{
+    for (uint8_t i = 0; i < NumberOfStates; i++)
+    {
+        m_firstFrameIndex[i] = NoFrame;
+    }
+
+    // Lay out the frames of all states after each other. States without frames cannot be entered.
+    for (const auto& statePair : decorateActor.states)
+    {
+        const DecorateState& state = statePair.second;
+        if (state.animation.empty())
+        {
+            continue;
+        }
+
+        m_firstFrameIndex[statePair.first] = (uint16_t)m_frames.size();
+        for (const DecorateAnimationFrame& animationFrame : state.animation)
+        {
+            const uint16_t frameIndex = (uint16_t)m_frames.size();
+            m_frames.push_back({ animationFrame.pictureIndex, animationFrame.durationInTics, animationFrame.action, statePair.first, (uint16_t)(frameIndex + 1) });
+        }
+    }
+
+    // Link the last frame of each state to the first frame of the next state
+    for (const auto& statePair : decorateActor.states)
+    {
+        if (statePair.second.animation.empty())
+        {
+            continue;
+        }
+
+        const uint16_t lastFrameIndex = m_firstFrameIndex[statePair.first] + (uint16_t)statePair.second.animation.size() - 1;
+        const DecorateStateId nextState = statePair.second.nextState;
+        m_frames[lastFrameIndex].nextFrameIndex = HasState(nextState) ? m_firstFrameIndex[nextState] : m_firstFrameIndex[statePair.first];
+    }
+}
+
+DecorateFrameTable::~DecorateFrameTable()
+{
+
+}
+
+// Returns the frame table of the given DecorateActor, which is compiled on first use. As actors can be spawned
+// while a level is being preloaded, the tables are guarded by a mutex.
+const DecorateFrameTable& DecorateFrameTable::Get(const DecorateActor& decorateActor)
+{
+    static std::mutex tablesMutex;
+    static std::map<const DecorateActor*, DecorateFrameTable> tables;
+
+    std::lock_guard<std::mutex> lock(tablesMutex);
+    auto table = tables.find(&decorateActor);
+    if (table == tables.end())
+    {
+        table = tables.emplace(&decorateActor, DecorateFrameTable(decorateActor)).first;
+    }
+
+    return table->second;
+}
+
+const DecorateFrame& DecorateFrameTable::GetFrame(const uint16_t frameIndex) const
+{
+    return m_frames[frameIndex];
+}
+
+bool DecorateFrameTable::HasState(const DecorateStateId stateId) const
+{
+    return (stateId < NumberOfStates) && (m_firstFrameIndex[stateId] != NoFrame);
+}
+
+uint16_t DecorateFrameTable::GetFirstFrameIndex(const DecorateStateId stateId) const
+{
+    return (stateId < NumberOfStates) ? m_firstFrameIndex[stateId] : NoFrame;
+}
+
+uint16_t DecorateFrameTable::GetNumberOfFrames() const
+{
+    return (uint16_t)m_frames.size();
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// DecorateFrameTable
+//
+// Flattened form of the states of a DecorateActor. All animation frames are stored in one contiguous table, in
+// which each frame refers directly to the frame that follows it, also across states. An actor only needs to keep
+// the index of its current frame, which turns every state lookup into a single array access.
+// A table is compiled once per DecorateActor, the first time it is requested.
+//
+#pragma once
+
+#include "Decorate.h"
+#include <vector>
+
+typedef struct DecorateFrame
+{
+    uint16_t pictureIndex;
+    uint16_t durationInTics;
+    actorAction action;
+    DecorateStateId stateId;
+    uint16_t nextFrameIndex;
+} DecorateFrame;
+
+class DecorateFrameTable
+{
+public:
+    DecorateFrameTable(const DecorateActor& decorateActor);
+    ~DecorateFrameTable();
+
+    static const DecorateFrameTable& Get(const DecorateActor& decorateActor);
+
+    const DecorateFrame& GetFrame(const uint16_t frameIndex) const;
+    bool HasState(const DecorateStateId stateId) const;
+    uint16_t GetFirstFrameIndex(const DecorateStateId stateId) const;
+    uint16_t GetNumberOfFrames() const;
+
+    static const uint16_t NoFrame = 0xFFFF;
+    static const uint8_t NumberOfStates = StateIdDecoration + 1;
+
+private:
+    std::vector<DecorateFrame> m_frames;
+    uint16_t m_firstFrameIndex[NumberOfStates];
+};
+
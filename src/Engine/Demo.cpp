@@ -0,0 +1,419 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "Demo.h"
+
+static const char DemoHeader[15] = "CATACOMBGLDEMO";
+static const uint8_t DemoFormatVersion = 1;
+
+static const uint8_t FramePressedKeysChanged = 1;
+static const uint8_t FrameJustPressedKeys = 2;
+static const uint8_t FrameOtherInputChanged = 4;
+static const uint8_t FrameFlagBits = 3;
+
+static const uint8_t NumberOfMouseButtons = 6;
+
+// Several key codes map onto the same SDL key; only the first one of them is recorded.
+static const std::bitset<256>& GetRecordedKeys()
+{
+    static const std::bitset<256> recordedKeys = []()
+    {
+        std::bitset<256> keys;
+        for (uint16_t i = 0; i < 256; i++)
+        {
+            uint16_t j = 0;
+            while (asciiKeyToSDL[j] != asciiKeyToSDL[i])
+            {
+                j++;
+            }
+            keys[i] = (i == j);
+        }
+        return keys;
+    }();
+
+    return recordedKeys;
+}
+
+Demo::Demo() :
+    m_start(),
+    m_frames(),
+    m_numberOfFrames(0),
+    m_lastInput(),
+    m_checksum(0)
+{
+    Clear();
+}
+
+Demo::~Demo()
+{
+
+}
+
+void Demo::Clear()
+{
+    m_start.gameId = 0;
+    m_start.difficultyLevel = 0;
+    m_start.randomSeed = 0;
+    m_start.mapIndex = 0;
+    m_start.health = 100;
+    m_start.godMode = false;
+    m_start.mouseSensitivity = 0;
+    m_start.mouseLook = false;
+    m_start.timeToEnterLevel = 0;
+    m_start.inventory.clear();
+    m_frames.clear();
+    m_numberOfFrames = 0;
+    InitInput(m_lastInput);
+    m_checksum = 0;
+}
+
+void Demo::SetStart(const demoStart& start)
+{
+    m_start = start;
+}
+
+const Demo::demoStart& Demo::GetStart() const
+{
+    return m_start;
+}
+
+void Demo::AddFrame(const uint32_t timeDelta, const demoInput& input)
+{
+    const std::bitset<256> changedKeys = input.keysPressed ^ m_lastInput.keysPressed;
+    const bool otherInputChanged =
+        input.buttonsPressed != m_lastInput.buttonsPressed ||
+        input.buttonsJustPressed != m_lastInput.buttonsJustPressed ||
+        input.mouseX != m_lastInput.mouseX ||
+        input.mouseY != m_lastInput.mouseY ||
+        input.hasFocus != m_lastInput.hasFocus;
+
+    uint8_t flags = 0;
+    if (changedKeys.any())
+    {
+        flags |= FramePressedKeysChanged;
+    }
+    if (input.keysJustPressed.any())
+    {
+        flags |= FrameJustPressedKeys;
+    }
+    if (otherInputChanged)
+    {
+        flags |= FrameOtherInputChanged;
+    }
+
+    WriteVarInt((timeDelta << FrameFlagBits) | flags);
+    if (flags & FramePressedKeysChanged)
+    {
+        WriteKeys(changedKeys);
+    }
+    if (flags & FrameJustPressedKeys)
+    {
+        WriteKeys(input.keysJustPressed);
+    }
+    if (flags & FrameOtherInputChanged)
+    {
+        m_frames.push_back(input.buttonsPressed);
+        m_frames.push_back(input.buttonsJustPressed);
+        m_frames.push_back(input.hasFocus ? 1 : 0);
+        // Zigzag encoding keeps small negative movements small.
+        WriteVarInt(((uint32_t)input.mouseX << 1) ^ (uint32_t)(input.mouseX >> 31));
+        WriteVarInt(((uint32_t)input.mouseY << 1) ^ (uint32_t)(input.mouseY >> 31));
+    }
+
+    m_lastInput = input;
+    m_numberOfFrames++;
+}
+
+// Reads the frame at the given position and moves the position to the next frame. The input must contain the input of
+// the previous frame, as only the changes are stored. Returns false when there are no more frames.
+bool Demo::ReadFrame(size_t& position, uint32_t& timeDelta, demoInput& input) const
+{
+    uint32_t header = 0;
+    if (!ReadVarInt(position, header))
+    {
+        return false;
+    }
+
+    const uint8_t flags = header & ((1 << FrameFlagBits) - 1);
+    timeDelta = header >> FrameFlagBits;
+
+    if (flags & FramePressedKeysChanged)
+    {
+        std::bitset<256> changedKeys;
+        if (!ReadKeys(position, changedKeys))
+        {
+            return false;
+        }
+        input.keysPressed ^= changedKeys;
+    }
+
+    input.keysJustPressed.reset();
+    if ((flags & FrameJustPressedKeys) && !ReadKeys(position, input.keysJustPressed))
+    {
+        return false;
+    }
+
+    if (flags & FrameOtherInputChanged)
+    {
+        uint32_t mouseX = 0;
+        uint32_t mouseY = 0;
+        if (position + 3 > m_frames.size())
+        {
+            return false;
+        }
+        input.buttonsPressed = m_frames.at(position++);
+        input.buttonsJustPressed = m_frames.at(position++);
+        input.hasFocus = (m_frames.at(position++) != 0);
+        if (!ReadVarInt(position, mouseX) || !ReadVarInt(position, mouseY))
+        {
+            return false;
+        }
+        input.mouseX = (int32_t)(mouseX >> 1) ^ -(int32_t)(mouseX & 1);
+        input.mouseY = (int32_t)(mouseY >> 1) ^ -(int32_t)(mouseY & 1);
+    }
+
+    return true;
+}
+
+uint32_t Demo::GetNumberOfFrames() const
+{
+    return m_numberOfFrames;
+}
+
+size_t Demo::GetSize() const
+{
+    return m_frames.size();
+}
+
+void Demo::SetChecksum(const uint64_t checksum)
+{
+    m_checksum = checksum;
+}
+
+uint64_t Demo::GetChecksum() const
+{
+    return m_checksum;
+}
+
+bool Demo::StoreToFile(const std::string& filename) const
+{
+    std::ofstream file;
+    file.open(filename, std::ofstream::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file.write(DemoHeader, sizeof(DemoHeader));
+    file.write((const char*)&DemoFormatVersion, sizeof(DemoFormatVersion));
+    file.write((const char*)&m_start.gameId, sizeof(m_start.gameId));
+    file.write((const char*)&m_start.difficultyLevel, sizeof(m_start.difficultyLevel));
+    file.write((const char*)&m_start.randomSeed, sizeof(m_start.randomSeed));
+    file.write((const char*)&m_start.mapIndex, sizeof(m_start.mapIndex));
+    file.write((const char*)&m_start.health, sizeof(m_start.health));
+    file.write((const char*)&m_start.godMode, sizeof(m_start.godMode));
+    file.write((const char*)&m_start.mouseSensitivity, sizeof(m_start.mouseSensitivity));
+    file.write((const char*)&m_start.mouseLook, sizeof(m_start.mouseLook));
+    file.write((const char*)&m_start.timeToEnterLevel, sizeof(m_start.timeToEnterLevel));
+    const uint16_t inventorySize = (uint16_t)m_start.inventory.size();
+    file.write((const char*)&inventorySize, sizeof(inventorySize));
+    file.write(m_start.inventory.data(), inventorySize);
+    file.write((const char*)&m_numberOfFrames, sizeof(m_numberOfFrames));
+    file.write((const char*)&m_checksum, sizeof(m_checksum));
+    const uint32_t framesSize = (uint32_t)m_frames.size();
+    file.write((const char*)&framesSize, sizeof(framesSize));
+    file.write((const char*)m_frames.data(), framesSize);
+    file.close();
+
+    return true;
+}
+
+bool Demo::LoadFromFile(const std::string& filename)
+{
+    std::ifstream file;
+    file.open(filename, std::ifstream::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    Clear();
+
+    char header[sizeof(DemoHeader)];
+    file.read(header, sizeof(header));
+    uint8_t formatVersion = 0;
+    file.read((char*)&formatVersion, sizeof(formatVersion));
+    if (!file.good() || std::string(header, sizeof(header)) != std::string(DemoHeader, sizeof(DemoHeader)) || formatVersion != DemoFormatVersion)
+    {
+        return false;
+    }
+
+    file.read((char*)&m_start.gameId, sizeof(m_start.gameId));
+    file.read((char*)&m_start.difficultyLevel, sizeof(m_start.difficultyLevel));
+    file.read((char*)&m_start.randomSeed, sizeof(m_start.randomSeed));
+    file.read((char*)&m_start.mapIndex, sizeof(m_start.mapIndex));
+    file.read((char*)&m_start.health, sizeof(m_start.health));
+    file.read((char*)&m_start.godMode, sizeof(m_start.godMode));
+    file.read((char*)&m_start.mouseSensitivity, sizeof(m_start.mouseSensitivity));
+    file.read((char*)&m_start.mouseLook, sizeof(m_start.mouseLook));
+    file.read((char*)&m_start.timeToEnterLevel, sizeof(m_start.timeToEnterLevel));
+    uint16_t inventorySize = 0;
+    file.read((char*)&inventorySize, sizeof(inventorySize));
+    m_start.inventory.resize(inventorySize);
+    file.read(&m_start.inventory[0], inventorySize);
+    file.read((char*)&m_numberOfFrames, sizeof(m_numberOfFrames));
+    file.read((char*)&m_checksum, sizeof(m_checksum));
+    uint32_t framesSize = 0;
+    file.read((char*)&framesSize, sizeof(framesSize));
+    m_frames.resize(framesSize);
+    file.read((char*)m_frames.data(), framesSize);
+    const bool result = file.good();
+    file.close();
+
+    if (!result)
+    {
+        Clear();
+    }
+
+    return result;
+}
+
+void Demo::InitInput(demoInput& input)
+{
+    input.keysPressed.reset();
+    input.keysJustPressed.reset();
+    input.buttonsPressed = 0;
+    input.buttonsJustPressed = 0;
+    input.mouseX = 0;
+    input.mouseY = 0;
+    input.hasFocus = true;
+}
+
+void Demo::CaptureInput(const PlayerInput& playerInput, demoInput& input)
+{
+    const std::bitset<256>& recordedKeys = GetRecordedKeys();
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        if (recordedKeys[i])
+        {
+            input.keysPressed[i] = playerInput.IsKeyPressed(asciiKeyToSDL[i]);
+            input.keysJustPressed[i] = playerInput.IsKeyJustPressed(asciiKeyToSDL[i]);
+        }
+    }
+
+    input.buttonsPressed = 0;
+    input.buttonsJustPressed = 0;
+    for (uint8_t i = 0; i < NumberOfMouseButtons; i++)
+    {
+        input.buttonsPressed |= playerInput.IsMouseButtonPressed(i) ? (1 << i) : 0;
+        input.buttonsJustPressed |= playerInput.IsMouseButtonJustPressed(i) ? (1 << i) : 0;
+    }
+
+    input.mouseX = playerInput.GetMouseXPos();
+    input.mouseY = playerInput.GetMouseYPos();
+    input.hasFocus = playerInput.HasFocus();
+}
+
+void Demo::ApplyInput(const demoInput& input, PlayerInput& playerInput)
+{
+    const std::bitset<256>& recordedKeys = GetRecordedKeys();
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        if (recordedKeys[i] &&
+            (playerInput.IsKeyPressed(asciiKeyToSDL[i]) != input.keysPressed[i] ||
+             playerInput.IsKeyJustPressed(asciiKeyToSDL[i]) != input.keysJustPressed[i]))
+        {
+            playerInput.SetKeyState((uint8_t)i, input.keysPressed[i], input.keysJustPressed[i]);
+        }
+    }
+
+    for (uint8_t i = 0; i < NumberOfMouseButtons; i++)
+    {
+        playerInput.SetMouseButtonState(i, (input.buttonsPressed & (1 << i)) != 0, (input.buttonsJustPressed & (1 << i)) != 0);
+    }
+
+    playerInput.SetMouseXPos(input.mouseX);
+    playerInput.SetMouseYPos(input.mouseY);
+    playerInput.SetHasFocus(input.hasFocus);
+}
+
+// FNV-1a hash of the given data.
+uint64_t Demo::GetChecksum(const std::string& data)
+{
+    uint64_t checksum = 14695981039346656037ULL;
+    for (const char c : data)
+    {
+        checksum ^= (uint8_t)c;
+        checksum *= 1099511628211ULL;
+    }
+
+    return checksum;
+}
+
+void Demo::WriteVarInt(const uint32_t value)
+{
+    uint32_t remainingValue = value;
+    while (remainingValue >= 0x80)
+    {
+        m_frames.push_back((uint8_t)(remainingValue | 0x80));
+        remainingValue >>= 7;
+    }
+    m_frames.push_back((uint8_t)remainingValue);
+}
+
+bool Demo::ReadVarInt(size_t& position, uint32_t& value) const
+{
+    value = 0;
+    uint8_t shift = 0;
+    while (position < m_frames.size() && shift < 35)
+    {
+        const uint8_t byte = m_frames.at(position++);
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+        shift += 7;
+    }
+
+    return false;
+}
+
+void Demo::WriteKeys(const std::bitset<256>& keys)
+{
+    WriteVarInt((uint32_t)keys.count());
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        if (keys[i])
+        {
+            m_frames.push_back((uint8_t)i);
+        }
+    }
+}
+
+bool Demo::ReadKeys(size_t& position, std::bitset<256>& keys) const
+{
+    uint32_t numberOfKeys = 0;
+    if (!ReadVarInt(position, numberOfKeys) || position + numberOfKeys > m_frames.size())
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < numberOfKeys; i++)
+    {
+        keys[m_frames.at(position++)] = true;
+    }
+
+    return true;
+}
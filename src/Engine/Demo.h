@@ -0,0 +1,92 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// Demo
+//
+// Recording of a game session that can be played back exactly. It holds the state of the game at the start of a
+// level, including the random seed, followed by the time and the state of the player input of each frame. The frames
+// are delta encoded: a frame in which the input did not change takes a single byte. At the end of the recording a
+// checksum of the game state is stored, such that playback can verify that it ended up in the same state.
+//
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <bitset>
+#include <fstream>
+#include "PlayerInput.h"
+
+class Demo
+{
+public:
+    typedef struct
+    {
+        uint8_t gameId;
+        uint8_t difficultyLevel;
+        uint64_t randomSeed;
+        uint8_t mapIndex;
+        int16_t health;
+        bool godMode;
+        uint8_t mouseSensitivity;
+        bool mouseLook;
+        uint32_t timeToEnterLevel;
+        std::string inventory;
+    } demoStart;
+
+    typedef struct
+    {
+        std::bitset<256> keysPressed;
+        std::bitset<256> keysJustPressed;
+        uint8_t buttonsPressed;
+        uint8_t buttonsJustPressed;
+        int32_t mouseX;
+        int32_t mouseY;
+        bool hasFocus;
+    } demoInput;
+
+    Demo();
+    ~Demo();
+
+    void Clear();
+    void SetStart(const demoStart& start);
+    const demoStart& GetStart() const;
+    void AddFrame(const uint32_t timeDelta, const demoInput& input);
+    bool ReadFrame(size_t& position, uint32_t& timeDelta, demoInput& input) const;
+    uint32_t GetNumberOfFrames() const;
+    size_t GetSize() const;
+    void SetChecksum(const uint64_t checksum);
+    uint64_t GetChecksum() const;
+
+    bool StoreToFile(const std::string& filename) const;
+    bool LoadFromFile(const std::string& filename);
+
+    static void InitInput(demoInput& input);
+    static void CaptureInput(const PlayerInput& playerInput, demoInput& input);
+    static void ApplyInput(const demoInput& input, PlayerInput& playerInput);
+    static uint64_t GetChecksum(const std::string& data);
+
+private:
+    void WriteVarInt(const uint32_t value);
+    bool ReadVarInt(size_t& position, uint32_t& value) const;
+    void WriteKeys(const std::bitset<256>& keys);
+    bool ReadKeys(size_t& position, std::bitset<256>& keys) const;
+
+    demoStart m_start;
+    std::vector<uint8_t> m_frames;
+    uint32_t m_numberOfFrames;
+    demoInput m_lastInput;
+    uint64_t m_checksum;
+};
@@ -16,16 +16,22 @@
 #include "EgaGraph.h"
 #include "IRenderer.h"
 #include <fstream>
+#include <string.h>
 
 #include "Picture.h"
 #include "Font.h"
 #include "PictureTable.h"
 #include "SpriteTable.h"
+#include "PictureTrimmer.h"
 #include "LevelLocationNames.h"
 
 EgaGraph::EgaGraph(const egaGraphStaticData& staticData, const std::string& path, IRenderer& renderer) :
     m_staticData(staticData),
-    m_renderer(renderer)
+    m_renderer(renderer),
+    m_textureResidency(renderer, DefaultTextureBudget),
+    m_firstPictureEntry(0),
+    m_firstMaskedPictureEntry(0),
+    m_firstSpriteEntry(0)
 {
     // Initialize Huffman table
     m_huffman = new Huffman(m_staticData.table);
@@ -89,6 +95,11 @@ EgaGraph::EgaGraph(const egaGraphStaticData& staticData, const std::string& path
         m_sprites[i] = NULL;
     }
 
+    // Keep track of the memory used by the pictures, masked pictures and sprites
+    m_firstPictureEntry = m_textureResidency.AddSlots(m_pictures, m_pictureTable->GetCount());
+    m_firstMaskedPictureEntry = m_textureResidency.AddSlots(m_maskedPictures, m_maskedPictureTable->GetCount());
+    m_firstSpriteEntry = m_textureResidency.AddSlots(m_sprites, m_spriteTable->GetCount());
+
     // Initialize tiles
     m_tilesSize8Masked = NULL;
 
@@ -96,8 +107,8 @@ EgaGraph::EgaGraph(const egaGraphStaticData& staticData, const std::string& path
     m_font = NULL;
 
     // Initialize location names
-    m_worldLocationNames = new LevelLocationNames*[m_staticData.indexOfLastWorldLocationNames - m_staticData.indexOfFirstWorldLocationNames];
-    for (uint16_t i = 0; i < m_staticData.indexOfLastWorldLocationNames - m_staticData.indexOfFirstWorldLocationNames + 1; i++)
+    m_worldLocationNames = new LevelLocationNames*[GetNumberOfWorldLocationNames()];
+    for (uint16_t i = 0; i < GetNumberOfWorldLocationNames(); i++)
     {
         m_worldLocationNames[i] = NULL;
     }
@@ -135,7 +146,7 @@ EgaGraph::~EgaGraph()
     delete[] m_sprites;
     delete m_spriteTable;
 
-    for (uint16_t i = 0; i < m_staticData.indexOfLastWorldLocationNames - m_staticData.indexOfFirstWorldLocationNames; i++)
+    for (uint16_t i = 0; i < GetNumberOfWorldLocationNames(); i++)
     {
         if (m_worldLocationNames[i] != NULL)
         {
@@ -173,11 +184,21 @@ Picture* EgaGraph::GetPicture(const uint16_t index)
         uint32_t compressedSize = GetChunkSize(index) - sizeof(uint32_t);
         uint32_t uncompressedSize = *(uint32_t*)compressedPicture;
         FileChunk* pictureChunk = m_huffman->Decompress(&compressedPicture[sizeof(uint32_t)], compressedSize, uncompressedSize);
-        const uint32_t textureId = m_renderer.LoadFileChunkIntoTexture(pictureChunk, m_pictureTable->GetWidth(pictureIndex), m_pictureTable->GetHeight(pictureIndex), transparent);
-        m_pictures[pictureIndex] = new Picture(textureId, m_pictureTable->GetWidth(pictureIndex), m_pictureTable->GetHeight(pictureIndex));
+        if (transparent)
+        {
+            // Scaled pictures are drawn as billboards; their transparent borders are trimmed off.
+            m_pictures[pictureIndex] = LoadTrimmedPicture(pictureChunk, m_pictureTable->GetWidth(pictureIndex), m_pictureTable->GetHeight(pictureIndex), false, NULL);
+        }
+        else
+        {
+            const uint32_t textureId = m_renderer.LoadFileChunkIntoTexture(pictureChunk, m_pictureTable->GetWidth(pictureIndex), m_pictureTable->GetHeight(pictureIndex), transparent);
+            m_pictures[pictureIndex] = new Picture(textureId, m_pictureTable->GetWidth(pictureIndex), m_pictureTable->GetHeight(pictureIndex));
+        }
         delete pictureChunk;
+        m_textureResidency.SetResident(m_firstPictureEntry + pictureIndex);
     }
 
+    m_textureResidency.Touch(m_firstPictureEntry + pictureIndex);
     return m_pictures[pictureIndex]; 
 }
 
@@ -199,8 +220,10 @@ Picture* EgaGraph::GetMaskedPicture(const uint16_t index)
         const uint32_t textureId = m_renderer.LoadMaskedFileChunkIntoTexture(pictureChunk, m_maskedPictureTable->GetWidth(pictureIndex), height);
         m_maskedPictures[pictureIndex] = new Picture(textureId, m_maskedPictureTable->GetWidth(pictureIndex), height);
         delete pictureChunk;
+        m_textureResidency.SetResident(m_firstMaskedPictureEntry + pictureIndex);
     }
 
+    m_textureResidency.Touch(m_firstMaskedPictureEntry + pictureIndex);
     return m_maskedPictures[pictureIndex]; 
 }
 
@@ -218,11 +241,20 @@ Picture* EgaGraph::GetSprite(const uint16_t index)
         uint32_t compressedSize = GetChunkSize(index) - sizeof(uint32_t);
         uint32_t uncompressedSize = *(uint32_t*)compressedPicture;
         FileChunk* pictureChunk = m_huffman->Decompress(&compressedPicture[sizeof(uint32_t)], compressedSize, uncompressedSize);
-        const uint32_t textureId = m_renderer.LoadMaskedFileChunkIntoTexture(pictureChunk, m_spriteTable->GetWidth(pictureIndex), m_spriteTable->GetHeight(pictureIndex));
-        m_sprites[pictureIndex] = new Picture(textureId, m_spriteTable->GetWidth(pictureIndex), m_spriteTable->GetHeight(pictureIndex));
+        // The clipping rectangle in the sprite table has inclusive bounds
+        const pictureRect clippingRect =
+        {
+            m_spriteTable->GetClippingLeft(pictureIndex),
+            m_spriteTable->GetClippingTop(pictureIndex),
+            (uint16_t)(m_spriteTable->GetClippingRight(pictureIndex) + 1),
+            (uint16_t)(m_spriteTable->GetClippingBottom(pictureIndex) + 1)
+        };
+        m_sprites[pictureIndex] = LoadTrimmedPicture(pictureChunk, m_spriteTable->GetWidth(pictureIndex), m_spriteTable->GetHeight(pictureIndex), true, &clippingRect);
         delete pictureChunk;
+        m_textureResidency.SetResident(m_firstSpriteEntry + pictureIndex);
     }
 
+    m_textureResidency.Touch(m_firstSpriteEntry + pictureIndex);
     return m_sprites[pictureIndex]; 
 }
 
@@ -321,6 +353,14 @@ LevelLocationNames* EgaGraph::GetWorldLocationNames(const uint16_t index)
     return m_worldLocationNames[index];
 }
 
+void EgaGraph::LoadWorldLocationNames()
+{
+    for (uint16_t i = 0; i < GetNumberOfWorldLocationNames(); i++)
+    {
+        GetWorldLocationNames(i);
+    }
+}
+
 uint16_t EgaGraph::GetNumberOfWorldLocationNames() const
 {
     return m_staticData.indexOfLastWorldLocationNames - m_staticData.indexOfFirstWorldLocationNames + 1;
@@ -351,4 +391,51 @@ uint32_t EgaGraph::GetChunkSize(const uint16_t index)
 uint16_t EgaGraph::GetHandPictureIndex() const
 {
     return m_staticData.indexOfHandPicture;
-}
\ No newline at end of file
+}
+
+// Loads only the part of the picture that holds opaque pixels into a texture. If a clipping rectangle is given, it is
+// used as the trimmed rectangle, provided that it lies within the picture and holds all of its opaque pixels.
+Picture* EgaGraph::LoadTrimmedPicture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height, const bool masked, const pictureRect* clippingRect)
+{
+    pictureRect trimmedRect;
+    if (PictureTrimmer::GetOpaqueRect(decompressedChunk, width, height, masked, trimmedRect))
+    {
+        if (clippingRect != NULL &&
+            clippingRect->right <= width &&
+            clippingRect->bottom <= height &&
+            PictureTrimmer::ContainsRect(*clippingRect, trimmedRect))
+        {
+            trimmedRect = *clippingRect;
+        }
+
+        pictureRect textureRect;
+        FileChunk* croppedChunk = PictureTrimmer::Crop(decompressedChunk, width, height, masked, trimmedRect, textureRect);
+        if (croppedChunk != NULL)
+        {
+            const uint16_t textureWidth = textureRect.right - textureRect.left;
+            const uint16_t textureHeight = textureRect.bottom - textureRect.top;
+            const uint32_t textureId = masked ?
+                m_renderer.LoadMaskedFileChunkIntoTexture(croppedChunk, textureWidth, textureHeight) :
+                m_renderer.LoadFileChunkIntoTexture(croppedChunk, textureWidth, textureHeight, true);
+            delete croppedChunk;
+            return new Picture(textureId, width, height, textureRect, trimmedRect);
+        }
+    }
+
+    // Picture without any opaque pixels
+    const uint32_t textureId = masked ?
+        m_renderer.LoadMaskedFileChunkIntoTexture(decompressedChunk, width, height) :
+        m_renderer.LoadFileChunkIntoTexture(decompressedChunk, width, height, true);
+    return new Picture(textureId, width, height);
+}
+
+// Pictures that are evicted at the start of a frame are guaranteed not to be referenced anymore by the previous frame.
+void EgaGraph::BeginFrame()
+{
+    m_textureResidency.BeginFrame();
+}
+
+TextureResidency& EgaGraph::GetTextureResidency()
+{
+    return m_textureResidency;
+}
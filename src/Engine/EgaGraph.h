@@ -25,6 +25,7 @@
 #include <vector>
 #include "Huffman.h"
 #include "IRenderer.h"
+#include "TextureResidency.h"
 
 class Picture;
 class Font;
@@ -60,11 +61,20 @@ public:
     Picture* GetTilesSize8Masked();
     Font* GetFont(const uint16_t index);
     LevelLocationNames* GetWorldLocationNames(const uint16_t index);
+
+    // Decodes the location names of all levels, such that GetWorldLocationNames() no longer modifies the EgaGraph.
+    void LoadWorldLocationNames();
     uint16_t GetNumberOfWorldLocationNames() const;
     uint16_t GetHandPictureIndex() const;
 
+    void BeginFrame();
+    TextureResidency& GetTextureResidency();
+
+    static const uint32_t DefaultTextureBudget = 16 * 1024 * 1024;
+
 private:
     uint32_t GetChunkSize(const uint16_t index);
+    Picture* LoadTrimmedPicture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height, const bool masked, const pictureRect* clippingRect);
 
     const egaGraphStaticData& m_staticData;
 
@@ -80,5 +90,9 @@ private:
     Huffman* m_huffman;
     Font* m_font;
     IRenderer& m_renderer;
+    TextureResidency m_textureResidency;
+    uint32_t m_firstPictureEntry;
+    uint32_t m_firstMaskedPictureEntry;
+    uint32_t m_firstSpriteEntry;
 };
 
@@ -15,16 +15,18 @@
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
 
 #include "EngineCore.h"
-#include "..\..\ThirdParty\RefKeen\id_sd.h"
 #include "LevelLocationNames.h"
 #include <math.h>
 #include <fstream>
+#include <random>
+#include <sstream>
+#include <string.h>
 
 // TODO: These direct references to the Abyss game data will have to be refactored out in preparation of Armageddon support.
-#include "..\Abyss\AudioRepositoryAbyss.h"
-#include "..\Abyss\DecorateProjectiles.h"
-#include "..\Abyss\DecorateMonsters.h"
-#include "..\Abyss\DecorateBonus.h"
+#include "../Abyss/AudioRepositoryAbyss.h"
+#include "../Abyss/DecorateProjectiles.h"
+#include "../Abyss/DecorateMonsters.h"
+#include "../Abyss/DecorateBonus.h"
 
 const uint8_t versionMajor = 0;
 const uint8_t versionMinor = 1;
@@ -45,50 +47,96 @@ const uint8_t VictoryStatePlayGetPoint = 10;
 const uint8_t VictoryStatePlayingGetPoint = 11;
 const uint8_t VictoryStateDone = 12;
 
+const uint8_t StatusBarLayerId = 0;
+const uint8_t LevelCacheCapacity = 8;
+
+static uint64_t GenerateRandomSeed()
+{
+    std::random_device randomDevice;
+    return ((uint64_t)randomDevice() << 32u) | randomDevice();
+}
+
 EngineCore::EngineCore(IGame& game, const ISystem& system, PlayerInput& keyboardInput) :
-    m_gameTimer(),
     m_game(game),
-    m_system(system),
-    m_level(NULL),
-    m_readingScroll(255),
-    m_takingChest(false),
-    m_warpToLevel(0),
     m_timeStampOfPlayerCurrentFrame(0),
     m_timeStampOfPlayerPreviousFrame(0),
     m_timeStampOfWorldCurrentFrame(0),
     m_timeStampOfWorldPreviousFrame(0),
-    m_state(Introduction),
+    m_level(NULL),
+    m_playerInventory(game.GetAudioPlayer()),
     m_difficultyLevel(Easy),
-    m_statusMessage(NULL),
-    m_timeStampEndOfStatusMessage(0),
-    m_warpCheatTextField(""),
     m_godModeIsOn(false),
+    m_randomSeed(0),
+    m_aiRandom(),
+    m_effectsRandom(),
+    m_itemsRandom(),
+    m_hasRandomSeedForNewGame(false),
+    m_randomSeedForNewGame(0),
+    m_numberOfTicks(0),
+    m_playerInput(keyboardInput),
+    m_keyToTake(KeyId::NoKey),
     m_victoryState(VictoryStatePlayGetBolt),
-    m_lastFreezeTimeTick(0),
-    m_playerInventory(game.GetAudioPlayer()),
+    m_state(Introduction),
+    m_statusMessage(NULL),
+    m_actorsOnPath(),
+    m_statusBarLayer(StatusBarLayerId, 0, 120, 320, 80),
+    m_readingScroll(255),
+    m_takingChest(false),
+    m_warpToLevel(0),
+    m_warpCheatTextField(""),
     m_playerActions(),
+    m_lastFreezeTimeTick(0),
+    m_timeStampEndOfStatusMessage(0),
     m_startTakeKey(0),
     m_timeStampToEnterGame(0),
     m_timeStampLastMouseMoveForward(0),
     m_timeStampLastMouseMoveBackward(0),
-    m_keyToTake(KeyId::NoKey),
-    m_playerInput(keyboardInput),
+    m_extraMenu(m_configurationSettings, *(m_game.GetAudioPlayer()), m_savedGames),
+    m_gameTimer(),
+    m_system(system),
     m_savedGames(),
-    m_extraMenu(m_configurationSettings, *(m_game.GetAudioPlayer()), m_savedGames)
+    m_levelCache(LevelCacheCapacity),
+    m_levelPreloader(game),
+    m_clock(&m_gameTimer.GetClock()),
+    m_frameClock(m_clock->GetMilliseconds()),
+    m_timeStampOfSourceFrame(m_frameClock.GetMilliseconds()),
+    m_timeStampOfLevelStart(0),
+    m_levelStarted(false),
+    m_demoMode(DemoOff),
+    m_demo(),
+    m_demoPosition(0),
+    m_demoPlaybackMatchesRecording(false),
+    m_mouseSensitivityBeforeDemo(0),
+    m_mouseLookBeforeDemo(false),
+    m_demoFilename()
 {
-    _sprintf_p(m_messageInPopup, 256, "");
+    m_messageInPopup[0] = '\0';
+    Demo::InitInput(m_demoInput);
+    m_gameTimer.SetClock(m_frameClock);
     m_gameTimer.Reset();
+
+    // The location names are looked up by the simulation, while the render thread decodes pictures from the same
+    // EgaGraph. Decoding them before the threads start leaves the pictures as the only lazily decoded data.
+    m_game.GetEgaGraph()->LoadWorldLocationNames();
     const std::string filenamePath = m_system.GetConfigurationFilePath();
     const std::string filename = filenamePath + "CatacombGL.ini";
     m_configurationSettings.LoadFromFile(filename);
     const std::string savedGamesAbyssPath = filenamePath + "\\Abyss";
     m_system.GetSavedGameNamesFromFolder(savedGamesAbyssPath, m_savedGames);
+    m_demoFilename = savedGamesAbyssPath + "\\demo.dem";
 }
 
 EngineCore::~EngineCore()
 {
     StoreConfigurationToFile();
 
+    // A recording that is still running when the game ends is kept.
+    if (m_demoMode == DemoRecording)
+    {
+        StopDemoRecordingOrPlayback();
+        StoreDemoToFile();
+    }
+
     UnloadLevel();
 }
 
@@ -105,12 +153,28 @@ void EngineCore::LoadLevel(const uint8_t mapIndex)
     // The playerActor will be unloaded and reloaded in the next map. The health of the playerActor
     // must be preserved when transfering to the next map.
     const int16_t health = (m_level == NULL) ? 100 : m_level->GetPlayerActor()->GetHealth();
-    UnloadLevel();
+    Level* level = m_levelPreloader.Take(mapIndex, m_difficultyLevel);
+    if (level != NULL)
+    {
+        // Decoded and spawned in the background while the gate exit was being confirmed.
+        m_levelCache.StoreLevel(*level, m_difficultyLevel);
+    }
+    else
+    {
+        level = m_levelCache.GetLevel(mapIndex, m_difficultyLevel);
+    }
 
-    m_level = m_game.GetGameMaps()->GetLevelFromStart(mapIndex);
-    m_level->GetPlayerActor()->SetHealth(health);
+    if (level == NULL)
+    {
+        level = m_game.GetGameMaps()->GetLevelFromStart(mapIndex);
+        Random spawnRandom = GetSpawnRandom(mapIndex);
+        m_game.SpawnActors(level, m_difficultyLevel, spawnRandom);
+        m_levelCache.StoreLevel(*level, m_difficultyLevel);
+    }
 
-    m_game.SpawnActors(m_level, m_difficultyLevel);
+    UnloadLevel();
+    m_level = level;
+    m_level->GetPlayerActor()->SetHealth(health);
 
     m_timeStampOfPlayerCurrentFrame = 0;
     m_timeStampOfPlayerPreviousFrame = 0;
@@ -119,7 +183,11 @@ void EngineCore::LoadLevel(const uint8_t mapIndex)
     m_timeStampLastMouseMoveForward = 0;
     m_timeStampLastMouseMoveBackward = 0;
     m_gameTimer.Reset();
+    m_timeStampOfLevelStart = m_gameTimer.GetActualTime();
+    m_levelStarted = true;
+    m_fixedTimeStep.Reset();
     m_playerActions.ResetForNewLevel();
+    SeedRandomStreams(mapIndex);
     if (m_difficultyLevel == Easy)
     {
         DisplayStatusMessage("*** NOVICE ***", 3000);
@@ -133,239 +201,194 @@ void EngineCore::LoadLevel(const uint8_t mapIndex)
 
 void EngineCore::DrawScene(IRenderer& renderer)
 {
-    if (m_level == NULL)
-    {
-        renderer.SetPlayerAngle(0.0f);
-        renderer.SetPlayerPosition(0.0f, 0.0f);
-    }
-    else
-    {
-        renderer.SetPlayerAngle(m_level->GetPlayerActor()->GetAngle());
-        renderer.SetPlayerPosition(m_level->GetPlayerActor()->GetX(), m_level->GetPlayerActor()->GetY());
-    }
+    // Draw the most recent snapshot that was published by the simulation. The level is not accessed while drawing.
+    m_worldSnapshots.Acquire();
+    const WorldSnapshot& snapshot = m_worldSnapshots.GetReadBuffer();
+    const State state = (State)snapshot.engineState;
 
-    renderer.SetVSync(m_configurationSettings.GetVSync());
+    // Textures that were not drawn recently are unloaded when over budget.
+    m_game.GetEgaGraph()->BeginFrame();
 
-    m_framesCounter.AddFrame(m_gameTimer.GetActualTime());
-    renderer.SetTextureFilter(m_configurationSettings.GetTextureFilter());
+    renderer.SetPlayerAngle(snapshot.playerAngle);
+    renderer.SetPlayerPosition(snapshot.playerX, snapshot.playerY);
 
-    renderer.Prepare3DRendering(m_configurationSettings.GetDepthShading(), aspectRatios[m_configurationSettings.GetAspectRatio()].ratio, m_configurationSettings.GetFov());
+    renderer.SetVSync(snapshot.vSync);
 
-    if (m_readingScroll == 255 && (m_state == InGame || m_state == WarpCheatDialog || m_state == GodModeCheatDialog || m_state == FreeItemsCheatDialog || (m_state == Victory && m_victoryState != VictoryStateDone) || m_state == VerifyGateExit))
-    {
-        m_level->DrawFloorAndCeiling(renderer, m_timeStampOfWorldCurrentFrame);
-         
-        m_level->DrawWalls(renderer, m_game.GetEgaGraph(), m_gameTimer.GetTicksForWorld());
+    m_framesCounter.AddFrame(snapshot.actualTime);
+    renderer.SetTextureFilter(snapshot.textureFilter);
 
+    renderer.Prepare3DRendering(snapshot.depthShading, snapshot.aspectRatio, snapshot.fov);
+
+    if (snapshot.showWorld)
+    {
+        snapshot.DrawWorld(renderer, m_game.GetEgaGraph(), m_spriteQueue);
 #ifdef DRAWVISIBILITYMAP
-        m_level->DrawVisibilityMap(renderer);
+        snapshot.DrawVisibilityMap(renderer);
 #endif
-        m_level->DrawActors(renderer, m_game.GetEgaGraph());
     }
 
     renderer.Prepare2DRendering();
 
-    if (m_state == InGame)
+    if (state == InGame)
     {
-        if (m_readingScroll != 255)
+        if (snapshot.readingScroll != 255)
         {
             // Read scroll
             renderer.Render2DBar(0,0,320,120,EgaBlack);
             renderer.Render2DPicture(m_game.GetEgaGraph()->GetPicture(SCROLLTOPPIC), 80, 0);
-            renderer.Render2DPicture(m_game.GetEgaGraph()->GetPicture(SCROLL1PIC + m_readingScroll), 80, 32);
+            renderer.Render2DPicture(m_game.GetEgaGraph()->GetPicture(SCROLL1PIC + snapshot.readingScroll), 80, 32);
             renderer.Render2DPicture(m_game.GetEgaGraph()->GetPicture(SCROLLBOTTOMPIC), 80, 88);
         }
         else
         {
-            renderer.Render2DPicture(m_game.GetEgaGraph()->GetMaskedPicture(m_game.GetEgaGraph()->GetHandPictureIndex()), 120, 120 - m_playerActions.GetHandHeight()/*50*/);
-                    
-#ifdef DRAWTILEINFO
-            char tileStr[40];
-            sprintf_s(tileStr, 40, "tile: %d", m_level->GetFloorTile((uint16_t)GetPlayerState()->GetX(), (uint16_t)GetPlayerState()->GetY()));
-            renderer.RenderTextLeftAligned(tileStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,2,2);
-            sprintf_s(tileStr, 40, "wall: %d", m_level->GetWallTile((uint16_t)GetPlayerState()->GetX(), (uint16_t)GetPlayerState()->GetY()));
-            renderer.RenderTextLeftAligned(tileStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,2,12);
-            sprintf_s(tileStr, 40, "X: %d Y: %d Angle: %d", (uint16_t)GetPlayerState()->GetX(), (uint16_t)GetPlayerState()->GetY(), (uint16_t)GetPlayerState()->GetAngle());
-            renderer.RenderTextLeftAligned(tileStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,2,22);
-            sprintf_s(tileStr, 40, "MouseX: %d", m_playerControls.GetMouseXPos());
-            renderer.RenderTextLeftAligned(tileStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,2,32);
-#endif
+            renderer.Render2DPicture(m_game.GetEgaGraph()->GetMaskedPicture(m_game.GetEgaGraph()->GetHandPictureIndex()), 120, 120 - snapshot.handHeight/*50*/);
         }
 
-        if (m_configurationSettings.GetShowFps())
+        if (snapshot.showFps)
         {
             char fpsStr[10];
-            sprintf_s(fpsStr, 10, "%d", m_framesCounter.GetFramesPerSecond());
+            snprintf(fpsStr, 10, "%d", m_framesCounter.GetFramesPerSecond());
             renderer.RenderTextLeftAligned(fpsStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,280,2);
         }
     }
-    std::string locationMessage("");
-    if (m_state == InGame || m_state == Victory || m_state == VerifyGateExit)
+
+    if (state == InGame || state == EnteringLevel || state == WarpCheatDialog || state == GodModeCheatDialog || state == FreeItemsCheatDialog || state == Victory || state == VerifyGateExit || state == ExitGame)
     {
-        if (m_level->GetPlayerActor()->IsDead() ||
-            ((m_state == Victory) && (m_victoryState == VictoryStateDone)))
-        {
-            locationMessage = "Press ESC to open the menu.";
-        }
-        else if (m_state == VerifyGateExit)
+        // The status bar, including the radar background, is only rendered again when any of its content changed.
+        const uint32_t inventoryHash = snapshot.playerInventory.GetHash();
+        m_statusBarLayer.ResetHash();
+        m_statusBarLayer.AddToHash(&snapshot.playerHealth, sizeof(snapshot.playerHealth));
+        m_statusBarLayer.AddToHash(&inventoryHash, sizeof(inventoryHash));
+        m_statusBarLayer.AddToHash(snapshot.locationMessage);
+        if (!m_statusBarLayer.RenderIfUnchanged(renderer))
         {
-            locationMessage = "Pass this way?      Y/N";
+            m_game.DrawStatusBar(snapshot.playerHealth, snapshot.locationMessage, snapshot.playerInventory);
+            m_statusBarLayer.Capture(renderer);
         }
-        else if (m_readingScroll != 255)
-        {
-            // The original game also gave the option to close the scroll via ESC, but CatacombGL has ESC reserved for the new menu.
-            locationMessage = "Press ENTER to exit.";
-        }
-        else
-        {
-            const uint16_t floorTile = m_level->GetWallTile((uint16_t)(m_level->GetPlayerActor()->GetX()), (uint16_t)(m_level->GetPlayerActor()->GetY()));
-            if (floorTile > 180 && m_level->GetLevelIndex() < m_game.GetEgaGraph()->GetNumberOfWorldLocationNames())
-            {
-                locationMessage = m_game.GetEgaGraph()->GetWorldLocationNames(m_level->GetLevelIndex())->GetLocationName(floorTile - 180);
-            }
-        }
-    }
-
-    if (m_state == InGame || m_state == EnteringLevel || m_state == WarpCheatDialog || m_state == GodModeCheatDialog || m_state == FreeItemsCheatDialog || m_state == Victory || m_state == VerifyGateExit || m_state == ExitGame)
-    {
-        const int16_t playerHealth = (m_level != 0) ? m_level->GetPlayerActor()->GetHealth() : 100;
-        m_game.DrawStatusBar(playerHealth, locationMessage, m_playerInventory);
 
-        if (m_state != Victory)
+        if (state != Victory)
         {
-            const int32_t remainingFreezeTime = m_gameTimer.GetRemainingFreezeTime();
-            const int32_t remainingFreezeTimeInSec = remainingFreezeTime / 1000;
-            if (remainingFreezeTimeInSec != m_lastFreezeTimeTick)
-            {
-                m_lastFreezeTimeTick = remainingFreezeTimeInSec;
-                if (m_lastFreezeTimeTick == 0)
-                {
-                    m_game.GetAudioPlayer()->Play(TIMERETURNSND);
-                }
-                else if (m_lastFreezeTimeTick < 20)
-                {
-                    m_game.GetAudioPlayer()->Play(TICKSND);
-                }
-            }
-            char freezeMessage[100];
-            sprintf_s(freezeMessage, "Time Stopped: %d", remainingFreezeTimeInSec);
-            const char* statusMessage = (m_statusMessage != NULL) ? m_statusMessage : (remainingFreezeTime != 0) ? freezeMessage : m_playerActions.GetStatusMessage();
-            renderer.RenderTextCentered(statusMessage, m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow, 156, 189);
+            renderer.RenderTextCentered(snapshot.statusMessage.c_str(), m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow, 156, 189);
 
             // Radar
-            if (m_state == InGame || m_state == WarpCheatDialog || m_state == GodModeCheatDialog || m_state == FreeItemsCheatDialog || m_state == VerifyGateExit)
+            if (state == InGame || state == WarpCheatDialog || state == GodModeCheatDialog || state == FreeItemsCheatDialog || state == VerifyGateExit)
             {
                 const float radarCenterX = (31 * 8) + (51 / 2) + 2;
                 const float radarCenterY = (200 - 11 - 8) - (51 / 2) - 2;
                 const float radarXRadius = 113.0f / 5.0f;
                 const float radarYRadius = 113.0f / 7.0f;
-                const float northIconoffsetFromCenterX = -(radarXRadius * sin(m_level->GetPlayerActor()->GetAngle() * 3.14159265f / 180.0f));
-                const float northIconoffsetFromCenterY = -(radarYRadius * cos(m_level->GetPlayerActor()->GetAngle() * 3.14159265f / 180.0f));
+                const float northIconoffsetFromCenterX = -(radarXRadius * sin(snapshot.playerAngle * 3.14159265f / 180.0f));
+                const float northIconoffsetFromCenterY = -(radarYRadius * cos(snapshot.playerAngle * 3.14159265f / 180.0f));
                 const uint16_t northIconScreenOffsetX = (uint16_t)(radarCenterX + northIconoffsetFromCenterX - 3);
                 const uint16_t northIconScreenOffsetY = (uint16_t)(radarCenterY + northIconoffsetFromCenterY - 3);
                 renderer.Render2DPicture(m_game.GetEgaGraph()->GetSprite(NORTHICONSPR), northIconScreenOffsetX, northIconScreenOffsetY);
                 renderer.RenderRadarBlip(radarCenterX, radarCenterY, EgaBrightWhite);
 
-                for (uint16_t blipIndex = 0; blipIndex < m_radarModel.GetNumberOfBlips(); blipIndex++)
+                for (uint16_t blipIndex = 0; blipIndex < snapshot.radar.GetNumberOfBlips(); blipIndex++)
                 {
-                    const radarBlip blip = m_radarModel.GetRadarBlip(blipIndex);
+                    const radarBlip blip = snapshot.radar.GetRadarBlip(blipIndex);
                     renderer.RenderRadarBlip(radarCenterX + blip.offsetX, radarCenterY + blip.offsetY, blip.color);
                 }
             }
         }
     }
     
-    if ( m_state == EnteringLevel)
+    if (state == EnteringLevel)
     {
         renderer.Render2DBar(0,0,320,120,EgaBlack);
-        uint16_t width = (uint16_t)strlen(m_level->GetLevelName());
+        uint16_t width = (uint16_t)snapshot.levelName.length();
         if (width < 20)
         {
             width = 20;
         }
         DrawCenteredTiledWindow(renderer, width, 5);
         renderer.RenderTextCentered("You have arrived at", m_game.GetEgaGraph()->GetFont(3), EgaDarkGray, 160, 49);
-        renderer.RenderTextCentered(m_level->GetLevelName(), m_game.GetEgaGraph()->GetFont(3), EgaDarkGray, 160, 58);
+        renderer.RenderTextCentered(snapshot.levelName.c_str(), m_game.GetEgaGraph()->GetFont(3), EgaDarkGray, 160, 58);
     }
 
-    if (m_state == InGame)
+    if (state == InGame)
     {
-        if (_strcmpi(m_messageInPopup, "") != 0)
+        if (!snapshot.messageInPopup.empty())
         {
             DrawCenteredTiledWindow(renderer, 20, 4);
-            renderer.RenderTextCentered(m_messageInPopup, m_game.GetEgaGraph()->GetFont(3), EgaDarkGray, 160, 49);
+            renderer.RenderTextCentered(snapshot.messageInPopup.c_str(), m_game.GetEgaGraph()->GetFont(3), EgaDarkGray, 160, 49);
         }
     }
 
-    if (m_state == WarpCheatDialog)
+    if (state == WarpCheatDialog)
     {
         DrawCenteredTiledWindow(renderer, 26, 3);
         const uint8_t lastLevel = m_game.GetGameMaps()->GetNumberOfLevels() - 1;
-        const std::string warpText = "Warp to which level(0-" + std::to_string(lastLevel) + "):" + m_warpCheatTextField;
+        const std::string warpText = "Warp to which level(0-" + std::to_string(lastLevel) + "):" + snapshot.warpCheatText;
         renderer.RenderTextLeftAligned(warpText.c_str(), m_game.GetEgaGraph()->GetFont(3), EgaDarkGray, 70, 56);
     }
 
-    if (m_state == GodModeCheatDialog)
+    if (state == GodModeCheatDialog)
     {
         DrawCenteredTiledWindow(renderer, 12, 2);
-        const std::string godModeText = m_godModeIsOn ? "God mode ON" : "God mode OFF";
+        const std::string godModeText = snapshot.godModeIsOn ? "God mode ON" : "God mode OFF";
         renderer.RenderTextCentered(godModeText.c_str(), m_game.GetEgaGraph()->GetFont(3), EgaDarkGray, 160, 52);
     }
 
-    if (m_state == FreeItemsCheatDialog)
+    if (state == FreeItemsCheatDialog)
     {
         DrawCenteredTiledWindow(renderer, 12, 2);
         renderer.RenderTextCentered("Free items!", m_game.GetEgaGraph()->GetFont(3), EgaDarkGray, 160, 52);
     }
 
-    if (m_level != NULL && m_level->GetPlayerActor()->IsDead() && m_playerInventory.GetPotions() > 0)
+    if (snapshot.playerIsDead && snapshot.playerInventory.GetPotions() > 0)
     {
         DrawCenteredTiledWindow(renderer, 35, 3);
         renderer.RenderTextCentered("You should use your Cure Potions wisely", m_game.GetEgaGraph()->GetFont(3), EgaDarkGray, 160, 56);
     }
 
-    if (m_state == Victory && m_victoryState == VictoryStateDone)
+    if (state == Victory && snapshot.victoryState == VictoryStateDone)
     {
         renderer.Render2DPicture(m_game.GetEgaGraph()->GetPicture(FINALEPIC), 0, 0);
     }
     
-    if (m_state == Introduction)
+    if (state == Introduction)
     {
-        m_game.GetIntroView()->DrawIntroduction(m_timeStampOfPlayerCurrentFrame);
+        m_game.GetIntroView()->DrawIntroduction(snapshot.timeStampOfPlayer);
     }
-    if (m_state == RequestDifficultyLevel)
+    if (state == RequestDifficultyLevel)
     {
         m_game.GetIntroView()->DrawRequestDifficultyLevel();
     }
-    if (m_state == ShowDifficultyLevel && m_difficultyLevel == Easy)
+    if (state == ShowDifficultyLevel && snapshot.difficultyLevel == Easy)
     {
         m_game.GetIntroView()->DrawNoviceSelected();
     }
-    if (m_state == ShowDifficultyLevel && m_difficultyLevel == Hard)
+    if (state == ShowDifficultyLevel && snapshot.difficultyLevel == Hard)
     {
         m_game.GetIntroView()->DrawWarriorSelected();
     }
-    if (m_state == StandBeforeGate)
+    if (state == StandBeforeGate)
     {
         m_game.GetIntroView()->DrawStandBeforeGate();
     }
 
 #ifdef DRAWTIME
     char ticsStr[40];
-    sprintf_s(ticsStr, 40, "tics (player): %d", m_gameTimer.GetTicksForPlayer());
-    renderer->RenderTextLeftAligned(ticsStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,2,2);
-    sprintf_s(ticsStr, 40, "tics (world): %d", m_gameTimer.GetTicksForWorld());
-    renderer->RenderTextLeftAligned(ticsStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,150,2);
-    sprintf_s(ticsStr, 40, "msec (player): %d", m_gameTimer.GetMillisecondsForPlayer());
-    renderer->RenderTextLeftAligned(ticsStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,2,12);
-    sprintf_s(ticsStr, 40, "msec (world): %d", m_gameTimer.GetMilliSecondsForWorld());
-    renderer->RenderTextLeftAligned(ticsStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,150,12);
+    snprintf(ticsStr, 40, "tics (player): %d", snapshot.timeStampOfPlayer / 14);
+    renderer.RenderTextLeftAligned(ticsStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,2,2);
+    snprintf(ticsStr, 40, "tics (world): %d", snapshot.timeStampOfWorld / 14);
+    renderer.RenderTextLeftAligned(ticsStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,150,2);
+    snprintf(ticsStr, 40, "msec (player): %d", snapshot.timeStampOfPlayer);
+    renderer.RenderTextLeftAligned(ticsStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,2,12);
+    snprintf(ticsStr, 40, "msec (world): %d", snapshot.timeStampOfWorld);
+    renderer.RenderTextLeftAligned(ticsStr,m_game.GetEgaGraph()->GetFont(3), EgaBrightYellow,150,12);
 #endif
 
-    if (m_extraMenu.IsActive())
+    if (snapshot.menuActive)
     {
-        DrawTiledWindow(renderer,2,1,36,13);
-        m_extraMenu.Draw(renderer, m_game.GetEgaGraph());
+        // The menu is not part of the snapshot; it is drawn while the simulation is not processing input.
+        std::lock_guard<std::mutex> lock(m_menuMutex);
+        if (m_extraMenu.IsActive())
+        {
+            DrawTiledWindow(renderer,2,1,36,13);
+            m_extraMenu.Draw(renderer, m_game.GetEgaGraph());
+        }
     }
     
     renderer.Unprepare2DRendering();
@@ -428,6 +451,7 @@ void EngineCore::EnterKeyReleased()
             m_state = EnteringLevel;
             m_timeStampToEnterGame = m_gameTimer.GetActualTime() + 2000u;
             m_warpToLevel = 0;
+            SetRandomSeed(m_hasRandomSeedForNewGame ? m_randomSeedForNewGame : GenerateRandomSeed());
         }
         else if (m_state == WarpCheatDialog)
         {
@@ -454,7 +478,21 @@ void EngineCore::EnterKeyReleased()
     }
 }
 
+bool EngineCore::IsNewSnapshotAvailable() const
+{
+    return m_worldSnapshots.IsNewDataAvailable();
+}
+
 bool EngineCore::Think()
+{
+    std::lock_guard<std::mutex> lock(m_menuMutex);
+    AdvanceFrameClock();
+    const bool exitGame = ThinkFrame();
+    PublishSnapshot();
+    return exitGame;
+}
+
+bool EngineCore::ThinkFrame()
 {
     const uint32_t currentTimestampOfPlayer = m_gameTimer.GetMillisecondsForPlayer();
     const uint32_t currentTimestampOfWorld = m_gameTimer.GetMilliSecondsForWorld();
@@ -468,19 +506,12 @@ bool EngineCore::Think()
         return false;
     }
 
-    SDMode soundMode = SD_GetSoundMode();
-    if (m_configurationSettings.GetSoundMode() == 0 && soundMode != sdm_Off)
-    {
-        SD_SetSoundMode(sdm_Off);
-    }
-    if (m_configurationSettings.GetSoundMode() == 1 && soundMode != sdm_AdLib)
-    {
-        SD_SetSoundMode(sdm_AdLib);
-    }
+    m_game.GetAudioPlayer()->SetSoundMode(m_configurationSettings.GetSoundMode());
 
     if (m_extraMenu.IsActive())
     {
         m_extraMenu.SetSaveGameEnabled((m_state == InGame || m_state == WarpCheatDialog || m_state == GodModeCheatDialog || m_state == FreeItemsCheatDialog) && !m_level->GetPlayerActor()->IsDead());
+        m_extraMenu.SetDemoRecording(IsRecordingDemo());
         const MenuCommand command = m_extraMenu.ProcessInput(m_playerInput);
         if (command == MenuCommandStartNewGame)
         {
@@ -517,6 +548,31 @@ bool EngineCore::Think()
             LoadGameFromFile(saveGameName);
             return false;
         }
+        else if (command == MenuCommandRecordDemo)
+        {
+            StopDemoRecordingOrPlayback();
+            m_demo.Clear();
+            m_demoMode = DemoWaitingForLevelStart;
+            StartNewGame();
+        }
+        else if (command == MenuCommandStopDemoRecording)
+        {
+            const bool demoRecorded = (m_demoMode == DemoRecording);
+            StopDemoRecordingOrPlayback();
+            if (demoRecorded)
+            {
+                DisplayStatusMessage(StoreDemoToFile() ? "DEMO STORED" : "FAILED TO STORE DEMO", 2000);
+            }
+        }
+        else if (command == MenuCommandPlayDemo)
+        {
+            Demo demo;
+            if (!demo.LoadFromFile(m_demoFilename) || !PlayDemo(demo))
+            {
+                DisplayStatusMessage("NO DEMO TO PLAY", 2000);
+            }
+            return false;
+        }
     }
 
     if (m_state == InGame && !m_extraMenu.IsActive())
@@ -741,7 +797,7 @@ bool EngineCore::Think()
         case VictoryStatePlayingGetScroll:
         case VictoryStatePlayingGetPoint:
             {
-                if (!m_game.GetAudioPlayer()->IsPlaying())
+                if (!IsWaitingForSound())
                 {
                     m_victoryState++;
                 }
@@ -765,7 +821,7 @@ bool EngineCore::Think()
                 {
                     if (m_startTakeKey + 2000 < m_gameTimer.GetActualTime())
                     {
-                        _sprintf_p(m_messageInPopup, 256, "");
+                        m_messageInPopup[0] = '\0';
                         m_playerInventory.TakeKey(m_keyToTake);
                         m_gameTimer.Resume();
                         m_startTakeKey = 0;
@@ -776,150 +832,45 @@ bool EngineCore::Think()
                 {
                     m_startTakeKey = m_gameTimer.GetActualTime();
                     m_gameTimer.Pause();
-                    _sprintf_p(m_messageInPopup, 256, "You use a %s key", GetKeyName((KeyId)m_keyToTake));
+                    snprintf(m_messageInPopup, 256, "You use a %s key", GetKeyName((KeyId)m_keyToTake));
                     m_game.GetAudioPlayer()->Play(USEKEYSND);
                 }   
             }
 
-            if (_strcmpi(m_messageInPopup, "") != 0)
+            if (strcmp(m_messageInPopup, "") != 0)
             {
                 if (m_startTakeKey == 0 && m_playerActions.GetAnyKeyWasPressed())
                 {
-                    _sprintf_p(m_messageInPopup, 256, "");
+                    m_messageInPopup[0] = '\0';
                     m_gameTimer.Resume();
                     m_playerActions.SetAnyKeyIsPressed(false);
                 }
             }
 
-            if (m_timeStampOfPlayerCurrentFrame > m_timeStampOfPlayerPreviousFrame)
+            // Simulate the world in fixed ticks, independent of the frame rate. Stop as soon as the game gets paused,
+            // the player dies or leaves the level.
+            m_fixedTimeStep.SetTime(m_timeStampOfPlayerCurrentFrame);
+            while (m_state == InGame && !m_gameTimer.IsPaused() && !m_level->GetPlayerActor()->IsDead() &&
+                   m_level->GetLevelIndex() == m_warpToLevel && m_fixedTimeStep.RunNextTick())
             {
-                if (m_playerActions.UpdateShoot(m_timeStampOfPlayerCurrentFrame))
-                {
-                    const auto decorateProjectilePair = m_game.GetDecorateActors().find(m_level->GetPlayerActor()->GetDecorateActor().projectileId);
-                    if (decorateProjectilePair != m_game.GetDecorateActors().end())
-                    {
-                        Actor* projectile = new Actor(m_level->GetPlayerActor()->GetX(), m_level->GetPlayerActor()->GetY(), m_timeStampOfPlayerCurrentFrame, decorateProjectilePair->second);
-                        projectile->SetAngle(m_level->GetPlayerActor()->GetAngle());
-                        projectile->SetActive(true);
-                        m_level->AddNonBlockingActor(projectile);
-                    }
+                m_timeStampOfPlayerCurrentFrame = m_fixedTimeStep.GetTimeStampOfTick();
+                m_timeStampOfWorldCurrentFrame = m_gameTimer.GetMilliSecondsForWorld(m_timeStampOfPlayerCurrentFrame);
+                m_level->StartTick(m_timeStampOfWorldCurrentFrame);
+                m_level->StorePreviousActorPositions();
+                m_numberOfTicks++;
 
-                    m_game.GetAudioPlayer()->Play(SHOOTSND);
-                }
-                if (m_playerActions.IsReadyToShootBolt(m_timeStampOfPlayerCurrentFrame))
-                {
-                    if (m_playerInventory.TakeBolt())
-                    {
-                        m_playerActions.ShootBolt(m_timeStampOfPlayerCurrentFrame);
-                        m_game.GetAudioPlayer()->Play(USEBOLTSND);
-                    }
-                    else
-                    {
-                        m_game.GetAudioPlayer()->Play(NOITEMSND);
-                    }
-                }
+                ThinkPlayer();
 
-                if (m_playerActions.UpdateContinueBolt(m_timeStampOfPlayerCurrentFrame))
-                {
-                    const auto decorateProjectilePair = m_game.GetDecorateActors().find(m_level->GetPlayerActor()->GetDecorateActor().projectileId);
-                    if (decorateProjectilePair != m_game.GetDecorateActors().end())
-                    {
-                        Actor* projectile = new Actor(m_level->GetPlayerActor()->GetX(), m_level->GetPlayerActor()->GetY(), m_timeStampOfWorldCurrentFrame, decorateProjectilePair->second);
-                        projectile->SetAngle(m_level->GetPlayerActor()->GetAngle());
-                        projectile->SetActive(true);
-                        m_level->AddNonBlockingActor(projectile);
-                    }
-                }             
-           
-                if (m_playerActions.UpdateShootNuke(m_timeStampOfPlayerCurrentFrame))
-                {
-                    if (m_playerInventory.TakeNuke())
-                    {
-                        m_game.GetAudioPlayer()->Play(USENUKESND);
+                m_level->UpdateVisibilityMap();
 
-                        const auto decorateProjectilePair = m_game.GetDecorateActors().find(m_level->GetPlayerActor()->GetDecorateActor().projectileId + 1);
-                        if (decorateProjectilePair != m_game.GetDecorateActors().end())
-                        {
-                            for (uint16_t i = 0; i < 16; i++)
-                            {
-                                Actor* projectile = new Actor(m_level->GetPlayerActor()->GetX(), m_level->GetPlayerActor()->GetY(), m_timeStampOfWorldCurrentFrame, decorateProjectilePair->second);
-                                projectile->SetAngle(i * 22.5f);
-                                projectile->SetActive(true);
-                                m_level->AddNonBlockingActor(projectile);
-                            }
-                        }
-                    }
-                    else
-                    {
-                        m_game.GetAudioPlayer()->Play(NOITEMSND);
-                    }
-                }
-                const float degreesPerTic = (m_playerActions.GetActionActive(QuickTurn)) ? 3.0f : 1.0f;
-                const uint32_t deltaTimeInMs = m_timeStampOfPlayerCurrentFrame - m_timeStampOfPlayerPreviousFrame;
-                const uint32_t truncatedDeltaTimeInMs = (deltaTimeInMs < 50) ? deltaTimeInMs : 50;
-                const float deltaTimeInTics = (truncatedDeltaTimeInMs * 60.0f) / 1000.0f;
-                if (m_playerActions.GetActionActive(TurnLeft))
-                {
-                    const float deltaDegrees = degreesPerTic * deltaTimeInTics;
-                    m_level->GetPlayerActor()->SetAngle(m_level->GetPlayerActor()->GetAngle() - deltaDegrees);
-                }
-                if (m_playerActions.GetActionActive(TurnRight))
-                {
-                    const float deltaDegrees = degreesPerTic * deltaTimeInTics;
-                    m_level->GetPlayerActor()->SetAngle(m_level->GetPlayerActor()->GetAngle() + deltaDegrees);
-                }
-                const float playerSpeed = 5120.0f / 65536.0f;
-                const float tics = ((float)(truncatedDeltaTimeInMs) / 1000.0f) * 60.0f;
-                const float distance = playerSpeed * tics;
-                if (m_playerActions.GetActionActive(MoveForward) && m_playerActions.GetActionActive(StrafeLeft))
-                { 
-                    Thrust(315, distance);
-                }
-                else if (m_playerActions.GetActionActive(MoveBackward) && m_playerActions.GetActionActive(StrafeLeft))
-                {
-                    Thrust(225, distance);
-                }
-                else if (m_playerActions.GetActionActive(MoveForward) && m_playerActions.GetActionActive(StrafeRight))
-                {
-                    Thrust(45, distance);
-                }
-                else if (m_playerActions.GetActionActive(MoveBackward) && m_playerActions.GetActionActive(StrafeRight))
-                {
-                    Thrust(135, distance);
-                }
-                else if (m_playerActions.GetActionActive(MoveForward))
-                {
-                    Thrust(0, distance);
-                }
-                else if (m_playerActions.GetActionActive(MoveBackward))
-                {
-                    Thrust(180, distance);
-                }
-                else if (m_playerActions.GetActionActive(StrafeLeft))
-                {
-                    Thrust(270, distance);
-                }
-                else if (m_playerActions.GetActionActive(StrafeRight))
-                {
-                    Thrust(90, distance);
-                }
-                if (m_playerInput.GetMouseXPos() != 0)
-                {
-                    const float mouseMovement = m_playerInput.GetMouseXPos() * (m_configurationSettings.GetMouseSensitivity() / 10.0f);
-                    m_level->GetPlayerActor()->SetAngle(m_level->GetPlayerActor()->GetAngle() + (mouseMovement * tics * (abs(mouseMovement / 30.0f))));
-                    m_playerInput.SetMouseXPos(0);
-                }
+                ThinkActors();
+                ThinkNonBlockingActors();
             }
-
-            m_level->UpdateVisibilityMap();
-
-            ThinkActors();
-            ThinkNonBlockingActors();
         }
 
         if (m_takingChest)
         {
-            if (!m_game.GetAudioPlayer()->IsPlaying())
+            if (!IsWaitingForSound())
             {
                 if (m_playerInventory.HasItemsInChest())
                 {
@@ -942,9 +893,10 @@ bool EngineCore::Think()
         // Update radar
         
         m_radarModel.ResetRadar(m_level->GetPlayerActor(), m_playerInventory, m_timeStampOfPlayerCurrentFrame);
-        const uint16_t mapSize = m_level->GetLevelWidth() * m_level->GetLevelHeight();
-        m_radarModel.AddActors((const Actor**)m_level->GetBlockingActors(), mapSize);
-        m_radarModel.AddActors((const Actor**)m_level->GetNonBlockingActors(), 100);
+        const std::vector<Actor*>& blockingActors = m_level->GetBlockingActors();
+        m_radarModel.AddActors((const Actor**)blockingActors.data(), (uint16_t)blockingActors.size());
+        const std::vector<Actor*>& nonBlockingActors = m_level->GetNonBlockingActors();
+        m_radarModel.AddActors((const Actor**)nonBlockingActors.data(), (uint16_t)nonBlockingActors.size());
 
         if (m_level->GetLevelIndex() != m_warpToLevel && m_state != VerifyGateExit && m_keyToTake == NoKey)
         {
@@ -958,26 +910,303 @@ bool EngineCore::Think()
     return false;
 }
 
-void EngineCore::ThinkActors()
+// Copies everything that is needed to draw the next frame into a snapshot and hands it over to the renderer.
+void EngineCore::PublishSnapshot()
 {
-    const uint16_t mapSize = m_level->GetLevelWidth() * m_level->GetLevelHeight();
-    for ( uint16_t i = 0; i < mapSize; i++)
+    WorldSnapshot& snapshot = m_worldSnapshots.GetWriteBuffer();
+    snapshot.ClearWorld();
+
+    snapshot.vSync = m_configurationSettings.GetVSync();
+    snapshot.textureFilter = m_configurationSettings.GetTextureFilter();
+    snapshot.depthShading = m_configurationSettings.GetDepthShading();
+    snapshot.aspectRatio = aspectRatios[m_configurationSettings.GetAspectRatio()].ratio;
+    snapshot.fov = m_configurationSettings.GetFov();
+    snapshot.showFps = m_configurationSettings.GetShowFps();
+
+    snapshot.engineState = (uint8_t)m_state;
+    snapshot.victoryState = m_victoryState;
+    snapshot.readingScroll = m_readingScroll;
+    snapshot.difficultyLevel = (uint8_t)m_difficultyLevel;
+    snapshot.godModeIsOn = m_godModeIsOn;
+    snapshot.menuActive = m_extraMenu.IsActive();
+    snapshot.timeStampOfPlayer = m_timeStampOfPlayerCurrentFrame;
+    snapshot.timeStampOfWorld = m_timeStampOfWorldCurrentFrame;
+    snapshot.actualTime = m_clock->GetMilliseconds();
+
+    snapshot.showWorld = false;
+    snapshot.playerIsDead = false;
+    snapshot.playerHealth = 100;
+    if (m_level == NULL)
+    {
+        snapshot.playerX = 0.0f;
+        snapshot.playerY = 0.0f;
+        snapshot.playerAngle = 0.0f;
+        snapshot.levelName.clear();
+    }
+    else
+    {
+        const float interpolation = m_fixedTimeStep.GetInterpolation();
+        const Actor* playerActor = m_level->GetPlayerActor();
+        snapshot.playerX = playerActor->GetInterpolatedX(interpolation);
+        snapshot.playerY = playerActor->GetInterpolatedY(interpolation);
+        snapshot.playerAngle = playerActor->GetInterpolatedAngle(interpolation);
+        snapshot.playerIsDead = playerActor->IsDead();
+        snapshot.playerHealth = playerActor->GetHealth();
+        snapshot.levelName = m_level->GetLevelName();
+
+        snapshot.showWorld = (m_readingScroll == 255 && (m_state == InGame || m_state == WarpCheatDialog || m_state == GodModeCheatDialog || m_state == FreeItemsCheatDialog || (m_state == Victory && m_victoryState != VictoryStateDone) || m_state == VerifyGateExit));
+        if (snapshot.showWorld)
+        {
+            m_level->AddFloorAndCeilingToSnapshot(snapshot, m_timeStampOfWorldCurrentFrame);
+            m_level->AddWallsToSnapshot(snapshot, m_gameTimer.GetTicksForWorld());
+            m_level->AddActorsToSnapshot(snapshot, interpolation);
+        }
+    }
+
+    snapshot.handHeight = m_playerActions.GetHandHeight();
+    snapshot.playerInventory = m_playerInventory;
+    snapshot.radar = m_radarModel;
+    snapshot.messageInPopup = m_messageInPopup;
+    snapshot.warpCheatText = m_warpCheatTextField;
+
+    snapshot.locationMessage.clear();
+    if ((m_state == InGame || m_state == Victory || m_state == VerifyGateExit) && m_level != NULL)
+    {
+        if (m_level->GetPlayerActor()->IsDead() ||
+            ((m_state == Victory) && (m_victoryState == VictoryStateDone)))
+        {
+            snapshot.locationMessage = "Press ESC to open the menu.";
+        }
+        else if (m_state == VerifyGateExit)
+        {
+            snapshot.locationMessage = "Pass this way?      Y/N";
+        }
+        else if (m_readingScroll != 255)
+        {
+            // The original game also gave the option to close the scroll via ESC, but CatacombGL has ESC reserved for the new menu.
+            snapshot.locationMessage = "Press ENTER to exit.";
+        }
+        else
+        {
+            const uint16_t floorTile = m_level->GetWallTile((uint16_t)(m_level->GetPlayerActor()->GetX()), (uint16_t)(m_level->GetPlayerActor()->GetY()));
+            if (floorTile > 180 && m_level->GetLevelIndex() < m_game.GetEgaGraph()->GetNumberOfWorldLocationNames())
+            {
+                snapshot.locationMessage = m_game.GetEgaGraph()->GetWorldLocationNames(m_level->GetLevelIndex())->GetLocationName(floorTile - 180);
+            }
+        }
+    }
+
+    snapshot.statusMessage.clear();
+    if ((m_state == InGame || m_state == EnteringLevel || m_state == WarpCheatDialog || m_state == GodModeCheatDialog || m_state == FreeItemsCheatDialog || m_state == VerifyGateExit || m_state == ExitGame))
     {
-        if (m_level->GetBlockingActors()[i] != NULL)
+        const int32_t remainingFreezeTime = m_gameTimer.GetRemainingFreezeTime();
+        const int32_t remainingFreezeTimeInSec = remainingFreezeTime / 1000;
+        if (remainingFreezeTimeInSec != m_lastFreezeTimeTick)
         {
-            if (!m_level->GetBlockingActors()[i]->IsActive() && m_level->IsTileVisibleForPlayer(i % m_level->GetLevelWidth(), i / m_level->GetLevelWidth()))
+            m_lastFreezeTimeTick = remainingFreezeTimeInSec;
+            if (m_lastFreezeTimeTick == 0)
             {
-                m_level->GetBlockingActors()[i]->SetActive(true);
+                m_game.GetAudioPlayer()->Play(TIMERETURNSND);
             }
-            if (m_level->GetBlockingActors()[i]->IsActive())
+            else if (m_lastFreezeTimeTick < 20)
             {
-                m_level->GetBlockingActors()[i]->Think(m_timeStampOfWorldCurrentFrame);
-                PerformActionOnActor(m_level->GetBlockingActors()[i]);
+                m_game.GetAudioPlayer()->Play(TICKSND);
             }
         }
+        char freezeMessage[100];
+        snprintf(freezeMessage, sizeof(freezeMessage), "Time Stopped: %d", remainingFreezeTimeInSec);
+        snapshot.statusMessage = (m_statusMessage != NULL) ? m_statusMessage : (remainingFreezeTime != 0) ? freezeMessage : m_playerActions.GetStatusMessage();
+    }
+
+    m_worldSnapshots.Publish();
+}
+
+void EngineCore::ThinkPlayer()
+{
+    if (m_playerActions.UpdateShoot(m_timeStampOfPlayerCurrentFrame))
+    {
+        const auto decorateProjectilePair = m_game.GetDecorateActors().find(m_level->GetPlayerActor()->GetDecorateActor().projectileId);
+        if (decorateProjectilePair != m_game.GetDecorateActors().end())
+        {
+            Actor* projectile = new Actor(m_level->GetPlayerActor()->GetX(), m_level->GetPlayerActor()->GetY(), m_timeStampOfPlayerCurrentFrame, decorateProjectilePair->second);
+            projectile->SetAngle(m_level->GetPlayerActor()->GetAngle());
+            projectile->SetActive(true);
+            m_level->AddNonBlockingActor(projectile);
+        }
+
+        m_game.GetAudioPlayer()->Play(SHOOTSND);
+    }
+    if (m_playerActions.IsReadyToShootBolt(m_timeStampOfPlayerCurrentFrame))
+    {
+        if (m_playerInventory.TakeBolt())
+        {
+            m_playerActions.ShootBolt(m_timeStampOfPlayerCurrentFrame);
+            m_game.GetAudioPlayer()->Play(USEBOLTSND);
+        }
+        else
+        {
+            m_game.GetAudioPlayer()->Play(NOITEMSND);
+        }
+    }
+
+    if (m_playerActions.UpdateContinueBolt(m_timeStampOfPlayerCurrentFrame))
+    {
+        const auto decorateProjectilePair = m_game.GetDecorateActors().find(m_level->GetPlayerActor()->GetDecorateActor().projectileId);
+        if (decorateProjectilePair != m_game.GetDecorateActors().end())
+        {
+            Actor* projectile = new Actor(m_level->GetPlayerActor()->GetX(), m_level->GetPlayerActor()->GetY(), m_timeStampOfWorldCurrentFrame, decorateProjectilePair->second);
+            projectile->SetAngle(m_level->GetPlayerActor()->GetAngle());
+            projectile->SetActive(true);
+            m_level->AddNonBlockingActor(projectile);
+        }
+    }             
+
+    if (m_playerActions.UpdateShootNuke(m_timeStampOfPlayerCurrentFrame))
+    {
+        if (m_playerInventory.TakeNuke())
+        {
+            m_game.GetAudioPlayer()->Play(USENUKESND);
+
+            const auto decorateProjectilePair = m_game.GetDecorateActors().find(m_level->GetPlayerActor()->GetDecorateActor().projectileId + 1);
+            if (decorateProjectilePair != m_game.GetDecorateActors().end())
+            {
+                for (uint16_t i = 0; i < 16; i++)
+                {
+                    Actor* projectile = new Actor(m_level->GetPlayerActor()->GetX(), m_level->GetPlayerActor()->GetY(), m_timeStampOfWorldCurrentFrame, decorateProjectilePair->second);
+                    projectile->SetAngle(i * 22.5f);
+                    projectile->SetActive(true);
+                    m_level->AddNonBlockingActor(projectile);
+                }
+            }
+        }
+        else
+        {
+            m_game.GetAudioPlayer()->Play(NOITEMSND);
+        }
+    }
+    // The turn rate and player speed were tuned at 60 tics per second.
+    const float degreesPerTic = (m_playerActions.GetActionActive(QuickTurn)) ? 3.0f : 1.0f;
+    const float deltaTimeInTics = (FixedTimeStep::MillisecondsPerTick * 60.0f) / 1000.0f;
+    if (m_playerActions.GetActionActive(TurnLeft))
+    {
+        const float deltaDegrees = degreesPerTic * deltaTimeInTics;
+        m_level->GetPlayerActor()->SetAngle(m_level->GetPlayerActor()->GetAngle() - deltaDegrees);
+    }
+    if (m_playerActions.GetActionActive(TurnRight))
+    {
+        const float deltaDegrees = degreesPerTic * deltaTimeInTics;
+        m_level->GetPlayerActor()->SetAngle(m_level->GetPlayerActor()->GetAngle() + deltaDegrees);
+    }
+    const float playerSpeed = 5120.0f / 65536.0f;
+    const float distance = playerSpeed * deltaTimeInTics;
+    if (m_playerActions.GetActionActive(MoveForward) && m_playerActions.GetActionActive(StrafeLeft))
+    { 
+        Thrust(315, distance);
+    }
+    else if (m_playerActions.GetActionActive(MoveBackward) && m_playerActions.GetActionActive(StrafeLeft))
+    {
+        Thrust(225, distance);
+    }
+    else if (m_playerActions.GetActionActive(MoveForward) && m_playerActions.GetActionActive(StrafeRight))
+    {
+        Thrust(45, distance);
+    }
+    else if (m_playerActions.GetActionActive(MoveBackward) && m_playerActions.GetActionActive(StrafeRight))
+    {
+        Thrust(135, distance);
+    }
+    else if (m_playerActions.GetActionActive(MoveForward))
+    {
+        Thrust(0, distance);
+    }
+    else if (m_playerActions.GetActionActive(MoveBackward))
+    {
+        Thrust(180, distance);
+    }
+    else if (m_playerActions.GetActionActive(StrafeLeft))
+    {
+        Thrust(270, distance);
+    }
+    else if (m_playerActions.GetActionActive(StrafeRight))
+    {
+        Thrust(90, distance);
+    }
+    if (m_playerInput.GetMouseXPos() != 0)
+    {
+        // The mouse movement is accumulated until the next tick. It is not scaled with time, as the mouse movement
+        // itself already is a distance; the turn rate matches the earlier behavior at 60 frames per second.
+        const float mouseMovement = m_playerInput.GetMouseXPos() * (m_configurationSettings.GetMouseSensitivity() / 10.0f);
+        m_level->GetPlayerActor()->SetAngle(m_level->GetPlayerActor()->GetAngle() + (mouseMovement * (abs(mouseMovement / 30.0f))));
+        m_playerInput.SetMouseXPos(0);
+    }
+}
+
+void EngineCore::ThinkActors()
+{
+    m_level->WakeUpActors(m_timeStampOfWorldCurrentFrame);
+
+    const std::vector<Actor*>& blockingActors = m_level->GetBlockingActors();
+    for (Actor* actor : blockingActors)
+    {
+        if (!actor->IsActive() && m_level->IsTileVisibleForPlayer(actor->GetTileX(), actor->GetTileY()))
+        {
+            actor->SetActive(true);
+        }
+    }
+
+    // First advance the animations of all actors in one batch, then perform their actions.
+    m_level->AnimateBlockingActors(m_timeStampOfWorldCurrentFrame);
+
+    // Iterate backwards, as an actor that is removed gets replaced by the last actor in the list,
+    // which has already been processed.
+    for (size_t i = blockingActors.size(); i > 0; i--)
+    {
+        if (i > blockingActors.size())
+        {
+            continue;
+        }
+
+        Actor* actor = blockingActors[i - 1];
+        if (actor->IsActive() && !actor->IsAsleep())
+        {
+            PerformActionOnActorOrSleep(actor);
+        }
+    }
+}
+
+// Actors that have nothing to do for a while are put to sleep until they have, instead of having them check the
+// time every frame.
+void EngineCore::PerformActionOnActorOrSleep(Actor* actor)
+{
+    const uint32_t wakeUpTime = GetWakeUpTime(actor);
+    if (wakeUpTime != 0)
+    {
+        m_level->PutActorToSleep(actor, wakeUpTime);
+    }
+    else
+    {
+        PerformActionOnActor(actor);
     }
 }
 
+// Returns the time of the world at which the actor has something to do again, or zero if it has something to do now.
+uint32_t EngineCore::GetWakeUpTime(const Actor* actor) const
+{
+    const actorAction action = actor->GetAction();
+    const uint32_t timestampOfNextFrame = actor->GetTimestampOfNextFrame();
+    if (action == ActionNone || (IsOneTimeAction(action) && actor->IsActionPerformed()))
+    {
+        return timestampOfNextFrame;
+    }
+
+    if ((action == ActionHide || action == ActionExplosionDelay) && actor->GetTimeToNextAction() > m_timeStampOfWorldCurrentFrame)
+    {
+        return (actor->GetTimeToNextAction() < timestampOfNextFrame) ? actor->GetTimeToNextAction() : timestampOfNextFrame;
+    }
+
+    return 0;
+}
+
 void EngineCore::PerformActionOnActor(Actor* actor)
 {
     const actorAction action = actor->GetAction();
@@ -991,7 +1220,7 @@ void EngineCore::PerformActionOnActor(Actor* actor)
     {
     case ActionChase:
     {
-        Chase(actor, true, ChasePlayer);
+        m_level->Chase(actor, true, ChasePlayer, m_aiRandom);
         break;
     }
     case ActionChaseLikeMage:
@@ -1003,25 +1232,25 @@ void EngineCore::PerformActionOnActor(Actor* actor)
         if (m_timeStampOfWorldCurrentFrame >= actor->GetTimeToNextAction())
         {
             // Choose next target
-            const bool shouldChasePlayer = (rand() % 2 == 0);
+            const bool shouldChasePlayer = (m_aiRandom.Next(2) == 0);
             if (shouldChasePlayer)
             {
                 actor->SetTemp1(ChasePlayer);
             }
             else
             {
-                int16_t otherTarget = (rand() % 4);
+                int16_t otherTarget = (int16_t)m_aiRandom.Next(4);
                 actor->SetTemp1(otherTarget + 1);
             }
             actor->SetTimeToNextAction(m_timeStampOfWorldCurrentFrame + ((uint32_t)10000));
         }
         ChaseTarget target = (ChaseTarget)actor->GetTemp1();
-        Chase(actor, true, target);
+        m_level->Chase(actor, true, target, m_aiRandom);
         break;
     }
     case ActionRunAway:
     {
-        RunAway(actor);
+        m_level->RunAway(actor, m_aiRandom);
         break;
     }
     case ActionHide:
@@ -1047,7 +1276,7 @@ void EngineCore::PerformActionOnActor(Actor* actor)
         if (actor->GetTimeToNextAction() == 0)
         {
             // Sink after between 4 and 7 seconds
-            actor->SetTimeToNextAction(m_timeStampOfWorldCurrentFrame + 4000 + (rand() % 4) * 1000);
+            actor->SetTimeToNextAction(m_timeStampOfWorldCurrentFrame + 4000 + m_aiRandom.Next(4) * 1000);
         }
         if (m_timeStampOfWorldCurrentFrame >= actor->GetTimeToNextAction())
         {
@@ -1060,7 +1289,7 @@ void EngineCore::PerformActionOnActor(Actor* actor)
         }
         else
         {
-            Chase(actor, true, ChasePlayer);
+            m_level->Chase(actor, true, ChasePlayer, m_aiRandom);
         }
         break;
     }
@@ -1070,7 +1299,7 @@ void EngineCore::PerformActionOnActor(Actor* actor)
         {
             actor->SetSolid(false);
             // Rise after between 4 and 7 seconds
-            actor->SetTimeToNextAction(m_timeStampOfWorldCurrentFrame + 4000 + (rand() % 4) * 1000);
+            actor->SetTimeToNextAction(m_timeStampOfWorldCurrentFrame + 4000 + m_aiRandom.Next(4) * 1000);
         }
         if ((m_timeStampOfWorldCurrentFrame >= actor->GetTimeToNextAction()) ||
             (abs(m_level->GetPlayerActor()->GetX() - actor->GetX()) < 2.0f + actor->GetDecorateActor().size) && (abs(m_level->GetPlayerActor()->GetY() - actor->GetY()) < 2.0f + actor->GetDecorateActor().size))
@@ -1093,7 +1322,7 @@ void EngineCore::PerformActionOnActor(Actor* actor)
         else
         {
             // Not ready to rise yet, so keep chasing
-            Chase(actor, true, ChasePlayer);
+            m_level->Chase(actor, true, ChasePlayer, m_aiRandom);
         }
         break;
     }
@@ -1227,18 +1456,12 @@ void EngineCore::PerformActionOnActor(Actor* actor)
         }
         if (spawnSkeleton)
         {
-            m_level->AddNonBlockingActor(actor);
             actor->SetActionPerformed(true);
             Actor* skeletonActor = new Actor(actor->GetX(), actor->GetY(), m_timeStampOfWorldCurrentFrame, decorateSkeleton);
             skeletonActor->SetTile(actor->GetTileX(), actor->GetTileY());
-            for ( uint16_t i = 0; i < m_level->GetLevelWidth() * m_level->GetLevelHeight(); i++)
-            {
-                if (m_level->GetBlockingActors()[i] == actor)
-                {
-                    m_level->GetBlockingActors()[i] = skeletonActor;
-                }
-            }
-            
+            m_level->ReplaceBlockingActor(actor, skeletonActor);
+            m_level->AddNonBlockingActor(actor);
+
         }
         break;
     }
@@ -1258,7 +1481,7 @@ void EngineCore::PerformActionOnActor(Actor* actor)
     case ActionItemDestroyed:
     {
         DisplayStatusMessage("Item destroyed", 80 * 17);
-        m_level->SpawnBigExplosion(actor->GetX(),actor->GetY(),12,(16l<<16L), m_timeStampOfWorldCurrentFrame);
+        m_level->SpawnBigExplosion(actor->GetX(),actor->GetY(),12,(16l<<16L), m_timeStampOfWorldCurrentFrame, m_effectsRandom);
         actor->SetActionPerformed(true);
         break;
     }
@@ -1271,7 +1494,7 @@ void EngineCore::PerformActionOnActor(Actor* actor)
     }
     case ActionGiveChest:
     {
-        m_playerInventory.GiveChest();
+        m_playerInventory.GiveChest(m_itemsRandom);
         m_takingChest = true;
         m_gameTimer.Pause();
         actor->SetActionPerformed(true);
@@ -1412,9 +1635,7 @@ void EngineCore::PerformActionOnActor(Actor* actor)
         const float speed =  actor->GetDecorateActor().speed;
         if (speed > 0)
         {
-            const uint32_t deltaTime = m_timeStampOfWorldCurrentFrame - m_timeStampOfWorldPreviousFrame;
-            const uint32_t truncatedDeltaTime = (deltaTime < 50) ? deltaTime : 50;
-            float distance = (float)speed * ((float)(truncatedDeltaTime) / 14.2f) / 65536.0f;
+            float distance = m_level->GetDistanceInTick(actor->GetDecorateActor().speed);
             if (distance > 1.0)
             {
                 distance = 1.0;
@@ -1457,38 +1678,37 @@ void EngineCore::PerformActionOnActor(Actor* actor)
                             moveOk = false;
                         }
                     }
+                }
+            }
 
-                    Actor* otherActor = m_level->GetBlockingActor(x, y);
-                    if (otherActor != NULL)
+            if (action == ActionPlayerProjectile)
+            {
+                // The projectile hits the first actor along its path, also when that actor is halfway between two tiles.
+                m_actorsOnPath.clear();
+                m_level->GetBlockingActorsOnPath(actor->GetX(), actor->GetY(), basex, basey, size, m_actorsOnPath);
+                for (Actor* otherActor : m_actorsOnPath)
+                {
+                    if (otherActor->IsSolid() || otherActor->GetAction() == ActionWaitForPickup)
                     {
-                        if (action == ActionPlayerProjectile)
+                        // In the original game, the hit points of all monsters were divided by four when playing in easy mode, see function EasyHitPoints in C4_ACT1.C.
+                        // To prevent the Actor class from having to look up the difficulty mode, the damage inflicted by the players' fireball is simply multiplied by 4 here.
+                        const uint8_t damage = (m_difficultyLevel == Easy) ? actor->GetDecorateActor().damage * 4 : actor->GetDecorateActor().damage;
+                        otherActor->Damage(damage);
+                        m_game.GetAudioPlayer()->Play(otherActor->GetDecorateActor().hitSound);
+
+                        if (otherActor->IsDead())
                         {
-                            if ((otherActor->IsSolid() || otherActor->GetAction() == ActionWaitForPickup) && 
-                                (abs(basex - otherActor->GetX()) < size + otherActor->GetDecorateActor().size) &&
-                                (abs(basey - otherActor->GetY()) < size + otherActor->GetDecorateActor().size))
-                            {
-                                // In the original game, the hit points of all monsters were divided by four when playing in easy mode, see function EasyHitPoints in C4_ACT1.C.
-                                // To prevent the Actor class from having to look up the difficulty mode, the damage inflicted by the players' fireball is simply multiplied by 4 here.
-                                const uint8_t damage = (m_difficultyLevel == Easy) ? actor->GetDecorateActor().damage * 4 : actor->GetDecorateActor().damage;
-                                otherActor->Damage(damage);
-                                m_game.GetAudioPlayer()->Play(otherActor->GetDecorateActor().hitSound);
-
-                                if (otherActor->IsDead())
-                                {
-                                    otherActor->SetState(StateIdDying, m_timeStampOfWorldCurrentFrame);
-                                    otherActor->SetSolid(false);
-                                    m_level->AddNonBlockingActor(otherActor);
-                                    m_level->SetBlockingActor(x, y, NULL);
-                                }
-                                else
-                                {
-                                    otherActor->SetState(StateIdPain, m_timeStampOfWorldCurrentFrame);
-                                }
-                                moveOk = false;
-                            }
+                            otherActor->SetState(StateIdDying, m_timeStampOfWorldCurrentFrame);
+                            otherActor->SetSolid(false);
+                            m_level->AddNonBlockingActor(otherActor);
                         }
+                        else
+                        {
+                            otherActor->SetState(StateIdPain, m_timeStampOfWorldCurrentFrame);
+                        }
+                        moveOk = false;
+                        break;
                     }
-
                 }
             }
             if (action == ActionMonsterProjectile)
@@ -1534,12 +1754,25 @@ void EngineCore::PerformActionOnActor(Actor* actor)
 
 void EngineCore::ThinkNonBlockingActors()
 {
-    for ( uint16_t i = 0; i < 100; i++)
+    m_level->AnimateNonBlockingActors(m_timeStampOfWorldCurrentFrame);
+
+    // All blocking actors have moved for this frame; register them for the projectile hit tests.
+    m_level->UpdateSpatialHash();
+
+    // Iterate backwards for the same reason as in ThinkActors. Actors that are spawned during this loop
+    // are added at the end of the list and get to think from the next frame on.
+    const std::vector<Actor*>& nonBlockingActors = m_level->GetNonBlockingActors();
+    for (size_t i = nonBlockingActors.size(); i > 0; i--)
     {
-        if (m_level->GetNonBlockingActors()[i] != NULL)
+        if (i > nonBlockingActors.size())
         {
-            m_level->GetNonBlockingActors()[i]->Think(m_timeStampOfWorldCurrentFrame);
-            PerformActionOnActor(m_level->GetNonBlockingActors()[i]);
+            continue;
+        }
+
+        Actor* actor = nonBlockingActors[i - 1];
+        if (!actor->IsAsleep())
+        {
+            PerformActionOnActorOrSleep(actor);
         }
     }
 }
@@ -1621,7 +1854,7 @@ bool EngineCore::ClipWithTile(const uint16_t tileX, const uint16_t tileY, const
         if (requiredKey != NoKey && m_playerInventory.GetKeys(requiredKey) == 0)
         {
             m_gameTimer.Pause();
-            _sprintf_p(m_messageInPopup, 256, "You need a %s key", GetKeyName(requiredKey));
+            snprintf(m_messageInPopup, 256, "You need a %s key", GetKeyName(requiredKey));
             WaitForAnyKeyPressed();
             m_game.GetAudioPlayer()->Play(HIT_GATESND);
         }
@@ -1634,7 +1867,7 @@ bool EngineCore::ClipWithTile(const uint16_t tileX, const uint16_t tileY, const
             if (m_level->IsBlockedDoor(tileX, tileY))
             {
                 m_gameTimer.Pause();
-                _sprintf_p(m_messageInPopup, 256, "The door is blocked");
+                snprintf(m_messageInPopup, 256, "The door is blocked");
                 WaitForAnyKeyPressed();
                 m_game.GetAudioPlayer()->Play(HIT_GATESND);
             }
@@ -1651,6 +1884,7 @@ bool EngineCore::ClipWithTile(const uint16_t tileX, const uint16_t tileY, const
                 m_gameTimer.Pause();
                 m_game.GetAudioPlayer()->Play(HIT_GATESND);
                 m_state = VerifyGateExit;
+                m_levelPreloader.Start(m_warpToLevel, m_difficultyLevel, GetSpawnRandom(m_warpToLevel));
             }
             else
             {
@@ -1659,6 +1893,7 @@ bool EngineCore::ClipWithTile(const uint16_t tileX, const uint16_t tileY, const
                 m_gameTimer.Pause();
                 m_game.GetAudioPlayer()->Play(HIT_GATESND);
                 m_state = VerifyGateExit;
+                m_levelPreloader.Start(m_warpToLevel, m_difficultyLevel, GetSpawnRandom(m_warpToLevel));
             }
         }
     }
@@ -1725,7 +1960,7 @@ void EngineCore::Thrust(const uint16_t angle, const float distance)
     ymove = distance * (float)cos((m_level->GetPlayerActor()->GetAngle() + 180 + angle) * 3.14159265 / 180.0);
 
     ClipXMove(xmove);
-    if (_strcmpi(m_messageInPopup, "") == 0)
+    if (strcmp(m_messageInPopup, "") == 0)
     {
         ClipYMove(ymove);
     }
@@ -1748,106 +1983,6 @@ void EngineCore::KeyWPressed()
     }
 }
 
-// Based on Chase() in C4_STATE.C of the Catacomb Abyss source code.
-bool EngineCore::Chase(Actor* actor, const bool diagonal, const ChaseTarget target)
-{
-    const uint16_t speed = actor->GetDecorateActor().speed;
-
-    const uint32_t deltaTimeInMs = m_timeStampOfWorldCurrentFrame - m_timeStampOfWorldPreviousFrame;
-    const uint32_t truncatedDeltaTimeInMs = (deltaTimeInMs < 50) ? deltaTimeInMs : 50;
-    float move = (float)speed * ((float)(truncatedDeltaTimeInMs) / 14.2f) / 65536.0f;
-
-    while (move > 0.0f)
-    {
-        if (actor->GetDecorateActor().damage > 0)
-        {
-            if (actor->WouldCollideWithActor(m_level->GetPlayerActor()->GetX(), m_level->GetPlayerActor()->GetY(), 1.0f))
-            {
-                if ((rand() % 3) == 0)
-                {
-                    actor->SetState(StateIdAttack, m_timeStampOfWorldCurrentFrame);
-                }
-                return true;
-            }
-        }
-        else
-        {
-            if (actor->GetDecorateActor().id == actorIdMonsterNemesis || actor->GetDecorateActor().id == actorIdMonsterMage || actor->GetDecorateActor().id == actorIdMonsterEye)
-            {
-                if ((rand() % 60) == 0 && m_level->AngleNearPlayer(actor) != -1)
-                {
-                    actor->SetState(StateIdAttack, m_timeStampOfWorldCurrentFrame);
-                }
-            }
-
-            // Clip with player
-            if (actor->WouldCollideWithActor(m_level->GetPlayerActor()->GetX(), m_level->GetPlayerActor()->GetY(), 1.0f))
-            {
-                return true;
-            }
-        }
-
-        if (move < actor->GetDistanceToTarget())
-        {
-            m_level->MoveActor(actor, move);
-            break;
-        }
-        
-        m_level->GetBlockingActors()[(actor->GetTileY() * m_level->GetLevelWidth()) + actor->GetTileX()] = NULL;	// pick up marker from goal
-        if (actor->GetDirection() == nodir)
-            actor->SetDirection(north);
-
-        // Instantly set the actor on its target
-        move -= actor->GetDistanceToTarget();
-        actor->SetX((float)(actor->GetTileX()) + 0.5f);
-        actor->SetY((float)(actor->GetTileY()) + 0.5f);
-
-        m_level->ChaseThink (actor,diagonal, target);
-
-        m_level->GetBlockingActors()[(actor->GetTileY() * m_level->GetLevelWidth()) + actor->GetTileX()] = actor;	// set down a new goal marker
-        if (actor->TargetReached())
-            break;			// no possible move
-
-    }
-
-    return false;
-}
-
-void EngineCore::RunAway(Actor* actor)
-{
-    const uint16_t speed = actor->GetDecorateActor().speed;
-
-    const uint32_t deltaTimeInMs = m_timeStampOfWorldCurrentFrame - m_timeStampOfWorldPreviousFrame;
-    const uint32_t truncatedDeltaTimeInMs = (deltaTimeInMs < 50) ? deltaTimeInMs : 50;
-    float move = (float)speed * ((float)(truncatedDeltaTimeInMs) / 14.2f) / 65536.0f;
-
-    while (move > 0.0f)
-    {
-        if (move < actor->GetDistanceToTarget())
-        {
-            m_level->MoveActor(actor, move);
-            break;
-        }
-
-        m_level->GetBlockingActors()[(actor->GetTileY() * m_level->GetLevelWidth()) + actor->GetTileX()] = NULL;	// pick up marker from goal
-        if (actor->GetDirection() == nodir)
-            actor->SetDirection(north);
-
-        // Instantly set the actor on its target
-        move -= actor->GetDistanceToTarget();
-        actor->SetX((float)(actor->GetTileX()) + 0.5f);
-        actor->SetY((float)(actor->GetTileY()) + 0.5f);
-
-        m_level->RunAwayThink(actor);
-
-        m_level->GetBlockingActors()[(actor->GetTileY() * m_level->GetLevelWidth()) + actor->GetTileX()] = actor;	// set down a new goal marker
-        if (actor->TargetReached())
-        {
-            break;			// no possible move
-        }
-    }
-}
-
 void EngineCore::WarpInsideLevel(const Actor* sourceWarp)
 {
     for (uint16_t y = 0; y < m_level->GetLevelHeight(); y++)
@@ -1868,6 +2003,9 @@ void EngineCore::WarpInsideLevel(const Actor* sourceWarp)
                         Thrust(0, 0.5f);
                     }
                 }
+
+                // Do not interpolate between the source and destination of the warp.
+                m_level->GetPlayerActor()->StorePreviousPosition();
             }
         }
     }
@@ -1890,6 +2028,7 @@ void EngineCore::KeyNPressed()
         // Stay on level and resume play
         m_state = InGame;
         m_warpToLevel = m_level->GetLevelIndex();
+        m_levelPreloader.Discard();
         m_gameTimer.Resume();
 
         // Keep the key
@@ -2020,6 +2159,225 @@ bool EngineCore::RequiresMouseCapture() const
             m_state == VerifyGateExit));
 }
 
+void EngineCore::SetClock(const IClock& clock)
+{
+    m_clock = &clock;
+    m_timeStampOfSourceFrame = clock.GetMilliseconds();
+}
+
+void EngineCore::SetRandomSeedForNewGame(const uint64_t seed)
+{
+    m_randomSeedForNewGame = seed;
+    m_hasRandomSeedForNewGame = true;
+}
+
+uint64_t EngineCore::GetNumberOfTicks() const
+{
+    return m_numberOfTicks;
+}
+
+void EngineCore::StartDemoRecording()
+{
+    std::lock_guard<std::mutex> lock(m_menuMutex);
+    StopDemoRecordingOrPlayback();
+    m_demo.Clear();
+    m_demoMode = DemoWaitingForLevelStart;
+}
+
+bool EngineCore::StartDemoPlayback(const Demo& demo)
+{
+    std::lock_guard<std::mutex> lock(m_menuMutex);
+    return PlayDemo(demo);
+}
+
+void EngineCore::SetDemoFilename(const std::string& filename)
+{
+    std::lock_guard<std::mutex> lock(m_menuMutex);
+    m_demoFilename = filename;
+}
+
+bool EngineCore::PlayDemo(const Demo& demo)
+{
+    const Demo::demoStart& start = demo.GetStart();
+    if (start.gameId != m_game.GetId() || start.mapIndex >= m_game.GetGameMaps()->GetNumberOfLevels())
+    {
+        return false;
+    }
+
+    StopDemoRecordingOrPlayback();
+    m_demo = demo;
+
+    m_mouseSensitivityBeforeDemo = m_configurationSettings.GetMouseSensitivity();
+    m_mouseLookBeforeDemo = m_configurationSettings.GetMouseLook();
+    m_configurationSettings.SetMouseSensitivity(start.mouseSensitivity);
+    m_configurationSettings.SetMouseLook(start.mouseLook);
+
+    m_difficultyLevel = (DifficultyLevel)start.difficultyLevel;
+    m_godModeIsOn = start.godMode;
+    SetRandomSeed(start.randomSeed);
+    std::istringstream inventory(start.inventory, std::ios::binary);
+    m_playerInventory.LoadFromFile(inventory);
+
+    m_extraMenu.SetActive(false);
+    m_readingScroll = 255;
+    m_takingChest = false;
+    m_keyToTake = KeyId::NoKey;
+    m_startTakeKey = 0;
+    m_messageInPopup[0] = '\0';
+    m_playerInput.ClearAll();
+
+    LoadLevel(start.mapIndex);
+    m_level->GetPlayerActor()->SetHealth(start.health);
+    m_state = EnteringLevel;
+    m_timeStampToEnterGame = m_timeStampOfLevelStart + start.timeToEnterLevel;
+    m_levelStarted = false;
+
+    m_demoPosition = 0;
+    Demo::InitInput(m_demoInput);
+    m_demoPlaybackMatchesRecording = false;
+    m_demoMode = DemoPlayback;
+
+    return true;
+}
+
+void EngineCore::StopDemo()
+{
+    std::lock_guard<std::mutex> lock(m_menuMutex);
+    StopDemoRecordingOrPlayback();
+}
+
+bool EngineCore::IsRecordingDemo() const
+{
+    return m_demoMode == DemoWaitingForLevelStart || m_demoMode == DemoRecording;
+}
+
+bool EngineCore::IsPlayingDemo() const
+{
+    return m_demoMode == DemoPlayback;
+}
+
+const Demo& EngineCore::GetDemo() const
+{
+    return m_demo;
+}
+
+bool EngineCore::DemoPlaybackMatchesRecording() const
+{
+    return m_demoPlaybackMatchesRecording;
+}
+
+uint64_t EngineCore::GetGameStateChecksum() const
+{
+    std::ostringstream state(std::ios::binary);
+    const uint8_t engineState = (uint8_t)m_state;
+    state.write((const char*)&engineState, sizeof(engineState));
+    state.write((const char*)&m_difficultyLevel, sizeof(m_difficultyLevel));
+    state.write((const char*)&m_godModeIsOn, sizeof(m_godModeIsOn));
+    state.write((const char*)&m_timeStampOfPlayerCurrentFrame, sizeof(m_timeStampOfPlayerCurrentFrame));
+    state.write((const char*)&m_timeStampOfWorldCurrentFrame, sizeof(m_timeStampOfWorldCurrentFrame));
+    m_playerInventory.StoreToFile(state);
+    if (m_level != NULL)
+    {
+        m_level->StoreToFile(state);
+    }
+    m_aiRandom.StoreToFile(state);
+    m_effectsRandom.StoreToFile(state);
+    m_itemsRandom.StoreToFile(state);
+
+    return Demo::GetChecksum(state.str());
+}
+
+// The time of the game only changes once per frame. While a demo is recorded, the time that passed and the player
+// input are stored for each frame; during playback they are taken from the demo instead, such that every frame
+// runs the same number of ticks on the same input.
+void EngineCore::AdvanceFrameClock()
+{
+    const uint32_t timeStampOfSourceFrame = m_clock->GetMilliseconds();
+    uint32_t timeDelta = timeStampOfSourceFrame - m_timeStampOfSourceFrame;
+    m_timeStampOfSourceFrame = timeStampOfSourceFrame;
+
+    if (m_demoMode == DemoWaitingForLevelStart && m_levelStarted && m_state == EnteringLevel && m_level != NULL)
+    {
+        BeginDemoRecording();
+    }
+    m_levelStarted = false;
+
+    if (m_demoMode == DemoRecording)
+    {
+        Demo::CaptureInput(m_playerInput, m_demoInput);
+        m_demo.AddFrame(timeDelta, m_demoInput);
+    }
+    else if (m_demoMode == DemoPlayback)
+    {
+        if (m_demo.ReadFrame(m_demoPosition, timeDelta, m_demoInput))
+        {
+            Demo::ApplyInput(m_demoInput, m_playerInput);
+        }
+        else
+        {
+            FinishDemoPlayback();
+        }
+    }
+
+    m_frameClock.Advance(timeDelta);
+}
+
+void EngineCore::BeginDemoRecording()
+{
+    Demo::demoStart start;
+    start.gameId = m_game.GetId();
+    start.difficultyLevel = (uint8_t)m_difficultyLevel;
+    start.randomSeed = m_randomSeed;
+    start.mapIndex = m_level->GetLevelIndex();
+    start.health = m_level->GetPlayerActor()->GetHealth();
+    start.godMode = m_godModeIsOn;
+    start.mouseSensitivity = m_configurationSettings.GetMouseSensitivity();
+    start.mouseLook = m_configurationSettings.GetMouseLook();
+    start.timeToEnterLevel = m_timeStampToEnterGame - m_timeStampOfLevelStart;
+    std::ostringstream inventory(std::ios::binary);
+    m_playerInventory.StoreToFile(inventory);
+    start.inventory = inventory.str();
+
+    m_demo.Clear();
+    m_demo.SetStart(start);
+    m_demoMode = DemoRecording;
+}
+
+bool EngineCore::StoreDemoToFile()
+{
+    const std::string filenamePathAbyss = m_system.GetConfigurationFilePath() + "\\Abyss";
+    m_system.CreatePath(filenamePathAbyss);
+    return m_demo.StoreToFile(m_demoFilename);
+}
+
+void EngineCore::FinishDemoPlayback()
+{
+    m_demoPlaybackMatchesRecording = (GetGameStateChecksum() == m_demo.GetChecksum());
+    StopDemoRecordingOrPlayback();
+}
+
+void EngineCore::StopDemoRecordingOrPlayback()
+{
+    if (m_demoMode == DemoRecording)
+    {
+        m_demo.SetChecksum(GetGameStateChecksum());
+    }
+    else if (m_demoMode == DemoPlayback)
+    {
+        // Keys that were held down in the demo are released, and the settings of the player are back in effect.
+        m_playerInput.ClearAll();
+        m_configurationSettings.SetMouseSensitivity(m_mouseSensitivityBeforeDemo);
+        m_configurationSettings.SetMouseLook(m_mouseLookBeforeDemo);
+    }
+    m_demoMode = DemoOff;
+}
+
+// The duration of a sound depends on the audio device, so the game does not wait for it while a demo is active.
+bool EngineCore::IsWaitingForSound() const
+{
+    return m_demoMode != DemoRecording && m_demoMode != DemoPlayback && m_game.GetAudioPlayer()->IsPlaying();
+}
+
 bool EngineCore::IsOneTimeAction(const actorAction action)
 {
     return (action == ActionAttack ||
@@ -2117,6 +2475,10 @@ bool EngineCore::IsActionJustPressed(const ControlAction action) const
 
 void EngineCore::StartNewGame()
 {
+    if (m_demoMode == DemoRecording || m_demoMode == DemoPlayback)
+    {
+        StopDemoRecordingOrPlayback();
+    }
     m_state = RequestDifficultyLevel;
     m_playerInventory.ResetForNewGame();
     UnloadLevel();
@@ -2131,6 +2493,31 @@ void EngineCore::UnloadLevel()
     }
 }
 
+// All randomness in the simulation is derived from a single seed per game session. Levels that were spawned with a
+// different seed can no longer be reused.
+void EngineCore::SetRandomSeed(const uint64_t seed)
+{
+    if (seed != m_randomSeed)
+    {
+        m_levelPreloader.Discard();
+        m_levelCache.Clear();
+        m_randomSeed = seed;
+    }
+}
+
+void EngineCore::SeedRandomStreams(const uint8_t mapIndex)
+{
+    const uint64_t levelSeed = Random::MixSeed(m_randomSeed, mapIndex);
+    m_aiRandom.Seed(levelSeed, RandomStreamAi);
+    m_effectsRandom.Seed(levelSeed, RandomStreamEffects);
+    m_itemsRandom.Seed(levelSeed, RandomStreamItems);
+}
+
+Random EngineCore::GetSpawnRandom(const uint8_t mapIndex) const
+{
+    return Random(Random::MixSeed(m_randomSeed, mapIndex), RandomStreamSpawn);
+}
+
 bool EngineCore::StoreGameToFileWithFullPath(const std::string filename) const
 {
     bool result = false;
@@ -2155,6 +2542,10 @@ bool EngineCore::StoreGameToFileWithFullPath(const std::string filename) const
         m_playerInventory.StoreToFile(file);
         m_level->StoreToFile(file);
         m_gameTimer.StoreToFile(file);
+        file.write((const char*)&m_randomSeed, sizeof(m_randomSeed));
+        m_aiRandom.StoreToFile(file);
+        m_effectsRandom.StoreToFile(file);
+        m_itemsRandom.StoreToFile(file);
         file.close();
         result = true;
     }
@@ -2180,6 +2571,10 @@ void EngineCore::LoadGameFromFileWithFullPath(const std::string filename)
     file.open(filename, std::ifstream::binary);
     if (file.is_open())
     {
+        if (m_demoMode == DemoRecording || m_demoMode == DemoPlayback)
+        {
+            StopDemoRecordingOrPlayback();
+        }
         char headerString[11];
         file.read(headerString, 11);
         uint8_t versionMajorRead = 0;;
@@ -2195,6 +2590,24 @@ void EngineCore::LoadGameFromFileWithFullPath(const std::string filename)
         m_level = m_game.GetGameMaps()->GetLevelFromSavedGame(file);
         m_level->LoadActorsFromFile(file, m_game.GetDecorateActors());
         m_gameTimer.LoadFromFile(file);
+        uint64_t randomSeed = 0;
+        file.read((char*)&randomSeed, sizeof(randomSeed));
+        const bool randomStateLoaded =
+            file.good() &&
+            m_aiRandom.LoadFromFile(file) &&
+            m_effectsRandom.LoadFromFile(file) &&
+            m_itemsRandom.LoadFromFile(file);
+        if (randomStateLoaded)
+        {
+            SetRandomSeed(randomSeed);
+        }
+        else
+        {
+            // Saved by a version without a random seed; continue with a new one.
+            SetRandomSeed(GenerateRandomSeed());
+            SeedRandomStreams(m_level->GetLevelIndex());
+        }
+        m_fixedTimeStep.Reset();
         file.close();
 
         m_playerActions.ResetForNewLevel();
@@ -2218,4 +2631,4 @@ void EngineCore::LoadGameFromFile(const std::string filename)
     const std::string filenamePathAbyss = filenamePath + "\\Abyss";
     const std::string fullPath = filenamePathAbyss + "\\" + filename + ".sav";
     LoadGameFromFileWithFullPath(fullPath);
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -31,7 +31,17 @@
 #include "ConfigurationSettings.h"
 #include "ExtraMenu.h"
 #include "GameTimer.h"
+#include "FixedTimeStep.h"
 #include "ISystem.h"
+#include "SpriteQueue.h"
+#include "RetainedLayer.h"
+#include "WorldSnapshot.h"
+#include "TripleBuffer.h"
+#include "LevelCache.h"
+#include "LevelPreloader.h"
+#include "ClockVirtual.h"
+#include "Demo.h"
+#include <mutex>
 
 #include "../Armageddon/GameArmageddon.h"
 
@@ -41,15 +51,51 @@ public:
     EngineCore(IGame& game, const ISystem& system, PlayerInput& playerInput);
     ~EngineCore();
 
-    // Draw the current state of the game.
+    // Draw the most recently published state of the game. Can be called from a different thread than Think().
     void DrawScene(IRenderer& renderer);
 
-    // Update the game state based on time and user input.
+    // Returns true if Think() published a state that was not drawn yet.
+    bool IsNewSnapshotAvailable() const;
+
+    // Update the game state based on time and user input, and publish the result for DrawScene().
     bool Think();
 
     // Returns true when the mouse is actively used by the game and needs to be bound to the application window.
     bool RequiresMouseCapture() const;
 
+    // Let the time of the game be driven by the given clock instead of the real time clock.
+    void SetClock(const IClock& clock);
+
+    // Use the given seed for the next new game instead of a random one, such that it plays out the same every time.
+    void SetRandomSeedForNewGame(const uint64_t seed);
+
+    // Total number of ticks that the world was simulated.
+    uint64_t GetNumberOfTicks() const;
+
+    // Record the input of the player, starting from the next level that is entered, until StopDemo() is called.
+    void StartDemoRecording();
+
+    // Play back a recorded demo from the start of its level. Returns false if the demo was recorded with another game.
+    // After the last frame, the player takes over control in the state in which the demo ended.
+    bool StartDemoPlayback(const Demo& demo);
+
+    // File in which a demo recording is stored when it is stopped from the menu or when the game ends, and which is
+    // played back from the menu. By default demo.dem in the folder with the saved games.
+    void SetDemoFilename(const std::string& filename);
+
+    // Stop recording or playing back. A recording gets the checksum of the current game state.
+    void StopDemo();
+
+    bool IsRecordingDemo() const;
+    bool IsPlayingDemo() const;
+    const Demo& GetDemo() const;
+
+    // Returns true if the last demo that was played back till the end resulted in the same game state as its recording.
+    bool DemoPlaybackMatchesRecording() const;
+
+    // Checksum over the game state, the timers and the random streams.
+    uint64_t GetGameStateChecksum() const;
+
     // CatacombGL version info; to be displayed at the top of the application window.
     static const std::string GetVersionInfo();
 
@@ -70,7 +116,18 @@ private:
         ExitGame
     };
 
+    enum DemoMode
+    {
+        DemoOff,
+        DemoWaitingForLevelStart,
+        DemoRecording,
+        DemoPlayback
+    };
+
     void LoadLevel(const uint8_t mapIndex);
+    bool ThinkFrame();
+    void PublishSnapshot();
+    void ThinkPlayer();
     void ThinkActors();
     void ThinkNonBlockingActors();
 
@@ -81,8 +138,6 @@ private:
     void DrawCenteredTiledWindow(IRenderer& renderer, const uint16_t width, const uint16_t height);
     void DrawTiledWindow(IRenderer& renderer, const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height);
 
-    bool Chase(Actor* actor, const bool diagonal, const ChaseTarget target);
-    void RunAway(Actor* actor);
 
     const char* GetKeyName(const KeyId keyId) const;
 
@@ -92,6 +147,8 @@ private:
     void WaitForAnyKeyPressed();
     void PerformActionOnActor(Actor* actor);
     static bool IsOneTimeAction(const actorAction action);
+    void PerformActionOnActorOrSleep(Actor* actor);
+    uint32_t GetWakeUpTime(const Actor* actor) const;
     void Thrust (const uint16_t angle, const float distance);
 
     void StoreConfigurationToFile() const;
@@ -118,10 +175,20 @@ private:
     bool IsActionJustPressed(const ControlAction action) const;
     void StartNewGame();
     void UnloadLevel();
+    void SetRandomSeed(const uint64_t seed);
+    void SeedRandomStreams(const uint8_t mapIndex);
+    Random GetSpawnRandom(const uint8_t mapIndex) const;
     bool StoreGameToFileWithFullPath(const std::string filename) const;
     bool StoreGameToFile(const std::string filename);
     void LoadGameFromFileWithFullPath(const std::string filename);
     void LoadGameFromFile(const std::string filename);
+    void AdvanceFrameClock();
+    void BeginDemoRecording();
+    bool PlayDemo(const Demo& demo);
+    bool StoreDemoToFile();
+    void FinishDemoPlayback();
+    void StopDemoRecordingOrPlayback();
+    bool IsWaitingForSound() const;
 
     IGame& m_game;
     ConfigurationSettings m_configurationSettings;
@@ -137,8 +204,15 @@ private:
     PlayerInventory m_playerInventory;
     DifficultyLevel m_difficultyLevel;
     bool m_godModeIsOn;
+    uint64_t m_randomSeed;
+    Random m_aiRandom;
+    Random m_effectsRandom;
+    Random m_itemsRandom;
 
     // Volatile data
+    bool m_hasRandomSeedForNewGame;
+    uint64_t m_randomSeedForNewGame;
+    uint64_t m_numberOfTicks;
     FramesCounter m_framesCounter;
     PlayerInput& m_playerInput;
     uint8_t m_keyToTake;
@@ -147,6 +221,9 @@ private:
     State m_state;
     const char* m_statusMessage;
     Radar m_radarModel;
+    SpriteQueue m_spriteQueue;
+    std::vector<Actor*> m_actorsOnPath;
+    RetainedLayer m_statusBarLayer;
     uint8_t m_readingScroll;
     bool m_takingChest;
     uint8_t m_warpToLevel;
@@ -161,6 +238,27 @@ private:
     uint32_t m_timeStampLastMouseMoveBackward;
     ExtraMenu m_extraMenu;
     GameTimer m_gameTimer;
+    FixedTimeStep m_fixedTimeStep;
+    TripleBuffer<WorldSnapshot> m_worldSnapshots;
+    std::mutex m_menuMutex;
     const ISystem& m_system;
     std::vector<std::string> m_savedGames;
+    LevelCache m_levelCache;
+    LevelPreloader m_levelPreloader;
+
+    // The game timer runs on a frame clock, which is advanced once per Think() by the time that passed on the source
+    // clock, or by the recorded time while a demo is played back.
+    const IClock* m_clock;
+    ClockVirtual m_frameClock;
+    uint32_t m_timeStampOfSourceFrame;
+    uint32_t m_timeStampOfLevelStart;
+    bool m_levelStarted;
+    DemoMode m_demoMode;
+    Demo m_demo;
+    Demo::demoInput m_demoInput;
+    size_t m_demoPosition;
+    bool m_demoPlaybackMatchesRecording;
+    uint8_t m_mouseSensitivityBeforeDemo;
+    bool m_mouseLookBeforeDemo;
+    std::string m_demoFilename;
 };
@@ -14,9 +14,9 @@
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
 
 #include "ExtraMenu.h"
-#include "..\Abyss\AudioRepositoryAbyss.h"
-#include "..\Abyss\EgaGraphAbyss.h"
-#include "..\..\ThirdParty\SDL\include\SDL_keyboard.h"
+#include "../Abyss/AudioRepositoryAbyss.h"
+#include "../Abyss/EgaGraphAbyss.h"
+#include "../../ThirdParty/SDL/include/SDL_keyboard.h"
 
 const uint8_t subMenuMain = 0;
 const uint8_t subMenuVideo = 1;
@@ -32,6 +32,7 @@ ExtraMenu::ExtraMenu(ConfigurationSettings& configurationSettings, AudioPlayer&
     m_menuItemOffset (0),
 	m_waitingForKeyToBind (false),
     m_saveGameEnabled (false),
+    m_demoRecording (false),
     m_configurationSettings (configurationSettings),
     m_audioPlayer (audioPlayer),
     m_savedGames (savedGames),
@@ -138,7 +139,7 @@ void ExtraMenu::MenuDown()
         m_audioPlayer.Play(HITWALLSND);
         if (m_subMenuSelected == subMenuMain)
         {
-            if (m_menuItemSelected == 6)
+            if (m_menuItemSelected == 8)
             {
                 m_menuItemSelected = 0;
             }
@@ -233,7 +234,7 @@ void ExtraMenu::MenuUp()
         {
             if (m_menuItemSelected == 0)
             {
-                m_menuItemSelected = 6;
+                m_menuItemSelected = 8;
             }
             else
             {
@@ -422,6 +423,17 @@ MenuCommand ExtraMenu::EnterKeyPressed()
             m_menuItemOffset = 0;
         }
         else if (m_menuItemSelected == 6)
+        {
+            // Record demo starts a new game; the recording is stored when it is stopped
+            command = (m_demoRecording) ? MenuCommandStopDemoRecording : MenuCommandRecordDemo;
+            m_menuActive = false;
+        }
+        else if (m_menuItemSelected == 7)
+        {
+            command = MenuCommandPlayDemo;
+            m_menuActive = false;
+        }
+        else if (m_menuItemSelected == 8)
         {
             command = MenuCommandExitGame;
         }
@@ -578,7 +590,9 @@ void ExtraMenu::Draw(IRenderer& renderer, EgaGraph* const egaGraph)
         renderer.RenderTextLeftAligned("Video", egaGraph->GetFont(3), (m_menuItemSelected == 3) ? EgaBrightCyan : EgaBrightWhite,xOffset,60);
         renderer.RenderTextLeftAligned("Sound", egaGraph->GetFont(3), (m_menuItemSelected == 4) ? EgaBrightCyan : EgaBrightWhite,xOffset,70);
         renderer.RenderTextLeftAligned("Controls", egaGraph->GetFont(3), (m_menuItemSelected == 5) ? EgaBrightCyan : EgaBrightWhite,xOffset,80);
-        renderer.RenderTextLeftAligned("Quit", egaGraph->GetFont(3), (m_menuItemSelected == 6) ? EgaBrightCyan : EgaBrightWhite,xOffset,90);          
+        renderer.RenderTextLeftAligned((m_demoRecording) ? "Stop recording" : "Record demo", egaGraph->GetFont(3), (m_menuItemSelected == 6) ? EgaBrightCyan : EgaBrightWhite,xOffset,90);
+        renderer.RenderTextLeftAligned("Play demo", egaGraph->GetFont(3), (m_menuItemSelected == 7) ? EgaBrightCyan : EgaBrightWhite,xOffset,100);
+        renderer.RenderTextLeftAligned("Quit", egaGraph->GetFont(3), (m_menuItemSelected == 8) ? EgaBrightCyan : EgaBrightWhite,xOffset,110);
     }
     else if (m_subMenuSelected == subMenuVideo)
     {
@@ -592,7 +606,7 @@ void ExtraMenu::Draw(IRenderer& renderer, EgaGraph* const egaGraph)
         renderer.RenderTextLeftAligned(aspectRatioStr, egaGraph->GetFont(3), (m_menuItemSelected == 1) ? EgaBrightCyan : EgaBrightWhite,xOffset2,40);
         renderer.RenderTextLeftAligned("Field Of View (Y)", egaGraph->GetFont(3), (m_menuItemSelected == 2) ? EgaBrightCyan : EgaBrightWhite,xOffset,50);
         char fovStr[40];
-        sprintf_s(fovStr, 40, "%d", m_configurationSettings.GetFov());
+        snprintf(fovStr, 40, "%d", m_configurationSettings.GetFov());
         renderer.RenderTextLeftAligned(fovStr, egaGraph->GetFont(3), (m_menuItemSelected == 2) ? EgaBrightCyan : EgaBrightWhite,xOffset2,50);
         renderer.RenderTextLeftAligned("Texture filtering", egaGraph->GetFont(3), (m_menuItemSelected == 3) ? EgaBrightCyan : EgaBrightWhite,xOffset,60);
         const char* textureFilterStr = (m_configurationSettings.GetTextureFilter() == IRenderer::Nearest) ? "Nearest" : "Linear";
@@ -647,7 +661,7 @@ void ExtraMenu::Draw(IRenderer& renderer, EgaGraph* const egaGraph)
             {
                 renderer.RenderTextLeftAligned("Mouse Sensitiv.", egaGraph->GetFont(3), (m_menuItemSelected == index + m_menuItemOffset) ? EgaBrightCyan : EgaBrightWhite,xOffset,30 + (index * 10));
                 char mouseSensitivityStr[5];
-                sprintf_s(mouseSensitivityStr, 5, "%d", m_configurationSettings.GetMouseSensitivity());
+                snprintf(mouseSensitivityStr, 5, "%d", m_configurationSettings.GetMouseSensitivity());
                 renderer.RenderTextLeftAligned(mouseSensitivityStr, egaGraph->GetFont(3), (m_menuItemSelected == index + m_menuItemOffset) ? EgaBrightCyan : EgaBrightWhite,xOffset2,30 + (index * 10));
             }
             index++;
@@ -728,6 +742,11 @@ void ExtraMenu::SetSaveGameEnabled(const bool enabled)
     m_saveGameEnabled = enabled;
 }
 
+void ExtraMenu::SetDemoRecording(const bool recording)
+{
+    m_demoRecording = recording;
+}
+
 const std::string& ExtraMenu::GetNewSaveGameName() const
 {
     return m_newSaveGameName;
@@ -34,7 +34,10 @@ enum MenuCommand
     MenuCommandStartNewGame,
     MenuCommandExitGame,
     MenuCommandSaveGame,
-    MenuCommandLoadGame
+    MenuCommandLoadGame,
+    MenuCommandRecordDemo,
+    MenuCommandStopDemoRecording,
+    MenuCommandPlayDemo
 };
 
 class ExtraMenu
@@ -46,6 +49,7 @@ public:
     MenuCommand ProcessInput(const PlayerInput& playerInput);
     void Draw(IRenderer& renderer, EgaGraph* const egaGraph);
     void SetSaveGameEnabled(const bool enabled);
+    void SetDemoRecording(const bool recording);
     const std::string& GetNewSaveGameName() const;
     void OpenRestoreGameMenu();
     void OpenSaveGameMenu();
@@ -66,6 +70,7 @@ private:
 	bool m_waitingForKeyToBind;
     bool m_waitingForNewSaveGameName;
     bool m_saveGameEnabled;
+    bool m_demoRecording;
 
     ConfigurationSettings& m_configurationSettings;
     AudioPlayer& m_audioPlayer;
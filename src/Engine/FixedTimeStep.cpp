@@ -0,0 +1,85 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "FixedTimeStep.h"
+
+const float FixedTimeStep::MillisecondsPerTick = 1000.0f / (float)FixedTimeStep::TicksPerSecond;
+
+FixedTimeStep::FixedTimeStep() :
+    m_tick(0),
+    m_targetTick(0),
+    m_interpolation(0.0f),
+    m_started(false)
+{
+
+}
+
+FixedTimeStep::~FixedTimeStep()
+{
+
+}
+
+void FixedTimeStep::Reset()
+{
+    m_tick = 0;
+    m_targetTick = 0;
+    m_interpolation = 0.0f;
+    m_started = false;
+}
+
+void FixedTimeStep::SetTime(const uint32_t timeStamp)
+{
+    const uint64_t scaledTime = (uint64_t)timeStamp * TicksPerSecond;
+    m_targetTick = (uint32_t)(scaledTime / 1000);
+    m_interpolation = (float)(scaledTime % 1000) / 1000.0f;
+
+    if (!m_started || m_targetTick < m_tick)
+    {
+        // Start counting from the current time, without catching up on earlier ticks.
+        m_tick = m_targetTick;
+        m_started = true;
+    }
+    else if (m_targetTick - m_tick > MaxTicksPerFrame)
+    {
+        // Too far behind; drop the ticks that cannot be caught up with in one frame.
+        m_tick = m_targetTick - MaxTicksPerFrame;
+    }
+}
+
+bool FixedTimeStep::RunNextTick()
+{
+    if (m_tick >= m_targetTick)
+    {
+        return false;
+    }
+
+    m_tick++;
+    return true;
+}
+
+uint32_t FixedTimeStep::GetTick() const
+{
+    return m_tick;
+}
+
+uint32_t FixedTimeStep::GetTimeStampOfTick() const
+{
+    return (uint32_t)(((uint64_t)m_tick * 1000 + TicksPerSecond - 1) / TicksPerSecond);
+}
+
+float FixedTimeStep::GetInterpolation() const
+{
+    // While ticks are pending, the last simulated state is still behind the current time.
+    return (m_tick == m_targetTick) ? m_interpolation : 1.0f;
+}
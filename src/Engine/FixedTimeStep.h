@@ -0,0 +1,49 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// FixedTimeStep
+//
+// Divides the elapsed time into ticks of a fixed duration, matching the 70 Hz tics of the original engine.
+// The world is simulated once per tick, independent of the frame rate. When rendering is slower than the
+// tick rate, multiple ticks are run per frame. The remaining fraction of a tick is used to interpolate
+// between the last two simulated states.
+//
+#pragma once
+#include <stdint.h>
+
+class FixedTimeStep
+{
+public:
+    FixedTimeStep();
+    ~FixedTimeStep();
+
+    void Reset();
+    void SetTime(const uint32_t timeStamp);
+    bool RunNextTick();
+
+    uint32_t GetTick() const;
+    uint32_t GetTimeStampOfTick() const;
+    float GetInterpolation() const;
+
+    static const uint32_t TicksPerSecond = 70;
+    static const uint32_t MaxTicksPerFrame = 10;
+    static const float MillisecondsPerTick;
+
+private:
+    uint32_t m_tick;
+    uint32_t m_targetTick;
+    float m_interpolation;
+    bool m_started;
+};
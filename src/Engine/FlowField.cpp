@@ -0,0 +1,112 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "FlowField.h"
+#include "Level.h"
+#include <algorithm>
+
+const uint16_t FlowField::Unreachable;
+
+FlowField::FlowField(const uint16_t width, const uint16_t height) :
+    m_width(width),
+    m_height(height),
+    m_distances(width * height, Unreachable),
+    m_queue(width * height, 0),
+    m_computed(false),
+    m_targetX(0),
+    m_targetY(0),
+    m_wallsRevision(0)
+{
+
+}
+
+FlowField::~FlowField()
+{
+
+}
+
+// Every tile is put in the queue at most once, so the search takes time linear in the size of the level.
+void FlowField::Compute(const Level& level, const uint16_t targetX, const uint16_t targetY, const uint32_t wallsRevision)
+{
+    m_computed = true;
+    m_targetX = targetX;
+    m_targetY = targetY;
+    m_wallsRevision = wallsRevision;
+    std::fill(m_distances.begin(), m_distances.end(), Unreachable);
+
+    if (targetX >= m_width || targetY >= m_height || level.IsSolidWall(targetX, targetY))
+    {
+        return;
+    }
+
+    const int8_t neighbourX[4] = { 0, 1, 0, -1 };
+    const int8_t neighbourY[4] = { -1, 0, 1, 0 };
+
+    uint32_t head = 0;
+    uint32_t tail = 0;
+    const uint16_t targetIndex = (targetY * m_width) + targetX;
+    m_distances[targetIndex] = 0;
+    m_queue[tail++] = targetIndex;
+
+    while (head < tail)
+    {
+        const uint16_t index = m_queue[head++];
+        const uint16_t x = index % m_width;
+        const uint16_t y = index / m_width;
+        const uint16_t distance = m_distances[index] + 1;
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            const int32_t nextX = x + neighbourX[i];
+            const int32_t nextY = y + neighbourY[i];
+            if (nextX < 0 || nextY < 0 || nextX >= m_width || nextY >= m_height)
+            {
+                continue;
+            }
+
+            const uint16_t nextIndex = (uint16_t)((nextY * m_width) + nextX);
+            if (m_distances[nextIndex] != Unreachable || level.IsSolidWall((uint16_t)nextX, (uint16_t)nextY))
+            {
+                continue;
+            }
+
+            m_distances[nextIndex] = distance;
+            m_queue[tail++] = nextIndex;
+        }
+    }
+}
+
+bool FlowField::IsComputedFor(const uint16_t targetX, const uint16_t targetY, const uint32_t wallsRevision) const
+{
+    return m_computed && m_targetX == targetX && m_targetY == targetY && m_wallsRevision == wallsRevision;
+}
+
+uint16_t FlowField::GetTargetX() const
+{
+    return m_targetX;
+}
+
+uint16_t FlowField::GetTargetY() const
+{
+    return m_targetY;
+}
+
+uint16_t FlowField::GetDistance(const int32_t x, const int32_t y) const
+{
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height)
+    {
+        return Unreachable;
+    }
+
+    return m_distances[(y * m_width) + x];
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// FlowField
+//
+// Distance field over the tiles of a level, computed with a breadth-first search from a target tile.
+// Each open tile holds the number of steps towards the target, such that a chasing actor can pick the best
+// neighbouring tile without searching. Solid walls and closed doors block the search; actors do not, as they
+// move around all the time and are checked when the actor takes its step.
+//
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+class Level;
+
+class FlowField
+{
+public:
+    FlowField(const uint16_t width, const uint16_t height);
+    ~FlowField();
+
+    void Compute(const Level& level, const uint16_t targetX, const uint16_t targetY, const uint32_t wallsRevision);
+    bool IsComputedFor(const uint16_t targetX, const uint16_t targetY, const uint32_t wallsRevision) const;
+    uint16_t GetTargetX() const;
+    uint16_t GetTargetY() const;
+    uint16_t GetDistance(const int32_t x, const int32_t y) const;
+
+    static const uint16_t Unreachable = 0xFFFF;
+
+private:
+    const uint16_t m_width;
+    const uint16_t m_height;
+    std::vector<uint16_t> m_distances;
+    std::vector<uint16_t> m_queue;
+    bool m_computed;
+    uint16_t m_targetX;
+    uint16_t m_targetY;
+    uint32_t m_wallsRevision;
+};
+
@@ -14,10 +14,23 @@
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
 
 #include "GameTimer.h"
-#include "..\..\ThirdParty\SDL\include\SDL_timer.h"
+#include "ClockSdl.h"
 #include <fstream>
 
-GameTimer::GameTimer()
+static const IClock& GetSdlClock()
+{
+    static const ClockSdl sdlClock;
+    return sdlClock;
+}
+
+GameTimer::GameTimer() :
+    GameTimer(GetSdlClock())
+{
+
+}
+
+GameTimer::GameTimer(const IClock& clock) :
+    m_clock(&clock)
 {
     m_paused = true;
     uint32_t currentTime = GetCurrentTime();
@@ -32,6 +45,19 @@ GameTimer::~GameTimer()
 
 }
 
+// Switches to another source of time, without changing the time of the player and the world.
+void GameTimer::SetClock(const IClock& clock)
+{
+    const uint32_t playerTime = GetMillisecondsForPlayer();
+    m_clock = &clock;
+    m_startTimeForPlayer = GetCurrentTime() - playerTime;
+}
+
+const IClock& GameTimer::GetClock() const
+{
+    return *m_clock;
+}
+
 uint32_t GameTimer::GetMillisecondsForPlayer() const
 {
     const uint32_t currentTime = m_paused ? m_pauseTime : (uint32_t)(GetCurrentTime() - m_startTimeForPlayer);
@@ -45,7 +71,13 @@ uint32_t GameTimer::GetTicksForPlayer() const
 
 uint32_t GameTimer::GetMilliSecondsForWorld()
 {
-    const uint32_t deltaMilliSeconds = GetMillisecondsForPlayer();
+    return GetMilliSecondsForWorld(GetMillisecondsForPlayer());
+}
+
+// Converts a point in time of the player into the time of the world, which stands still while time is frozen.
+uint32_t GameTimer::GetMilliSecondsForWorld(const uint32_t millisecondsForPlayer)
+{
+    const uint32_t deltaMilliSeconds = millisecondsForPlayer;
     if (m_freezeStartTime != 0)
     {
         if (m_freezeStartTime + 50000 > deltaMilliSeconds)
@@ -99,6 +131,11 @@ void GameTimer::Resume()
     }
 }
 
+bool GameTimer::IsPaused() const
+{
+    return m_paused;
+}
+
 void GameTimer::FreezeTime()
 {
     const uint32_t playerTime = GetMillisecondsForPlayer();
@@ -109,9 +146,9 @@ void GameTimer::FreezeTime()
     m_freezeStartTime = playerTime;
 }
 
-uint32_t GameTimer::GetCurrentTime()
+uint32_t GameTimer::GetCurrentTime() const
 {
-    return SDL_GetTicks();
+    return m_clock->GetMilliseconds();
 }
 
 uint32_t GameTimer::GetRemainingFreezeTime()
@@ -158,4 +195,4 @@ bool GameTimer::LoadFromFile(std::ifstream& file)
     m_paused = false;
 
     return true;
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -17,27 +17,35 @@
 // GameTimer
 //
 // Keeps track of the time. Used for animations, movement, etc.
+// The time is read from an IClock; by default the real time clock of SDL.
 //
 #pragma once
 
 #include <stdint.h>
 #include <fstream>
+#include "IClock.h"
 
 class GameTimer
 {
 public:
     GameTimer();
+    GameTimer(const IClock& clock);
     ~GameTimer();
 
+    void SetClock(const IClock& clock);
+    const IClock& GetClock() const;
+
     uint32_t GetMillisecondsForPlayer() const;
     uint32_t GetTicksForPlayer() const;
     uint32_t GetMilliSecondsForWorld();
+    uint32_t GetMilliSecondsForWorld(const uint32_t millisecondsForPlayer);
     uint32_t GetTicksForWorld();
     uint32_t GetActualTime();
 
     void Reset();
     void Pause();
     void Resume();
+    bool IsPaused() const;
     void FreezeTime();
     uint32_t GetRemainingFreezeTime();
 
@@ -45,8 +53,9 @@ public:
     bool LoadFromFile(std::ifstream& file);
 
 private:
-    static uint32_t GetCurrentTime();
+    uint32_t GetCurrentTime() const;
 
+    const IClock* m_clock;
     int64_t m_startTimeForPlayer;
     uint32_t m_pauseTime;
     uint32_t m_freezeStartTime;
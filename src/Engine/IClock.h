@@ -0,0 +1,30 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// IClock
+//
+// Abstract interface towards a source of time in milliseconds. The GameTimer derives the time of the player and of
+// the world from it, such that the game can run on the system clock, on a manually stepped clock or faster or slower
+// than real time.
+//
+#pragma once
+
+#include <stdint.h>
+
+class IClock
+{
+public:
+    virtual uint32_t GetMilliseconds() const = 0;
+};
@@ -40,16 +40,16 @@ enum DifficultyLevel
 class IGame
 {
 public:
-    virtual void SpawnActors(Level* level, const DifficultyLevel difficultyLevel) = NULL;
-    virtual void DrawStatusBar(const int16_t health, const std::string& locationMessage, const PlayerInventory& playerInventory) = NULL;
-    virtual GameMaps* GetGameMaps() = NULL;
-    virtual EgaGraph* GetEgaGraph() = NULL;
-    virtual AudioRepository* GetAudioRepository() = NULL;
-    virtual AudioPlayer* GetAudioPlayer() = NULL;
-    virtual IIntroView* GetIntroView() = NULL;
-    virtual const std::map<uint16_t, const DecorateActor>& GetDecorateActors() const = NULL;
-    virtual const std::string& GetName() const = NULL;
-    virtual const uint8_t GetId() const = NULL;
+    virtual void SpawnActors(Level* level, const DifficultyLevel difficultyLevel, Random& random) = 0;
+    virtual void DrawStatusBar(const int16_t health, const std::string& locationMessage, const PlayerInventory& playerInventory) = 0;
+    virtual GameMaps* GetGameMaps() = 0;
+    virtual EgaGraph* GetEgaGraph() = 0;
+    virtual AudioRepository* GetAudioRepository() = 0;
+    virtual AudioPlayer* GetAudioPlayer() = 0;
+    virtual IIntroView* GetIntroView() = 0;
+    virtual const std::map<uint16_t, const DecorateActor>& GetDecorateActors() const = 0;
+    virtual const std::string& GetName() const = 0;
+    virtual const uint8_t GetId() const = 0;
 
 protected:
     GameMaps* m_gameMaps;
@@ -27,6 +27,7 @@
 #include "EgaColor.h"
 
 class Font;
+class SpriteQueue;
 
 class IRenderer
 {
@@ -44,43 +45,48 @@ public:
         Linear
     };
 
-    virtual void Setup() = NULL;
-    virtual void SetWindowDimensions(const uint16_t windowWidth, const uint16_t windowHeight) = NULL;
-    virtual void SetPlayerAngle(const float angle) = NULL;
-    virtual void SetPlayerPosition(const float posX, const float posY) = NULL;
-    virtual void SetTextureFilter(const TextureFilterSetting textureFilter) = NULL;
-    virtual void SetVSync(const bool enabled) = NULL;
-    virtual bool IsVSyncSupported() = NULL;
-    virtual uint32_t LoadFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height, const bool transparent) = NULL;
-    virtual uint32_t LoadMaskedFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height) = NULL;
-    virtual uint32_t LoadTilesSize8MaskedIntoTexture(const FileChunk* decompressedChunk) = NULL;
-    virtual uint32_t LoadFontIntoTexture(const bool* fontPicture) = NULL;
+    virtual void Setup() = 0;
+    virtual void SetWindowDimensions(const uint16_t windowWidth, const uint16_t windowHeight) = 0;
+    virtual void SetPlayerAngle(const float angle) = 0;
+    virtual void SetPlayerPosition(const float posX, const float posY) = 0;
+    virtual void SetTextureFilter(const TextureFilterSetting textureFilter) = 0;
+    virtual void SetVSync(const bool enabled) = 0;
+    virtual bool IsVSyncSupported() = 0;
+    virtual uint32_t LoadFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height, const bool transparent) = 0;
+    virtual uint32_t LoadMaskedFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height) = 0;
+    virtual uint32_t LoadTilesSize8MaskedIntoTexture(const FileChunk* decompressedChunk) = 0;
+    virtual uint32_t LoadFontIntoTexture(const bool* fontPicture) = 0;
+    virtual void UnloadTexture(const uint32_t textureId) = 0;
 
-    virtual void RenderTextLeftAligned(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) = NULL;
-    virtual void RenderTextCentered(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) = NULL;
-    virtual void RenderNumber(const uint16_t value, const Font* font, const uint8_t maxDigits, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) = NULL;
+    virtual void RenderTextLeftAligned(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) = 0;
+    virtual void RenderTextCentered(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) = 0;
+    virtual void RenderNumber(const uint16_t value, const Font* font, const uint8_t maxDigits, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) = 0;
 
-    virtual void Prepare2DRendering() = NULL;
-    virtual void Unprepare2DRendering() = NULL;
-    virtual void Render2DPicture(const Picture* picture, const uint16_t offsetX, const uint16_t offsetY) = NULL;
-    virtual void Render2DTileSize8Masked(const Picture* tiles, const uint16_t tileIndex, const uint16_t offsetX, const uint16_t offsetY) = NULL;
-    virtual void Render2DBar(const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height, const egaColor colorIndex) = NULL;
-    virtual void RenderRadarBlip(const float x, const float y, const egaColor colorIndex) = NULL;
+    virtual void Prepare2DRendering() = 0;
+    virtual void Unprepare2DRendering() = 0;
+    virtual void Render2DPicture(const Picture* picture, const uint16_t offsetX, const uint16_t offsetY) = 0;
+    virtual void Render2DTileSize8Masked(const Picture* tiles, const uint16_t tileIndex, const uint16_t offsetX, const uint16_t offsetY) = 0;
+    virtual void Render2DBar(const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height, const egaColor colorIndex) = 0;
+    virtual void RenderRadarBlip(const float x, const float y, const egaColor colorIndex) = 0;
 
-    virtual void Prepare3DRendering(const bool depthShading, const float aspectRatio, uint16_t fov) = NULL;
+    // Retained layers: a rectangle of the 2D screen is captured after it is rendered, such that it can be drawn
+    // again with a single call. RenderLayer returns false when the layer is not available (anymore).
+    virtual void CaptureLayer(const uint8_t layerId, const uint16_t offsetX, const uint16_t offsetY, const uint16_t width, const uint16_t height) = 0;
+    virtual bool RenderLayer(const uint8_t layerId) = 0;
 
-    virtual void PrepareWalls() = NULL;
-    virtual void UnprepareWalls() = NULL;
-    virtual void Render3DWall(const Picture* picture, const int16_t tileX, const int16_t tileY, const int16_t orientation) = NULL;
-    virtual void Render3DSprite(const Picture* picture, const float offsetX, const float offsetY) = NULL;
+    virtual void Prepare3DRendering(const bool depthShading, const float aspectRatio, uint16_t fov) = 0;
 
-    virtual void AddSprite(const Picture* picture, const float offsetX, const float offsetY) = NULL;
-    virtual void RenderAllSprites() = NULL;
-    virtual void PrepareFloorAndCeiling() = NULL;
-    virtual void UnprepareFloorAndCeiling() = NULL;
-    virtual void RenderFloor(const uint16_t tileX, const uint16_t tileY, const egaColor colorIndex) = NULL;
-    virtual void RenderCeiling(const uint16_t tileX, const uint16_t tileY, const egaColor colorIndex) = NULL;
+    virtual void PrepareWalls() = 0;
+    virtual void UnprepareWalls() = 0;
+    virtual void Render3DWall(const Picture* picture, const int16_t tileX, const int16_t tileY, const int16_t orientation) = 0;
+    virtual void Render3DSprite(const Picture* picture, const float offsetX, const float offsetY) = 0;
 
-    virtual void PrepareVisibilityMap() = NULL;
-    virtual void UnprepareVisibilityMap() = NULL;
+    virtual void RenderSprites(const SpriteQueue& spriteQueue) = 0;
+    virtual void PrepareFloorAndCeiling() = 0;
+    virtual void UnprepareFloorAndCeiling() = 0;
+    virtual void RenderFloor(const uint16_t tileX, const uint16_t tileY, const egaColor colorIndex) = 0;
+    virtual void RenderCeiling(const uint16_t tileX, const uint16_t tileY, const egaColor colorIndex) = 0;
+
+    virtual void PrepareVisibilityMap() = 0;
+    virtual void UnprepareVisibilityMap() = 0;
 };
@@ -26,7 +26,7 @@
 class ISystem
 {
 public:
-        virtual const std::string& GetConfigurationFilePath() const = NULL;
-        virtual void GetSavedGameNamesFromFolder(const std::string& path, std::vector<std::string>& filesFound) const = NULL;
-        virtual bool CreatePath(const std::string& path) const = NULL;
+        virtual const std::string& GetConfigurationFilePath() const = 0;
+        virtual void GetSavedGameNamesFromFolder(const std::string& path, std::vector<std::string>& filesFound) const = 0;
+        virtual bool CreatePath(const std::string& path) const = 0;
 };
\ No newline at end of file
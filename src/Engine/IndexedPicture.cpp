@@ -0,0 +1,154 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "IndexedPicture.h"
+#include "EgaColor.h"
+
+IndexedPicture::IndexedPicture() :
+    m_width(0),
+    m_height(0),
+    m_colorIndices(),
+    m_transparency()
+{
+
+}
+
+// A new picture is fully transparent.
+IndexedPicture::IndexedPicture(const uint16_t width, const uint16_t height) :
+    m_width(width),
+    m_height(height),
+    m_colorIndices((((uint32_t)width * height) + 1) / 2, 0),
+    m_transparency((((uint32_t)width * height) + 7) / 8, 0xFF)
+{
+
+}
+
+IndexedPicture::~IndexedPicture()
+{
+
+}
+
+// Decodes EGA planar data, starting at the given row. Each plane holds 8 pixels per byte, with the leftmost pixel
+// in the most significant bit. Masked data starts with a transparency plane, followed by the blue, green, red and
+// intensity planes. Unmasked data only has the four color planes, in which magenta can act as transparent color.
+void IndexedPicture::DecodePlanes(const uint8_t* planes, const uint32_t planeSize, const bool masked, const bool magentaIsTransparent, const uint16_t firstRow)
+{
+    const uint8_t* colorPlanes = masked ? planes + planeSize : planes;
+    const uint32_t firstPixel = (uint32_t)firstRow * m_width;
+    const uint32_t numberOfPixels = (uint32_t)m_width * m_height;
+    for (uint32_t i = 0; i < planeSize && firstPixel + (i * 8) < numberOfPixels; i++)
+    {
+        for (int j = 0; j < 8; j++)
+        {
+            const bool blueplane = ((colorPlanes[i] & (1 << j)) > 0);
+            const bool greenplane = ((colorPlanes[i + planeSize] & (1 << j)) > 0);
+            const bool redplane = ((colorPlanes[i + (2 * planeSize)] & (1 << j)) > 0);
+            const bool intensityplane = ((colorPlanes[i + (3 * planeSize)] & (1 << j)) > 0);
+            const uint8_t colorIndex = (intensityplane ? EgaDarkGray : EgaBlack) + (redplane ? EgaRed : EgaBlack) + (greenplane ? EgaGreen : EgaBlack) + (blueplane ? EgaBlue : EgaBlack);
+            const bool transparent = masked ? ((planes[i] & (1 << j)) > 0) : (magentaIsTransparent && colorIndex == EgaMagenta);
+            const uint32_t pixelIndex = firstPixel + (i * 8) + (7 - j);
+            if (pixelIndex < numberOfPixels)
+            {
+                SetPixel((uint16_t)(pixelIndex % m_width), (uint16_t)(pixelIndex / m_width), transparent ? TransparentPixel : colorIndex);
+            }
+        }
+    }
+}
+
+// Setting a pixel to TransparentPixel makes it transparent; any other value is stored as a 4-bit color index.
+void IndexedPicture::SetPixel(const uint16_t x, const uint16_t y, const uint8_t colorIndex)
+{
+    const uint32_t pixelIndex = ((uint32_t)y * m_width) + x;
+    const uint8_t transparencyBit = (uint8_t)(1 << (pixelIndex & 7));
+    const uint8_t shift = (uint8_t)((pixelIndex & 1) << 2);
+    uint8_t& colorIndices = m_colorIndices[pixelIndex >> 1];
+    if (colorIndex == TransparentPixel)
+    {
+        m_transparency[pixelIndex >> 3] |= transparencyBit;
+        colorIndices &= ~(0x0F << shift);
+    }
+    else
+    {
+        m_transparency[pixelIndex >> 3] &= ~transparencyBit;
+        colorIndices = (uint8_t)((colorIndices & ~(0x0F << shift)) | ((colorIndex & 0x0F) << shift));
+    }
+}
+
+void IndexedPicture::Clear()
+{
+    m_width = 0;
+    m_height = 0;
+    std::vector<uint8_t>().swap(m_colorIndices);
+    std::vector<uint8_t>().swap(m_transparency);
+}
+
+uint16_t IndexedPicture::GetWidth() const
+{
+    return m_width;
+}
+
+uint16_t IndexedPicture::GetHeight() const
+{
+    return m_height;
+}
+
+bool IndexedPicture::IsEmpty() const
+{
+    return m_colorIndices.empty();
+}
+
+uint32_t IndexedPicture::GetSizeInBytes() const
+{
+    return (uint32_t)(m_colorIndices.size() + m_transparency.size());
+}
+
+// Creates the next level of a mip chain. Averaged colors cannot be represented in the palette, so each pixel
+// takes the most common value of the 2x2 block it covers, with transparency counting as a value of its own.
+// On a tie the first value in the block wins, scanning from the top left.
+IndexedPicture IndexedPicture::CreateHalfSize() const
+{
+    const uint16_t halfWidth = (m_width > 1) ? m_width / 2 : 1;
+    const uint16_t halfHeight = (m_height > 1) ? m_height / 2 : 1;
+    IndexedPicture halfSize(halfWidth, halfHeight);
+    for (uint16_t y = 0; y < halfHeight; y++)
+    {
+        for (uint16_t x = 0; x < halfWidth; x++)
+        {
+            const uint16_t left = x * 2;
+            const uint16_t top = y * 2;
+            const uint16_t right = (left + 1 < m_width) ? left + 1 : left;
+            const uint16_t bottom = (top + 1 < m_height) ? top + 1 : top;
+            const uint8_t block[4] = { GetPixel(left, top), GetPixel(right, top), GetPixel(left, bottom), GetPixel(right, bottom) };
+
+            uint8_t bestValue = block[0];
+            uint8_t bestCount = 0;
+            for (uint8_t i = 0; i < 4; i++)
+            {
+                uint8_t count = 0;
+                for (uint8_t j = 0; j < 4; j++)
+                {
+                    count += (block[j] == block[i]) ? 1 : 0;
+                }
+                if (count > bestCount)
+                {
+                    bestValue = block[i];
+                    bestCount = count;
+                }
+            }
+            halfSize.SetPixel(x, y, bestValue);
+        }
+    }
+
+    return halfSize;
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// IndexedPicture
+//
+// Picture in the 16 color EGA palette, stored as packed 4-bit color indices plus a transparency bit per pixel.
+// The palette lookup is left to the renderer, either while drawing or when uploading the picture to a texture.
+//
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+class IndexedPicture
+{
+public:
+    IndexedPicture();
+    IndexedPicture(const uint16_t width, const uint16_t height);
+    ~IndexedPicture();
+
+    void DecodePlanes(const uint8_t* planes, const uint32_t planeSize, const bool masked, const bool magentaIsTransparent, const uint16_t firstRow);
+    void SetPixel(const uint16_t x, const uint16_t y, const uint8_t colorIndex);
+    void Clear();
+    IndexedPicture CreateHalfSize() const;
+
+    uint16_t GetWidth() const;
+    uint16_t GetHeight() const;
+    bool IsEmpty() const;
+    uint32_t GetSizeInBytes() const;
+
+    // The pixel accessors are called for every drawn texel by the software renderer, hence defined inline.
+    bool IsTransparent(const uint16_t x, const uint16_t y) const
+    {
+        const uint32_t pixelIndex = ((uint32_t)y * m_width) + x;
+        return (m_transparency[pixelIndex >> 3] & (1 << (pixelIndex & 7))) != 0;
+    }
+
+    uint8_t GetColorIndex(const uint16_t x, const uint16_t y) const
+    {
+        const uint32_t pixelIndex = ((uint32_t)y * m_width) + x;
+        return (m_colorIndices[pixelIndex >> 1] >> ((pixelIndex & 1) << 2)) & 0x0F;
+    }
+
+    // Returns TransparentPixel for a transparent pixel, otherwise the color index.
+    uint8_t GetPixel(const uint16_t x, const uint16_t y) const
+    {
+        return IsTransparent(x, y) ? TransparentPixel : GetColorIndex(x, y);
+    }
+
+    static const uint8_t TransparentPixel = 0xFF;
+
+private:
+    uint16_t m_width;
+    uint16_t m_height;
+    std::vector<uint8_t> m_colorIndices;
+    std::vector<uint8_t> m_transparency;
+};
+
@@ -15,9 +15,11 @@
 
 #include "Level.h"
 #include "PlayerInventory.h"
-#include "EgaGraph.h"
-#include "..\Abyss\DecorateMisc.h"
-#include "..\Abyss\DecorateBonus.h"
+#include "WorldSnapshot.h"
+#include "../Abyss/DecorateMisc.h"
+#include "../Abyss/DecorateBonus.h"
+#include "../Abyss/DecorateMonsters.h"
+#include <cstring>
 
 Level::Level(const uint8_t mapIndex, const uint16_t mapWidth, const uint16_t mapHeight, const uint16_t* plane0, const uint16_t* plane2, const LevelInfo& mapInfo, const std::vector<WallInfo>& wallsInfo):
     m_levelWidth (mapWidth),
@@ -26,12 +28,21 @@ Level::Level(const uint8_t mapIndex, const uint16_t mapWidth, const uint16_t map
     m_wallsInfo (wallsInfo),
     m_lightningStartTimestamp(0),
     m_levelIndex(mapIndex),
+    m_lightningRandom(mapIndex, RandomStreamLightning),
     m_visibilityMap(NULL),
     m_playerActor(new Actor(0, 0, 0, decoratePlayer)),
     m_blockingActors(NULL),
-    m_nonBlockingActors(NULL),
+    m_blockingActorStore(),
+    m_nonBlockingActorStore(),
+    m_wakeUpWheel(),
+    m_dueActors(),
     m_wallXVisible(NULL),
-    m_wallYVisible(NULL)
+    m_wallYVisible(NULL),
+    m_wallsRevision(0),
+    m_flowFields(ChaseBottomRightCorner + 1, FlowField(mapWidth, mapHeight)),
+    m_spatialHash(mapWidth, mapHeight),
+    m_timeStampOfWorld(0),
+    m_worldTimeAdvanced(false)
 {
     const uint16_t mapSize = m_levelWidth * m_levelHeight;
     m_plane0 = new uint16_t[mapSize];
@@ -50,14 +61,66 @@ Level::Level(const uint8_t mapIndex, const uint16_t mapWidth, const uint16_t map
         m_blockingActors[i] = NULL;
     }
 
-    m_nonBlockingActors = new Actor*[100];
-    for ( uint16_t i = 0; i < 100; i++)
+    m_wallXVisible = new bool[m_levelWidth * m_levelHeight];
+    m_wallYVisible = new bool[m_levelWidth * m_levelHeight];
+}
+
+// Creates a deep copy of the given level, including all its actors. Used to re-enter a level from a pristine
+// copy, without decoding the map and spawning the actors again.
+Level::Level(const Level& level) :
+    m_levelWidth(level.m_levelWidth),
+    m_levelHeight(level.m_levelHeight),
+    m_levelInfo(level.m_levelInfo),
+    m_wallsInfo(level.m_wallsInfo),
+    m_lightningStartTimestamp(level.m_lightningStartTimestamp),
+    m_levelIndex(level.m_levelIndex),
+    m_lightningRandom(level.m_lightningRandom),
+    m_visibilityMap(NULL),
+    m_playerActor(new Actor(*level.m_playerActor)),
+    m_blockingActors(NULL),
+    m_blockingActorStore(),
+    m_nonBlockingActorStore(),
+    m_wakeUpWheel(),
+    m_dueActors(),
+    m_wallXVisible(NULL),
+    m_wallYVisible(NULL),
+    m_wallsRevision(0),
+    m_flowFields(ChaseBottomRightCorner + 1, FlowField(level.m_levelWidth, level.m_levelHeight)),
+    m_spatialHash(level.m_levelWidth, level.m_levelHeight),
+    m_timeStampOfWorld(level.m_timeStampOfWorld),
+    m_worldTimeAdvanced(level.m_worldTimeAdvanced)
+{
+    const uint16_t mapSize = m_levelWidth * m_levelHeight;
+    m_plane0 = new uint16_t[mapSize];
+    m_plane2 = new uint16_t[mapSize];
+    std::memcpy(m_plane0, level.m_plane0, mapSize * sizeof(uint16_t));
+    std::memcpy(m_plane2, level.m_plane2, mapSize * sizeof(uint16_t));
+
+    m_visibilityMap = new bool[mapSize];
+
+    m_blockingActors = new Actor*[mapSize];
+    for (uint16_t i = 0; i < mapSize; i++)
     {
-        m_nonBlockingActors[i] = NULL;
+        m_blockingActors[i] = NULL;
     }
 
-    m_wallXVisible = new bool[m_levelWidth * m_levelHeight];
-    m_wallYVisible = new bool[m_levelWidth * m_levelHeight];
+    for (const Actor* actor : level.m_blockingActorStore.GetActors())
+    {
+        Actor* copy = new Actor(*actor);
+        m_blockingActorStore.Add(copy);
+        if (level.GetBlockingActor(actor->GetTileX(), actor->GetTileY()) == actor)
+        {
+            m_blockingActors[(actor->GetTileY() * m_levelWidth) + actor->GetTileX()] = copy;
+        }
+    }
+
+    for (const Actor* actor : level.m_nonBlockingActorStore.GetActors())
+    {
+        m_nonBlockingActorStore.Add(new Actor(*actor));
+    }
+
+    m_wallXVisible = new bool[mapSize];
+    m_wallYVisible = new bool[mapSize];
 }
 
 bool Level::LoadActorsFromFile(std::ifstream& file, const std::map<uint16_t, const DecorateActor>& decorateActors)
@@ -95,37 +158,18 @@ Level::~Level()
 
     delete m_playerActor;
 
+    m_blockingActorStore.DeleteAll();
+
     if (m_blockingActors != NULL)
     {
-        for ( uint16_t i = 0; i < m_levelWidth * m_levelHeight; i++)
-        {
-            if (m_blockingActors[i] != NULL)
-            {
-                delete m_blockingActors[i];
-                m_blockingActors[i] = NULL;
-            }
-        }
-
         delete[] m_blockingActors;
         m_blockingActors = NULL;
     }
 
-    if (m_nonBlockingActors != NULL)
-    {
-        for ( uint16_t i = 0; i < 100; i++)
-        {
-            if (m_nonBlockingActors[i] != NULL)
-            {
-                delete m_nonBlockingActors[i];
-                m_nonBlockingActors[i] = NULL;
-            }
-        }
-        delete[] m_nonBlockingActors;
-        m_nonBlockingActors = NULL;
-    }
+    m_nonBlockingActorStore.DeleteAll();
 }
 
-void Level::StoreToFile(std::ofstream& file) const
+void Level::StoreToFile(std::ostream& file) const
 {
     file.write((const char*)&m_levelIndex, sizeof(m_levelIndex));
     file.write((const char*)&m_levelWidth, sizeof(m_levelWidth));
@@ -134,37 +178,17 @@ void Level::StoreToFile(std::ofstream& file) const
     file.write((const char*)m_plane2, m_levelWidth * m_levelHeight * sizeof(m_plane2[0]));
     file.write((const char*)&m_lightningStartTimestamp, sizeof(m_lightningStartTimestamp));
     m_playerActor->StoreToFile(file);
-    uint16_t numberOfBlockingActors = 0;
-    for (uint16_t i = 0; i < m_levelWidth * m_levelHeight; i++)
-    {
-        if (m_blockingActors[i] != NULL)
-        {
-            numberOfBlockingActors++;
-        }
-    }
+    const uint16_t numberOfBlockingActors = (uint16_t)m_blockingActorStore.GetActors().size();
     file.write((const char*)&numberOfBlockingActors, sizeof(numberOfBlockingActors));
-    for (uint16_t i = 0; i < m_levelWidth * m_levelHeight; i++)
-    {
-        if (m_blockingActors[i] != NULL)
-        {
-            m_blockingActors[i]->StoreToFile(file);
-        }
-    }
-    uint16_t numberOfNonBlockingActors = 0;
-    for (uint16_t i = 0; i < 100; i++)
+    for (const Actor* actor : m_blockingActorStore.GetActors())
     {
-        if (m_nonBlockingActors[i] != NULL)
-        {
-            numberOfNonBlockingActors++;
-        }
+        actor->StoreToFile(file);
     }
+    const uint16_t numberOfNonBlockingActors = (uint16_t)m_nonBlockingActorStore.GetActors().size();
     file.write((const char*)&numberOfNonBlockingActors, sizeof(numberOfNonBlockingActors));
-    for (uint16_t i = 0; i < 100; i++)
+    for (const Actor* actor : m_nonBlockingActorStore.GetActors())
     {
-        if (m_nonBlockingActors[i] != NULL)
-        {
-            m_nonBlockingActors[i]->StoreToFile(file);
-        }
+        actor->StoreToFile(file);
     }
 }
 
@@ -191,6 +215,9 @@ uint16_t Level::GetFloorTile(const uint16_t x, const uint16_t y) const
 void Level::SetWallTile(const uint16_t x, const uint16_t y, const uint16_t wallTile)
 {
     m_plane0[(y * m_levelWidth) + x] = wallTile;
+
+    // Invalidates the flow fields
+    m_wallsRevision++;
 }
 
 void Level::SetFloorTile(const uint16_t x, const uint16_t y, const uint16_t floorTile)
@@ -288,7 +315,7 @@ const egaColor Level::GetSkyColor(const uint32_t timeStamp)
             {
                 // All lightning frames were shown.
                 // Set the next lightning to strike between 1 and 10 seconds later.
-                const uint32_t timeToNextLightning = (1000 + rand() % 9000);
+                const uint32_t timeToNextLightning = (1000 + m_lightningRandom.Next(9000));
                 m_lightningStartTimestamp += timeToNextLightning;
             }
         }
@@ -920,19 +947,138 @@ Actor* const Level::GetPlayerActor()
     return m_playerActor;
 }
 
-Actor** Level::GetBlockingActors()
+// Returns all blocking actors in the level, in no particular order.
+const std::vector<Actor*>& Level::GetBlockingActors() const
 {
-    return m_blockingActors;
+    return m_blockingActorStore.GetActors();
 }
 
-Actor** Level::GetNonBlockingActors()
+// Returns all non-blocking actors in the level, like projectiles and bonus items, in no particular order.
+const std::vector<Actor*>& Level::GetNonBlockingActors() const
 {
-    return m_nonBlockingActors;
+    return m_nonBlockingActorStore.GetActors();
 }
 
+// Advances the animations of all active blocking actors in one pass, which is the equivalent of calling Think on
+// each of them.
+void Level::AnimateBlockingActors(const uint32_t timestamp)
+{
+    m_blockingActorStore.Think(timestamp, true);
+}
+
+// Advances the animations of all non-blocking actors in one pass. Non-blocking actors animate also when inactive.
+void Level::AnimateNonBlockingActors(const uint32_t timestamp)
+{
+    m_nonBlockingActorStore.Think(timestamp, false);
+}
+
+// Puts an actor that has nothing to do until the given time of the world to sleep. A sleeping actor does not
+// animate and should not be given any actions, until it is woken up by WakeUpActors or by a change of state.
+void Level::PutActorToSleep(Actor* actor, const uint32_t wakeUpTime)
+{
+    if (m_blockingActorStore.SetAsleep(actor, true) || m_nonBlockingActorStore.SetAsleep(actor, true))
+    {
+        m_wakeUpWheel.Schedule(actor, wakeUpTime);
+    }
+}
+
+// Wakes up all actors that are due at the given time of the world. As the world time stands still while time is
+// frozen, sleeping actors stay asleep for as long as the freeze lasts.
+void Level::WakeUpActors(const uint32_t timestamp)
+{
+    m_dueActors.clear();
+    m_wakeUpWheel.Advance(timestamp, m_dueActors);
+    for (Actor* actor : m_dueActors)
+    {
+        if (!m_blockingActorStore.SetAsleep(actor, false))
+        {
+            m_nonBlockingActorStore.SetAsleep(actor, false);
+        }
+    }
+}
+
+// Registers all blocking actors at their current position, for the collision queries of this frame.
+void Level::UpdateSpatialHash()
+{
+    m_spatialHash.Build(m_blockingActorStore.GetActors());
+}
+
+// Returns the blocking actors that a projectile with the given size hits while it moves from the start to the end
+// position, in the order in which they are hit. Only actors that were blocking at the last update are found.
+void Level::GetBlockingActorsOnPath(const float startX, const float startY, const float endX, const float endY, const float size, std::vector<Actor*>& actors) const
+{
+    m_spatialHash.GetActorsOnPath(startX, startY, endX, endY, size, actors);
+}
+
+void Level::StartTick(const uint32_t timeStampOfWorld)
+{
+    m_worldTimeAdvanced = (timeStampOfWorld != m_timeStampOfWorld);
+    m_timeStampOfWorld = timeStampOfWorld;
+}
+
+// The speed is expressed in map units per tic. Nothing moves in a tick in which time was frozen.
+float Level::GetDistanceInTick(const uint16_t speed) const
+{
+    return m_worldTimeAdvanced ? (float)speed / 65536.0f : 0.0f;
+}
+
+void Level::StorePreviousActorPositions()
+{
+    m_playerActor->StorePreviousPosition();
+
+    for (Actor* actor : m_blockingActorStore.GetActors())
+    {
+        actor->StorePreviousPosition();
+    }
+
+    for (Actor* actor : m_nonBlockingActorStore.GetActors())
+    {
+        actor->StorePreviousPosition();
+    }
+}
+
+// Places the actor on the given tile. Setting the tile to NULL only lifts the actor from the tile, as is done
+// while it walks to the next tile; it remains in the level until RemoveActor is called.
 void Level::SetBlockingActor(const uint16_t x, const uint16_t y, Actor* actor)
 {
     m_blockingActors[(y * m_levelWidth) + x] = actor;
+    m_blockingActorStore.Add(actor);
+}
+
+// Replaces the actor by another actor, both on its tile and in the list of blocking actors. The replaced
+// actor is not deleted.
+void Level::ReplaceBlockingActor(Actor* actor, Actor* replacement)
+{
+    if (!m_blockingActorStore.Replace(actor, replacement))
+    {
+        return;
+    }
+    m_wakeUpWheel.Cancel(actor);
+    m_spatialHash.Remove(actor);
+
+    if (GetBlockingActor(actor->GetTileX(), actor->GetTileY()) == actor)
+    {
+        m_blockingActors[(actor->GetTileY() * m_levelWidth) + actor->GetTileX()] = replacement;
+    }
+}
+
+// Removes the actor from its tile and from the list of blocking actors, without deleting it.
+// Returns false if the actor is not a blocking actor.
+bool Level::RemoveFromBlockingActorList(Actor* actor)
+{
+    if (!m_blockingActorStore.Remove(actor))
+    {
+        return false;
+    }
+    m_wakeUpWheel.Cancel(actor);
+    m_spatialHash.Remove(actor);
+
+    if (GetBlockingActor(actor->GetTileX(), actor->GetTileY()) == actor)
+    {
+        m_blockingActors[(actor->GetTileY() * m_levelWidth) + actor->GetTileX()] = NULL;
+    }
+
+    return true;
 }
 
 Actor* Level::GetBlockingActor(const uint16_t x, const uint16_t y) const
@@ -942,20 +1088,16 @@ Actor* Level::GetBlockingActor(const uint16_t x, const uint16_t y) const
 
 Actor* Level::GetNonBlockingActor(const uint16_t index) const
 {
-    return m_nonBlockingActors[index];
+    const std::vector<Actor*>& actors = m_nonBlockingActorStore.GetActors();
+    return (index < actors.size()) ? actors[index] : NULL;
 }
 
+// A blocking actor that is added, like a dying monster, stops being a blocking actor.
+// There is no upper limit on the number of non-blocking actors.
 void Level::AddNonBlockingActor(Actor* projectile)
 {
-    uint16_t i = 0;
-    while (m_nonBlockingActors[i] != NULL && i < 100)
-    {
-        i++;
-    }
-    if (i < 100)
-    {
-        m_nonBlockingActors[i] = projectile;
-    }
+    RemoveFromBlockingActorList(projectile);
+    m_nonBlockingActorStore.Add(projectile);
 }
 
 bool Level::Walk(Actor* const actor)
@@ -1036,7 +1178,7 @@ bool Level::Walk(Actor* const actor)
     return false;
 }
 
-void Level::ChaseThink(Actor* const actor, const bool diagonal, const ChaseTarget target)
+void Level::ChaseThink(Actor* const actor, const bool diagonal, const ChaseTarget target, Random& random)
 {
     actorDirection dirtable[9] = {northwest,north,northeast,west,nodir,east,southwest,south,southeast};
     actorDirection opposite[9] = {south,west,north,east,southwest,northwest,northeast,southeast,nodir};
@@ -1096,6 +1238,43 @@ void Level::ChaseThink(Actor* const actor, const bool diagonal, const ChaseTarge
         d[2]=tdir;
     }
 
+    // Step to the free neighbouring tile that is closest to the target, according to the flow field.
+    // On equal distance, the preferred direction of the original chase logic is taken.
+    const FlowField& flowField = GetFlowField(target);
+    const uint16_t currentDistance = flowField.GetDistance(actor->GetTileX(), actor->GetTileY());
+    if (currentDistance != FlowField::Unreachable)
+    {
+        const int8_t stepX[9] = { 0, 1, 0, -1, 1, 1, -1, -1, 0 };
+        const int8_t stepY[9] = { -1, 0, 1, 0, -1, 1, 1, -1, 0 };
+        const actorDirection candidates[7] = { diagonal ? d[1] : d[2], diagonal ? d[2] : d[1], olddir, north, east, south, west };
+        actorDirection bestDirection = nodir;
+        uint16_t bestDistance = currentDistance;
+        for (const actorDirection candidate : candidates)
+        {
+            if (candidate > west)
+            {
+                // Not a straight direction
+                continue;
+            }
+
+            const int32_t x = actor->GetTileX() + stepX[candidate];
+            const int32_t y = actor->GetTileY() + stepY[candidate];
+            const uint16_t distance = flowField.GetDistance(x, y);
+            if (distance < bestDistance && !IsTileBlocked(x, y))
+            {
+                bestDirection = candidate;
+                bestDistance = distance;
+            }
+        }
+
+        if (bestDirection != nodir)
+        {
+            actor->SetDirection(bestDirection);
+            if (Walk(actor))
+                return;
+        }
+    }
+
     if (d[1]==turnaround)
         d[1]=nodir;
     if (d[2]==turnaround)
@@ -1142,7 +1321,7 @@ void Level::ChaseThink(Actor* const actor, const bool diagonal, const ChaseTarge
     if (Walk(actor))
         return;
 
-    if ((rand() % 2) == 0) 	//randomly determine direction of search
+    if (random.Next(2) == 0) 	//randomly determine direction of search
     {
         for (int8_t i = (int8_t)north;tdir<=(int8_t)west;i++)
         {
@@ -1174,6 +1353,157 @@ void Level::ChaseThink(Actor* const actor, const bool diagonal, const ChaseTarge
     Walk(actor);		//last chance, don't worry about returned value
 }
 
+bool Level::IsTileBlocked(const int32_t x, const int32_t y) const
+{
+    if (x < 0 || y < 0 || x >= m_levelWidth || y >= m_levelHeight)
+    {
+        return true;
+    }
+
+    return (GetBlockingActor((uint16_t)x, (uint16_t)y) != NULL) || IsSolidWall((uint16_t)x, (uint16_t)y);
+}
+
+// Returns the flow field towards the given target. The field is only computed again when the target moved
+// to another tile, or when a wall changed since the previous computation.
+const FlowField& Level::GetFlowField(const ChaseTarget target)
+{
+    FlowField& flowField = m_flowFields.at(target);
+    if (target == ChasePlayer)
+    {
+        const uint16_t playerX = (uint16_t)m_playerActor->GetX();
+        const uint16_t playerY = (uint16_t)m_playerActor->GetY();
+        if (!flowField.IsComputedFor(playerX, playerY, m_wallsRevision))
+        {
+            flowField.Compute(*this, playerX, playerY, m_wallsRevision);
+        }
+
+        return flowField;
+    }
+
+    if (flowField.IsComputedFor(flowField.GetTargetX(), flowField.GetTargetY(), m_wallsRevision))
+    {
+        return flowField;
+    }
+
+    // Corners are targeted at the same coordinates as the original chase logic. As these are on the outer
+    // walls, the open tile nearest to the corner is taken as target.
+    const bool isLeft = (target == ChaseTopLeftCorner || target == ChaseTopRightCorner);
+    const bool isTop = (target == ChaseTopLeftCorner || target == ChaseBottomLeftCorner);
+    const int32_t cornerX = isLeft ? 0 : m_levelHeight;
+    const int32_t cornerY = isTop ? 0 : m_levelWidth;
+    uint16_t nearestX = 0;
+    uint16_t nearestY = 0;
+    int32_t nearestDistance = INT32_MAX;
+    for (uint16_t y = 0; y < m_levelHeight; y++)
+    {
+        for (uint16_t x = 0; x < m_levelWidth; x++)
+        {
+            const int32_t distance = ((x - cornerX) * (x - cornerX)) + ((y - cornerY) * (y - cornerY));
+            if (distance < nearestDistance && !IsSolidWall(x, y))
+            {
+                nearestX = x;
+                nearestY = y;
+                nearestDistance = distance;
+            }
+        }
+    }
+
+    flowField.Compute(*this, nearestX, nearestY, m_wallsRevision);
+    return flowField;
+}
+
+// Based on Chase() in C4_STATE.C of the Catacomb Abyss source code.
+bool Level::Chase(Actor* const actor, const bool diagonal, const ChaseTarget target, Random& random)
+{
+    float move = GetDistanceInTick(actor->GetDecorateActor().speed);
+
+    while (move > 0.0f)
+    {
+        if (actor->GetDecorateActor().damage > 0)
+        {
+            if (actor->WouldCollideWithActor(m_playerActor->GetX(), m_playerActor->GetY(), 1.0f))
+            {
+                if (random.Next(3) == 0)
+                {
+                    actor->SetState(StateIdAttack, m_timeStampOfWorld);
+                }
+                return true;
+            }
+        }
+        else
+        {
+            if (actor->GetDecorateActor().id == actorIdMonsterNemesis || actor->GetDecorateActor().id == actorIdMonsterMage || actor->GetDecorateActor().id == actorIdMonsterEye)
+            {
+                if (random.Next(60) == 0 && AngleNearPlayer(actor) != -1)
+                {
+                    actor->SetState(StateIdAttack, m_timeStampOfWorld);
+                }
+            }
+
+            // Clip with player
+            if (actor->WouldCollideWithActor(m_playerActor->GetX(), m_playerActor->GetY(), 1.0f))
+            {
+                return true;
+            }
+        }
+
+        if (move < actor->GetDistanceToTarget())
+        {
+            MoveActor(actor, move);
+            break;
+        }
+        
+        SetBlockingActor(actor->GetTileX(), actor->GetTileY(), NULL);	// pick up marker from goal
+        if (actor->GetDirection() == nodir)
+            actor->SetDirection(north);
+
+        // Instantly set the actor on its target
+        move -= actor->GetDistanceToTarget();
+        actor->SetX((float)(actor->GetTileX()) + 0.5f);
+        actor->SetY((float)(actor->GetTileY()) + 0.5f);
+
+        ChaseThink (actor,diagonal, target, random);
+
+        SetBlockingActor(actor->GetTileX(), actor->GetTileY(), actor);	// set down a new goal marker
+        if (actor->TargetReached())
+            break;			// no possible move
+
+    }
+
+    return false;
+}
+
+void Level::RunAway(Actor* const actor, Random& random)
+{
+    float move = GetDistanceInTick(actor->GetDecorateActor().speed);
+
+    while (move > 0.0f)
+    {
+        if (move < actor->GetDistanceToTarget())
+        {
+            MoveActor(actor, move);
+            break;
+        }
+
+        SetBlockingActor(actor->GetTileX(), actor->GetTileY(), NULL);	// pick up marker from goal
+        if (actor->GetDirection() == nodir)
+            actor->SetDirection(north);
+
+        // Instantly set the actor on its target
+        move -= actor->GetDistanceToTarget();
+        actor->SetX((float)(actor->GetTileX()) + 0.5f);
+        actor->SetY((float)(actor->GetTileY()) + 0.5f);
+
+        RunAwayThink(actor, random);
+
+        SetBlockingActor(actor->GetTileX(), actor->GetTileY(), actor);	// set down a new goal marker
+        if (actor->TargetReached())
+        {
+            break;			// no possible move
+        }
+    }
+}
+
 void Level::MoveActor(Actor* const actor, const float distance)
 {
     switch (actor->GetDirection())
@@ -1212,7 +1542,7 @@ void Level::MoveActor(Actor* const actor, const float distance)
     }
 }
 
-void Level::RunAwayThink(Actor* const actor)
+void Level::RunAwayThink(Actor* const actor, Random& random)
 {
     actorDirection dirtable[9] = { northwest,north,northeast,west,nodir,east,southwest,south,southeast };
 
@@ -1259,7 +1589,7 @@ void Level::RunAwayThink(Actor* const actor)
     if (Walk(actor))
         return;
 
-    if ((rand() % 2) == 0) 	//randomly determine direction of search
+    if (random.Next(2) == 0) 	//randomly determine direction of search
     {
         for (int8_t i = (int8_t)north; tdir <= (int8_t)west; i++)
         {
@@ -1342,8 +1672,9 @@ void Level::ExplodeWall(const uint16_t x, const uint16_t y, const uint32_t times
 {
     if (m_blockingActors[(y * m_levelWidth) + x] == NULL)
     {
-        m_blockingActors[(y * m_levelWidth) + x] = new Actor(x, y, timestamp, decorateExplodingWall);
-        m_blockingActors[(y * m_levelWidth) + x]->SetActive(true);
+        Actor* explodingWall = new Actor(x, y, timestamp, decorateExplodingWall);
+        explodingWall->SetActive(true);
+        SetBlockingActor(x, y, explodingWall);
     }
 }
 
@@ -1354,12 +1685,18 @@ void Level::SpawnExplosion(const float x, const float y, const int16_t delay, co
     AddNonBlockingActor(actor);
 }
 
-void Level::SpawnBigExplosion(const float x, const float y, const uint16_t delay, const uint32_t range, const uint32_t timestamp)
+void Level::SpawnBigExplosion(const float x, const float y, const uint16_t delay, const uint32_t range, const uint32_t timestamp, Random& random)
 {
-    SpawnExplosion(x-((rand() % range) / 65536.0f),y+((rand() % range) / 65536.0f),rand() % delay, timestamp);
-    SpawnExplosion(x+((rand() % range) / 65536.0f),y-((rand() % range) / 65536.0f),rand() % delay, timestamp);
-    SpawnExplosion(x-((rand() % range) / 65536.0f),y-((rand() % range) / 65536.0f),rand() % delay, timestamp);
-    SpawnExplosion(x+((rand() % range) / 65536.0f),y+((rand() % range) / 65536.0f),rand() % delay, timestamp);
+    // The random numbers are drawn one statement at a time, as the order in which function arguments are evaluated
+    // is unspecified and would otherwise differ between compilers.
+    static const float directions[4][2] = { { -1.0f, 1.0f }, { 1.0f, -1.0f }, { -1.0f, -1.0f }, { 1.0f, 1.0f } };
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        const float offsetX = random.Next(range) / 65536.0f;
+        const float offsetY = random.Next(range) / 65536.0f;
+        const int16_t explosionDelay = (int16_t)random.Next(delay);
+        SpawnExplosion(x + directions[i][0] * offsetX, y + directions[i][1] * offsetY, explosionDelay, timestamp);
+    }
 }
 
 bool Level::IsWaterLevel() const
@@ -1367,45 +1704,24 @@ bool Level::IsWaterLevel() const
     return GetGroundColor() == EgaBlue;
 }
 
-void Level::DrawVisibilityMap(IRenderer& renderer)
+void Level::AddFloorAndCeilingToSnapshot(WorldSnapshot& snapshot, const uint32_t timeStamp)
 {
-    renderer.PrepareVisibilityMap();
-
+    snapshot.groundColor = GetGroundColor();
+    snapshot.skyColor = GetSkyColor(timeStamp);
     for (uint16_t y = 1; y < m_levelHeight - 1; y++)
     {
         for (uint16_t x = 1; x < m_levelWidth - 1; x++)
         {
-            const uint16_t wall = GetWallTile(x, y);
             if (IsTileVisibleForPlayer(x, y))
             {
-                renderer.RenderFloor(x, y, EgaBrightWhite);
+                snapshot.AddVisibleTile(x, y);
             }
         }
     }
-    renderer.UnprepareVisibilityMap();
 }
 
-void Level::DrawFloorAndCeiling(IRenderer& renderer, const uint32_t timeStamp)
+void Level::AddWallsToSnapshot(WorldSnapshot& snapshot, const uint32_t ticks) const
 {
-    renderer.PrepareFloorAndCeiling();
-    for (uint16_t y = 1; y < m_levelHeight - 1; y++)
-    {
-        for (uint16_t x = 1; x < m_levelWidth - 1; x++)
-        {
-            if (IsTileVisibleForPlayer(x, y))
-            {
-                renderer.RenderFloor(x, y, GetGroundColor());
-                renderer.RenderCeiling(x, y, GetSkyColor(timeStamp));
-            }
-        }
-    }
-    renderer.UnprepareFloorAndCeiling();
-}
-
-void Level::DrawWalls(IRenderer& renderer, EgaGraph* egaGraph, const uint32_t ticks)
-{
-    renderer.PrepareWalls();
-
     for (uint16_t y = 1; y < m_levelHeight - 1; y++)
     {
         for (uint16_t x = 1; x < m_levelWidth - 1; x++)
@@ -1416,8 +1732,7 @@ void Level::DrawWalls(IRenderer& renderer, EgaGraph* egaGraph, const uint32_t ti
                 const uint16_t northWall = GetDarkWallPictureIndex(northwallIndex, ticks);
                 if (northWall != 1)
                 {
-                    Picture* northPicture = egaGraph->GetPicture(northWall);
-                    renderer.Render3DWall(northPicture, x, y - 1, 180);
+                    snapshot.AddWall(northWall, x, y - 1, 180);
                 }
             }
 
@@ -1427,8 +1742,7 @@ void Level::DrawWalls(IRenderer& renderer, EgaGraph* egaGraph, const uint32_t ti
                 const uint16_t eastWall = GetLightWallPictureIndex(eastwallIndex, ticks);
                 if (eastWall != 1)
                 {
-                    Picture* eastPicture = egaGraph->GetPicture(eastWall);
-                    renderer.Render3DWall(eastPicture, x + 1, y, 270);
+                    snapshot.AddWall(eastWall, x + 1, y, 270);
                 }
             }
 
@@ -1439,8 +1753,7 @@ void Level::DrawWalls(IRenderer& renderer, EgaGraph* egaGraph, const uint32_t ti
                 const uint16_t southWall = GetDarkWallPictureIndex(southwallIndex, ticks);
                 if (southWall != 1)
                 {
-                    Picture* southPicture = egaGraph->GetPicture(southWall);
-                    renderer.Render3DWall(southPicture, x, y + 1, 0);
+                    snapshot.AddWall(southWall, x, y + 1, 0);
                 }
             }
 
@@ -1450,14 +1763,11 @@ void Level::DrawWalls(IRenderer& renderer, EgaGraph* egaGraph, const uint32_t ti
                 const uint16_t westWall = GetLightWallPictureIndex(westwallIndex, ticks);
                 if (westWall != 1)
                 {
-                    Picture* westPicture = egaGraph->GetPicture(westWall);
-                    renderer.Render3DWall(westPicture, x - 1, y, 90);
+                    snapshot.AddWall(westWall, x - 1, y, 90);
                 }
             }
         }
     }
-
-    renderer.UnprepareWalls();
 }
 
 uint16_t Level::GetDarkWallPictureIndex(const uint16_t tileIndex, const uint32_t ticks) const
@@ -1503,65 +1813,38 @@ uint16_t Level::GetLightWallPictureIndex(const uint16_t tileIndex, const uint32_
         return 1;
     }
 }
-void Level::DrawActors(IRenderer& renderer, EgaGraph* egaGraph)
+void Level::AddActorsToSnapshot(WorldSnapshot& snapshot, const float interpolation) const
 {
-    for (uint16_t y = 1; y < m_levelHeight - 1; y++)
+    for (const Actor* actor : m_blockingActorStore.GetActors())
     {
-        for (uint16_t x = 1; x < m_levelWidth - 1; x++)
+        // Actors
+        if (IsActorVisibleForPlayer(actor))
         {
-            // Actors
-            Actor* actor = GetBlockingActor(x, y);
-            if (actor != NULL)
-            {
-                Picture* actorPicture = egaGraph->GetPicture(actor->GetPictureIndex());
-                if (actorPicture != NULL)
-                {
-                    if (IsActorVisibleForPlayer(actor))
-                    {
-                        renderer.AddSprite(actorPicture, actor->GetX(), actor->GetY());
-                    }
-                }
-            }
+            snapshot.AddSprite(actor->GetPictureIndex(), actor->GetInterpolatedX(interpolation), actor->GetInterpolatedY(interpolation));
         }
     }
 
-    for (uint16_t i = 0; i < 100; i++)
+    for (const Actor* projectile : m_nonBlockingActorStore.GetActors())
     {
         // Projectiles
-        Actor* projectile = GetNonBlockingActor(i);
-        if (projectile != NULL)
+        if (IsActorVisibleForPlayer(projectile))
         {
-            Picture* actorPicture = egaGraph->GetPicture(projectile->GetPictureIndex());
-            if (actorPicture != NULL)
-            {
-                if (IsActorVisibleForPlayer(projectile))
-                {
-                    renderer.AddSprite(actorPicture, projectile->GetX(), projectile->GetY());
-                }
-            }
+            snapshot.AddSprite(projectile->GetPictureIndex(), projectile->GetInterpolatedX(interpolation), projectile->GetInterpolatedY(interpolation));
         }
     }
-
-    renderer.RenderAllSprites();
 }
 
 void Level::RemoveActor(Actor* actor)
 {
-    for (uint16_t i = 0; i < 100; i++)
+    if (RemoveFromBlockingActorList(actor))
     {
-        if (m_nonBlockingActors[i] == actor)
-        {
-            delete m_nonBlockingActors[i];
-            m_nonBlockingActors[i] = NULL;
-        }
+        delete actor;
+        return;
     }
 
-    for (uint16_t i = 0; i < m_levelWidth * m_levelHeight; i++)
+    if (m_nonBlockingActorStore.Remove(actor))
     {
-        if (m_blockingActors[i] == actor)
-        {
-            delete m_blockingActors[i];
-            m_blockingActors[i] = NULL;
-        }
+        m_wakeUpWheel.Cancel(actor);
+        delete actor;
     }
-}
\ No newline at end of file
+}
\ No newline at end of file
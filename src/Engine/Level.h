@@ -27,8 +27,13 @@
 #include "PlayerInventory.h"
 #include "Actor.h"
 #include "IRenderer.h"
+#include "FlowField.h"
+#include "ActorStore.h"
+#include "TimerWheel.h"
+#include "SpatialHash.h"
+#include "Random.h"
 
-class EgaGraph;
+class WorldSnapshot;
 
 struct LevelInfo
 {
@@ -81,6 +86,7 @@ class Level
 {
 public:
     Level(const uint8_t levelIndex, const uint16_t levelWidth, const uint16_t levelHeight, const uint16_t* plane0, const uint16_t* plane2, const LevelInfo& mapInfo, const std::vector<WallInfo>& wallsInfo);
+    Level(const Level& level);
     bool LoadActorsFromFile(std::ifstream& file, const std::map<uint16_t, const DecorateActor>& decorateActors);
     ~Level();
 
@@ -107,36 +113,51 @@ public:
     void UpdateVisibilityMap();
     bool IsTileVisibleForPlayer(const uint16_t x, const uint16_t y) const;
     Actor* const GetPlayerActor();
-    Actor** GetBlockingActors();
-    Actor** GetNonBlockingActors();
+    const std::vector<Actor*>& GetBlockingActors() const;
+    const std::vector<Actor*>& GetNonBlockingActors() const;
     void SetBlockingActor(const uint16_t x, const uint16_t y, Actor* actor);
+    void ReplaceBlockingActor(Actor* actor, Actor* replacement);
     Actor* GetBlockingActor(const uint16_t x, const uint16_t y) const;
     Actor* GetNonBlockingActor(const uint16_t index) const;
     void AddNonBlockingActor(Actor* projectile);
     void RemoveActor(Actor* actor);
+    // Called at the start of every tick with the time of the world, which stands still while time is frozen.
+    void StartTick(const uint32_t timeStampOfWorld);
+    float GetDistanceInTick(const uint16_t speed) const;
+    void StorePreviousActorPositions();
+    void AnimateBlockingActors(const uint32_t timestamp);
+    void AnimateNonBlockingActors(const uint32_t timestamp);
+    void PutActorToSleep(Actor* actor, const uint32_t wakeUpTime);
+    void WakeUpActors(const uint32_t timestamp);
+    void UpdateSpatialHash();
+    void GetBlockingActorsOnPath(const float startX, const float startY, const float endX, const float endY, const float size, std::vector<Actor*>& actors) const;
 
     bool Walk(Actor* const actor);
-    void ChaseThink (Actor* const actor, const bool diagonal, const ChaseTarget target);
-    void RunAwayThink(Actor* const actor);
+    bool Chase(Actor* const actor, const bool diagonal, const ChaseTarget target, Random& random);
+    void RunAway(Actor* const actor, Random& random);
+    void ChaseThink (Actor* const actor, const bool diagonal, const ChaseTarget target, Random& random);
+    void RunAwayThink(Actor* const actor, Random& random);
     void MoveActor(Actor* const actor, const float distance);
     int16_t AngleNearPlayer(const Actor* const actor) const;
     void ExplodeWall(const uint16_t x, const uint16_t y, const uint32_t timestamp);
     void SpawnExplosion(const float x, const float y, const int16_t delay, const uint32_t timestamp);
-    void SpawnBigExplosion(const float x, const float y, const uint16_t delay, const uint32_t range, const uint32_t timestamp);
+    void SpawnBigExplosion(const float x, const float y, const uint16_t delay, const uint32_t range, const uint32_t timestamp, Random& random);
 
-    void StoreToFile(std::ofstream& file) const;
+    void StoreToFile(std::ostream& file) const;
     bool IsWaterLevel() const;
 
-    void DrawVisibilityMap(IRenderer& renderer);
-    void DrawFloorAndCeiling(IRenderer& renderer, const uint32_t timeStamp);
-    void DrawWalls(IRenderer& renderer, EgaGraph* egaGraph, const uint32_t ticks);
-    void DrawActors(IRenderer& renderer, EgaGraph* egaGraph);
+    void AddFloorAndCeilingToSnapshot(WorldSnapshot& snapshot, const uint32_t timeStamp);
+    void AddWallsToSnapshot(WorldSnapshot& snapshot, const uint32_t ticks) const;
+    void AddActorsToSnapshot(WorldSnapshot& snapshot, const float interpolation) const;
 
 private:
     uint16_t GetDarkWallPictureIndex(const uint16_t tileIndex, const uint32_t ticks) const;
     uint16_t GetLightWallPictureIndex(const uint16_t tileIndex, const uint32_t ticks) const;
     void BackTraceWalls(const float distanceOnOuterWall, LevelWall& firstWall);
     bool IsActorVisibleForPlayer(const Actor* actor) const;
+    bool IsTileBlocked(const int32_t x, const int32_t y) const;
+    bool RemoveFromBlockingActorList(Actor* actor);
+    const FlowField& GetFlowField(const ChaseTarget target);
     void RayTraceWall(const LevelCoordinate& coordinateInView, LevelWall& wallHit);
     LevelCoordinate GetOuterWallCoordinate(const float distance) const;
     float GetDistanceOnOuterWall(const LevelCoordinate& coordinate) const;
@@ -152,11 +173,21 @@ private:
     const std::vector<WallInfo>& m_wallsInfo;
     uint32_t m_lightningStartTimestamp;
     const uint8_t m_levelIndex;
+    Random m_lightningRandom;
     bool* m_visibilityMap;
     Actor* m_playerActor;
     Actor** m_blockingActors;
-    Actor** m_nonBlockingActors;
+    ActorStore m_blockingActorStore;
+    ActorStore m_nonBlockingActorStore;
+    TimerWheel m_wakeUpWheel;
+    std::vector<Actor*> m_dueActors;
 
     bool* m_wallXVisible;
     bool* m_wallYVisible;
+
+    uint32_t m_wallsRevision;
+    std::vector<FlowField> m_flowFields;
+    SpatialHash m_spatialHash;
+    uint32_t m_timeStampOfWorld;
+    bool m_worldTimeAdvanced;
 };
@@ -0,0 +1,85 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "LevelCache.h"
+
+LevelCache::LevelCache(const uint8_t capacity) :
+    m_capacity(capacity),
+    m_levels()
+{
+
+}
+
+LevelCache::~LevelCache()
+{
+    Clear();
+}
+
+// Returns a new copy of the cached level, which is owned by the caller. Returns NULL if the level is not cached.
+Level* LevelCache::GetLevel(const uint8_t mapIndex, const DifficultyLevel difficultyLevel)
+{
+    for (auto it = m_levels.begin(); it != m_levels.end(); it++)
+    {
+        if (it->mapIndex == mapIndex && it->difficultyLevel == difficultyLevel)
+        {
+            // Move to the front, as most recently used
+            m_levels.splice(m_levels.begin(), m_levels, it);
+            return new Level(*m_levels.front().level);
+        }
+    }
+
+    return NULL;
+}
+
+// Stores a copy of the given level. The level must not have been played yet.
+void LevelCache::StoreLevel(const Level& pristineLevel, const DifficultyLevel difficultyLevel)
+{
+    if (m_capacity == 0)
+    {
+        return;
+    }
+
+    const uint8_t mapIndex = pristineLevel.GetLevelIndex();
+    for (auto it = m_levels.begin(); it != m_levels.end(); it++)
+    {
+        if (it->mapIndex == mapIndex && it->difficultyLevel == difficultyLevel)
+        {
+            delete it->level;
+            m_levels.erase(it);
+            break;
+        }
+    }
+
+    if (m_levels.size() == m_capacity)
+    {
+        delete m_levels.back().level;
+        m_levels.pop_back();
+    }
+
+    m_levels.push_front({ mapIndex, difficultyLevel, new Level(pristineLevel) });
+}
+
+void LevelCache::Clear()
+{
+    for (cachedLevel& entry : m_levels)
+    {
+        delete entry.level;
+    }
+    m_levels.clear();
+}
+
+uint8_t LevelCache::GetNumberOfLevels() const
+{
+    return (uint8_t)m_levels.size();
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// LevelCache
+//
+// Keeps pristine copies of recently entered levels, with their actors freshly spawned, such that warping back
+// to a level only requires copying it instead of decoding the map and spawning the actors again.
+// The least recently used level is dropped when the cache is full.
+//
+#pragma once
+
+#include "IGame.h"
+#include <list>
+
+class LevelCache
+{
+public:
+    LevelCache(const uint8_t capacity);
+    ~LevelCache();
+
+    Level* GetLevel(const uint8_t mapIndex, const DifficultyLevel difficultyLevel);
+    void StoreLevel(const Level& pristineLevel, const DifficultyLevel difficultyLevel);
+    void Clear();
+    uint8_t GetNumberOfLevels() const;
+
+private:
+    typedef struct
+    {
+        uint8_t mapIndex;
+        DifficultyLevel difficultyLevel;
+        Level* level;
+    } cachedLevel;
+
+    const uint8_t m_capacity;
+    std::list<cachedLevel> m_levels;
+};
+
@@ -0,0 +1,91 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "LevelPreloader.h"
+
+LevelPreloader::LevelPreloader(IGame& game) :
+    m_game(game),
+    m_thread(),
+    m_level(NULL),
+    m_mapIndex(0),
+    m_difficultyLevel(Easy),
+    m_ready(false)
+{
+
+}
+
+LevelPreloader::~LevelPreloader()
+{
+    Discard();
+}
+
+// Only reads the immutable game data, such that it can run alongside the simulation of the current level.
+// The actors are spawned with a copy of the given random number generator, such that the preloaded level is identical
+// to a level that is loaded from scratch with the same seed.
+void LevelPreloader::Start(const uint8_t mapIndex, const DifficultyLevel difficultyLevel, const Random& spawnRandom)
+{
+    Discard();
+
+    m_mapIndex = mapIndex;
+    m_difficultyLevel = difficultyLevel;
+    m_thread = std::thread([this, mapIndex, difficultyLevel, spawnRandom]()
+    {
+        Random random(spawnRandom);
+        Level* level = m_game.GetGameMaps()->GetLevelFromStart(mapIndex);
+        m_game.SpawnActors(level, difficultyLevel, random);
+        m_level = level;
+        m_ready = true;
+    });
+}
+
+// Returns the preloaded level, waiting for the worker thread if it is not finished yet. The caller becomes the
+// owner of the level. Returns NULL if no level was preloaded for the given map and difficulty level.
+Level* LevelPreloader::Take(const uint8_t mapIndex, const DifficultyLevel difficultyLevel)
+{
+    Join();
+    if (m_level == NULL || m_mapIndex != mapIndex || m_difficultyLevel != difficultyLevel)
+    {
+        Discard();
+        return NULL;
+    }
+
+    Level* level = m_level;
+    m_level = NULL;
+    m_ready = false;
+    return level;
+}
+
+void LevelPreloader::Discard()
+{
+    Join();
+    if (m_level != NULL)
+    {
+        delete m_level;
+        m_level = NULL;
+    }
+    m_ready = false;
+}
+
+bool LevelPreloader::IsReady() const
+{
+    return m_ready;
+}
+
+void LevelPreloader::Join()
+{
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// LevelPreloader
+//
+// Decodes a level and spawns its actors on a worker thread, while the player is still deciding whether to go
+// through an exit gate. Once the player confirms, the prepared level is taken over instead of loading it from
+// scratch; otherwise it is discarded.
+//
+#pragma once
+
+#include "IGame.h"
+#include <thread>
+#include <atomic>
+
+class LevelPreloader
+{
+public:
+    LevelPreloader(IGame& game);
+    ~LevelPreloader();
+
+    void Start(const uint8_t mapIndex, const DifficultyLevel difficultyLevel, const Random& spawnRandom);
+    Level* Take(const uint8_t mapIndex, const DifficultyLevel difficultyLevel);
+    void Discard();
+    bool IsReady() const;
+
+private:
+    void Join();
+
+    IGame& m_game;
+    std::thread m_thread;
+    Level* m_level;
+    uint8_t m_mapIndex;
+    DifficultyLevel m_difficultyLevel;
+    std::atomic<bool> m_ready;
+};
+
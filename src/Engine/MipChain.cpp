@@ -0,0 +1,93 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "MipChain.h"
+
+// The palette holds the RGB values of the 16 EGA colors. Transparent pixels become black with zero alpha.
+MipChain::MipChain(const IndexedPicture& picture, const IRenderer::rgbColor* palette) :
+    m_levels()
+{
+    mipLevel firstLevel;
+    firstLevel.width = picture.GetWidth();
+    firstLevel.height = picture.GetHeight();
+    firstLevel.texels.resize((uint32_t)firstLevel.width * firstLevel.height * BytesPerTexel, 0);
+    for (uint16_t y = 0; y < firstLevel.height; y++)
+    {
+        for (uint16_t x = 0; x < firstLevel.width; x++)
+        {
+            if (!picture.IsTransparent(x, y))
+            {
+                const IRenderer::rgbColor& color = palette[picture.GetColorIndex(x, y)];
+                uint8_t* texel = &firstLevel.texels[(((uint32_t)y * firstLevel.width) + x) * BytesPerTexel];
+                texel[0] = color.red;
+                texel[1] = color.green;
+                texel[2] = color.blue;
+                texel[3] = 255;
+            }
+        }
+    }
+    m_levels.push_back(firstLevel);
+
+    while (m_levels.back().width > 1 || m_levels.back().height > 1)
+    {
+        AddHalfSizeLevel();
+    }
+}
+
+MipChain::~MipChain()
+{
+
+}
+
+uint8_t MipChain::GetNumberOfLevels() const
+{
+    return (uint8_t)m_levels.size();
+}
+
+const MipChain::mipLevel& MipChain::GetLevel(const uint8_t level) const
+{
+    return m_levels.at(level);
+}
+
+// Box filter over blocks of 2x2 texels. A dimension of odd size drops its last row or column; a dimension of
+// size 1 stays 1, in which case the block is folded onto itself.
+void MipChain::AddHalfSizeLevel()
+{
+    const mipLevel& source = m_levels.back();
+    mipLevel halfSize;
+    halfSize.width = (source.width > 1) ? source.width / 2 : 1;
+    halfSize.height = (source.height > 1) ? source.height / 2 : 1;
+    halfSize.texels.resize((uint32_t)halfSize.width * halfSize.height * BytesPerTexel);
+    for (uint16_t y = 0; y < halfSize.height; y++)
+    {
+        const uint32_t top = (uint32_t)y * 2;
+        const uint32_t bottom = (top + 1 < source.height) ? top + 1 : top;
+        for (uint16_t x = 0; x < halfSize.width; x++)
+        {
+            const uint32_t left = (uint32_t)x * 2;
+            const uint32_t right = (left + 1 < source.width) ? left + 1 : left;
+            const uint8_t* topLeft = &source.texels[((top * source.width) + left) * BytesPerTexel];
+            const uint8_t* topRight = &source.texels[((top * source.width) + right) * BytesPerTexel];
+            const uint8_t* bottomLeft = &source.texels[((bottom * source.width) + left) * BytesPerTexel];
+            const uint8_t* bottomRight = &source.texels[((bottom * source.width) + right) * BytesPerTexel];
+            uint8_t* texel = &halfSize.texels[(((uint32_t)y * halfSize.width) + x) * BytesPerTexel];
+            for (uint8_t channel = 0; channel < BytesPerTexel; channel++)
+            {
+                texel[channel] = (uint8_t)((topLeft[channel] + topRight[channel] + bottomLeft[channel] + bottomRight[channel] + 2) / 4);
+            }
+        }
+    }
+
+    m_levels.push_back(halfSize);
+}
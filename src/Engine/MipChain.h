@@ -0,0 +1,52 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// MipChain
+//
+// Chain of successively halved RGBA images of a picture, created on the CPU when the picture is decoded, such
+// that distant walls and sprites can be sampled from a smaller image instead of aliasing over the full one.
+// The colors are premultiplied by alpha, which keeps transparent texels from darkening the edges of sprites
+// when they are averaged into the smaller levels.
+//
+#pragma once
+
+#include "IndexedPicture.h"
+#include "IRenderer.h"
+#include <vector>
+
+class MipChain
+{
+public:
+    typedef struct
+    {
+        uint16_t width;
+        uint16_t height;
+        std::vector<uint8_t> texels;
+    } mipLevel;
+
+    MipChain(const IndexedPicture& picture, const IRenderer::rgbColor* palette);
+    ~MipChain();
+
+    uint8_t GetNumberOfLevels() const;
+    const mipLevel& GetLevel(const uint8_t level) const;
+
+    static const uint8_t BytesPerTexel = 4;
+
+private:
+    void AddHalfSizeLevel();
+
+    std::vector<mipLevel> m_levels;
+};
+
@@ -12,7 +12,6 @@
 // 
 // You should have received a copy of the GNU General Public License 
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
-
 #include "Picture.h"
 
 Picture::Picture(const uint32_t textureId, const uint16_t width, const uint16_t height)
@@ -20,6 +19,19 @@ Picture::Picture(const uint32_t textureId, const uint16_t width, const uint16_t
     m_width = width;
     m_height = height;
     m_textureId = textureId;
+    m_textureRect = { 0, 0, width, height };
+    m_trimmedRect = m_textureRect;
+}
+
+// The texture rectangle is the part of the picture that is stored in the texture. The trimmed rectangle lies within
+// the texture rectangle and holds all opaque pixels. Both are in pixels, relative to the top left of the picture.
+Picture::Picture(const uint32_t textureId, const uint16_t width, const uint16_t height, const pictureRect& textureRect, const pictureRect& trimmedRect)
+{
+    m_width = width;
+    m_height = height;
+    m_textureId = textureId;
+    m_textureRect = textureRect;
+    m_trimmedRect = trimmedRect;
 }
 
 Picture::~Picture()
@@ -40,4 +52,49 @@ uint16_t Picture::GetWidth() const
 uint16_t Picture::GetHeight() const
 {
     return m_height;
-}
\ No newline at end of file
+}
+
+const pictureRect& Picture::GetTextureRect() const
+{
+    return m_textureRect;
+}
+
+const pictureRect& Picture::GetTrimmedRect() const
+{
+    return m_trimmedRect;
+}
+
+uint16_t Picture::GetTextureWidth() const
+{
+    return m_textureRect.right - m_textureRect.left;
+}
+
+uint16_t Picture::GetTextureHeight() const
+{
+    return m_textureRect.bottom - m_textureRect.top;
+}
+
+bool Picture::IsTrimmed() const
+{
+    return m_trimmedRect.left != 0 || m_trimmedRect.top != 0 || m_trimmedRect.right != m_width || m_trimmedRect.bottom != m_height;
+}
+
+float Picture::GetTextureCoordinateLeft() const
+{
+    return (float)(m_trimmedRect.left - m_textureRect.left) / (float)GetTextureWidth();
+}
+
+float Picture::GetTextureCoordinateTop() const
+{
+    return (float)(m_trimmedRect.top - m_textureRect.top) / (float)GetTextureHeight();
+}
+
+float Picture::GetTextureCoordinateRight() const
+{
+    return (float)(m_trimmedRect.right - m_textureRect.left) / (float)GetTextureWidth();
+}
+
+float Picture::GetTextureCoordinateBottom() const
+{
+    return (float)(m_trimmedRect.bottom - m_textureRect.top) / (float)GetTextureHeight();
+}
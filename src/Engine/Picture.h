@@ -12,29 +12,52 @@
 // 
 // You should have received a copy of the GNU General Public License 
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
-
 //
 // Picture
 //
 // Contains a single picture (wall texture, sprite texture, etc...)
+// Pictures with transparent borders can be trimmed: the texture then only covers part of the picture, and only
+// the trimmed rectangle needs to be drawn.
 //
 #pragma once
 
 #include "FileChunk.h"
 
+typedef struct
+{
+    uint16_t left;
+    uint16_t top;
+    uint16_t right;
+    uint16_t bottom;
+} pictureRect;
+
 class Picture
 {
 public:
     Picture(const uint32_t textureId, const uint16_t width, const uint16_t height);
+    Picture(const uint32_t textureId, const uint16_t width, const uint16_t height, const pictureRect& textureRect, const pictureRect& trimmedRect);
     ~Picture();
 
     uint32_t GetTextureId() const;
     uint16_t GetWidth() const;
     uint16_t GetHeight() const;
 
+    const pictureRect& GetTextureRect() const;
+    const pictureRect& GetTrimmedRect() const;
+    uint16_t GetTextureWidth() const;
+    uint16_t GetTextureHeight() const;
+    bool IsTrimmed() const;
+
+    float GetTextureCoordinateLeft() const;
+    float GetTextureCoordinateTop() const;
+    float GetTextureCoordinateRight() const;
+    float GetTextureCoordinateBottom() const;
+
 private:
     uint16_t m_width;
     uint16_t m_height;
     uint32_t m_textureId;
+    pictureRect m_textureRect;
+    pictureRect m_trimmedRect;
 };
 
@@ -0,0 +1,128 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "PictureTrimmer.h"
+#include <string.h>
+
+// Masked pictures consist of a transparency plane followed by the four color planes. Unmasked pictures only have
+// the four color planes, in which magenta is the transparent color.
+static const uint8_t NumberOfColorPlanes = 4;
+
+// Computes the smallest rectangle that holds all opaque pixels. Returns false if the picture has no opaque pixels,
+// or if the chunk is too small for the given dimensions.
+bool PictureTrimmer::GetOpaqueRect(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height, const bool masked, pictureRect& opaqueRect)
+{
+    const uint32_t numberOfPlanes = masked ? NumberOfColorPlanes + 1 : NumberOfColorPlanes;
+    const uint32_t bytesPerRow = width / 8;
+    const uint32_t planeSize = decompressedChunk->GetSize() / numberOfPlanes;
+    if (bytesPerRow == 0 || planeSize < bytesPerRow * height)
+    {
+        return false;
+    }
+
+    const uint8_t* chunk = decompressedChunk->GetChunk();
+    uint16_t left = width;
+    uint16_t top = height;
+    uint16_t right = 0;
+    uint16_t bottom = 0;
+    for (uint16_t row = 0; row < height; row++)
+    {
+        for (uint16_t byteColumn = 0; byteColumn < bytesPerRow; byteColumn++)
+        {
+            const uint8_t opaqueBits = GetOpaqueBits(chunk, planeSize, (row * bytesPerRow) + byteColumn, masked);
+            if (opaqueBits == 0)
+            {
+                continue;
+            }
+
+            // The most significant bit is the leftmost pixel
+            for (uint8_t pixel = 0; pixel < 8; pixel++)
+            {
+                if ((opaqueBits & (0x80 >> pixel)) != 0)
+                {
+                    const uint16_t x = (byteColumn * 8) + pixel;
+                    left = (x < left) ? x : left;
+                    right = (x + 1 > right) ? x + 1 : right;
+                }
+            }
+            top = (row < top) ? row : top;
+            bottom = row + 1;
+        }
+    }
+
+    if (right == 0)
+    {
+        return false;
+    }
+
+    opaqueRect = { left, top, right, bottom };
+    return true;
+}
+
+bool PictureTrimmer::ContainsRect(const pictureRect& outerRect, const pictureRect& innerRect)
+{
+    return outerRect.left <= innerRect.left && outerRect.top <= innerRect.top && outerRect.right >= innerRect.right && outerRect.bottom >= innerRect.bottom;
+}
+
+// Creates a new chunk with only the rows and byte columns that overlap with the trimmed rectangle. As the planes
+// store 8 pixels per byte, the left and right side of the cropped picture are aligned to 8 pixels; the resulting
+// area is returned in textureRect. Returns NULL if the chunk is too small for the given dimensions.
+FileChunk* PictureTrimmer::Crop(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height, const bool masked, const pictureRect& trimmedRect, pictureRect& textureRect)
+{
+    const uint32_t numberOfPlanes = masked ? NumberOfColorPlanes + 1 : NumberOfColorPlanes;
+    const uint32_t bytesPerRow = width / 8;
+    const uint32_t planeSize = decompressedChunk->GetSize() / numberOfPlanes;
+    if (bytesPerRow == 0 || planeSize < bytesPerRow * height || trimmedRect.right > width || trimmedRect.bottom > height ||
+        trimmedRect.left >= trimmedRect.right || trimmedRect.top >= trimmedRect.bottom)
+    {
+        return NULL;
+    }
+
+    const uint16_t firstByteColumn = trimmedRect.left / 8;
+    const uint16_t lastByteColumn = (trimmedRect.right + 7) / 8;
+    textureRect = { (uint16_t)(firstByteColumn * 8), trimmedRect.top, (uint16_t)(lastByteColumn * 8), trimmedRect.bottom };
+
+    const uint32_t croppedBytesPerRow = lastByteColumn - firstByteColumn;
+    const uint32_t croppedPlaneSize = croppedBytesPerRow * (trimmedRect.bottom - trimmedRect.top);
+    FileChunk* croppedChunk = new FileChunk(croppedPlaneSize * numberOfPlanes);
+    const uint8_t* source = decompressedChunk->GetChunk();
+    uint8_t* destination = croppedChunk->GetChunk();
+    for (uint32_t plane = 0; plane < numberOfPlanes; plane++)
+    {
+        for (uint16_t row = trimmedRect.top; row < trimmedRect.bottom; row++)
+        {
+            memcpy(
+                destination + (plane * croppedPlaneSize) + ((row - trimmedRect.top) * croppedBytesPerRow),
+                source + (plane * planeSize) + (row * bytesPerRow) + firstByteColumn,
+                croppedBytesPerRow);
+        }
+    }
+
+    return croppedChunk;
+}
+
+uint8_t PictureTrimmer::GetOpaqueBits(const uint8_t* chunk, const uint32_t planeSize, const uint32_t offset, const bool masked)
+{
+    if (masked)
+    {
+        return ~chunk[offset];
+    }
+
+    // Magenta has the blue and red bits set, and the green and intensity bits cleared
+    const uint8_t blue = chunk[offset];
+    const uint8_t green = chunk[offset + planeSize];
+    const uint8_t red = chunk[offset + (2 * planeSize)];
+    const uint8_t intensity = chunk[offset + (3 * planeSize)];
+    return ~(blue & ~green & red & ~intensity);
+}
@@ -0,0 +1,36 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// PictureTrimmer
+//
+// Determines the opaque bounding box of a decompressed EGA picture and crops the picture planes to it, such that
+// transparent borders are neither stored in a texture nor drawn.
+//
+#pragma once
+
+#include "FileChunk.h"
+#include "Picture.h"
+
+class PictureTrimmer
+{
+public:
+    static bool GetOpaqueRect(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height, const bool masked, pictureRect& opaqueRect);
+    static bool ContainsRect(const pictureRect& outerRect, const pictureRect& innerRect);
+    static FileChunk* Crop(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height, const bool masked, const pictureRect& trimmedRect, pictureRect& textureRect);
+
+private:
+    static uint8_t GetOpaqueBits(const uint8_t* chunk, const uint32_t planeSize, const uint32_t offset, const bool masked);
+};
+
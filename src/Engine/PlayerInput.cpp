@@ -78,6 +78,15 @@ void PlayerInput::SetKeyPressed(const uint8_t keyCode, const bool pressed)
     }
 }
 
+// Sets the state of a key directly, as opposed to SetKeyPressed, which derives whether the key was just pressed.
+// Used to restore the input exactly as it was recorded.
+void PlayerInput::SetKeyState(const uint8_t keyCode, const bool pressed, const bool justPressed)
+{
+    const SDL_Keycode sdlCode = asciiKeyToSDL[keyCode];
+    m_keyPressed[sdlCode] = pressed;
+    m_keyJustPressed[sdlCode] = justPressed;
+}
+
 bool PlayerInput::IsKeyJustPressed(const SDL_Keycode keyCode) const
 {
     const auto it = m_keyJustPressed.find(keyCode);
@@ -122,6 +131,12 @@ void PlayerInput::SetMouseButtonPressed(const uint8_t buttonCode, const bool pre
     m_buttonPressed[buttonCode] = pressed;
 }
 
+void PlayerInput::SetMouseButtonState(const uint8_t buttonCode, const bool pressed, const bool justPressed)
+{
+    m_buttonPressed[buttonCode] = pressed;
+    m_buttonJustPressed[buttonCode] = justPressed;
+}
+
 bool PlayerInput::IsMouseButtonPressed(const uint8_t buttonCode) const
 {
     return m_buttonPressed[buttonCode];
@@ -24,7 +24,7 @@
 
 #include <stdint.h>
 #include <map>
-#include "..\..\ThirdParty\SDL\include\SDL_keycode.h"
+#include "../../ThirdParty/SDL/include/SDL_keycode.h"
 
 const SDL_Keycode asciiKeyToSDL[256] =
 {
@@ -292,10 +292,12 @@ public:
     PlayerInput();
     ~PlayerInput();
     void SetKeyPressed(const uint8_t keyCode, const bool pressed);
+    void SetKeyState(const uint8_t keyCode, const bool pressed, const bool justPressed);
     bool IsKeyJustPressed(const SDL_Keycode keyCode) const;
     bool IsKeyPressed(const SDL_Keycode keyCode) const;
     void ClearJustPressed();
     void SetMouseButtonPressed(const uint8_t buttonCode, const bool pressed);
+    void SetMouseButtonState(const uint8_t buttonCode, const bool pressed, const bool justPressed);
     bool IsMouseButtonPressed(const uint8_t buttonCode) const;
     bool IsMouseButtonJustPressed(const uint8_t buttonCode) const;
     int32_t GetMouseXPos() const;
@@ -15,7 +15,7 @@
 
 #include "PlayerInventory.h"
 #include "AudioPlayer.h"
-#include "..\Abyss\AudioRepositoryAbyss.h"
+#include "../Abyss/AudioRepositoryAbyss.h"
 
 PlayerInventory::PlayerInventory(AudioPlayer* audioPlayer) :
     m_audioPlayer(audioPlayer),
@@ -112,11 +112,11 @@ void PlayerInventory::GiveBolt()
     m_bolts++;
 }
 
-void PlayerInventory::GiveChest()
+void PlayerInventory::GiveChest(Random& random)
 {
-    m_boltsInChest = rand() % 5;
-    m_nukesInChest = rand() % 4;
-    m_potionsInChest = rand() % 3;
+    m_boltsInChest = random.Next(5);
+    m_nukesInChest = random.Next(4);
+    m_potionsInChest = random.Next(3);
 }
 
 bool PlayerInventory::HasItemsInChest() const
@@ -246,7 +246,35 @@ void PlayerInventory::ResetForNewGame()
     }
 }
 
-void PlayerInventory::StoreToFile(std::ofstream& file) const
+// FNV-1a hash over the items that are displayed in the status bar.
+uint32_t PlayerInventory::GetHash() const
+{
+    uint8_t items[3 + maxKeys + maxScrolls + maxGems];
+    items[0] = m_bolts;
+    items[1] = m_nukes;
+    items[2] = m_potions;
+    for (uint8_t i = 0; i < maxKeys; i++)
+    {
+        items[3 + i] = m_keys[i];
+    }
+    for (uint8_t i = 0; i < maxScrolls; i++)
+    {
+        items[3 + maxKeys + i] = m_scrolls[i] ? 1 : 0;
+    }
+    for (uint8_t i = 0; i < maxGems; i++)
+    {
+        items[3 + maxKeys + maxScrolls + i] = m_gems[i] ? 1 : 0;
+    }
+
+    uint32_t hash = 2166136261u;
+    for (uint8_t i = 0; i < sizeof(items); i++)
+    {
+        hash = (hash ^ items[i]) * 16777619u;
+    }
+    return hash;
+}
+
+void PlayerInventory::StoreToFile(std::ostream& file) const
 {
     file.write((const char*)&m_bolts, sizeof(m_bolts));
     file.write((const char*)&m_nukes, sizeof(m_nukes));
@@ -256,7 +284,7 @@ void PlayerInventory::StoreToFile(std::ofstream& file) const
     file.write((const char*)&m_gems, sizeof(m_gems));
 }
 
-bool PlayerInventory::LoadFromFile(std::ifstream& file)
+bool PlayerInventory::LoadFromFile(std::istream& file)
 {
     file.read((char*)&m_bolts, sizeof(m_bolts));
     file.read((char*)&m_nukes, sizeof(m_nukes));
@@ -266,4 +294,4 @@ bool PlayerInventory::LoadFromFile(std::ifstream& file)
     file.read((char*)&m_gems, sizeof(m_gems));
 
     return true;
-}
\ No newline at end of file
+}
\ No newline at end of file
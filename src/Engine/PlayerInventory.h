@@ -22,6 +22,7 @@
 
 #include <stdint.h>
 #include <fstream>
+#include "Random.h"
 
 enum KeyId
 {
@@ -50,7 +51,7 @@ public:
     void GivePotion();
     bool UsePotion();
     void GiveBolt();
-    void GiveChest();
+    void GiveChest(Random& random);
     void GiveNuke();
     void GiveScroll(const uint8_t scrollId);
     void GiveKey(const uint8_t keyId);
@@ -63,8 +64,10 @@ public:
     bool TakeNuke();
     void ResetForNewGame();
 
-    void StoreToFile(std::ofstream& file) const;
-    bool LoadFromFile(std::ifstream& file);
+    uint32_t GetHash() const;
+
+    void StoreToFile(std::ostream& file) const;
+    bool LoadFromFile(std::istream& file);
 
 private:
     static const uint8_t maxKeys = 4;
@@ -0,0 +1,106 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "Random.h"
+
+static const uint64_t Multiplier = 6364136223846793005ULL;
+
+Random::Random() :
+    m_state(0),
+    m_increment(0)
+{
+    Seed(0, 0);
+}
+
+Random::Random(const uint64_t seed, const uint64_t stream) :
+    m_state(0),
+    m_increment(0)
+{
+    Seed(seed, stream);
+}
+
+Random::~Random()
+{
+
+}
+
+void Random::Seed(const uint64_t seed, const uint64_t stream)
+{
+    // The increment must be odd; each increment selects a different sequence.
+    m_state = 0;
+    m_increment = (stream << 1u) | 1u;
+    Next();
+    m_state += seed;
+    Next();
+}
+
+uint32_t Random::Next()
+{
+    const uint64_t oldState = m_state;
+    m_state = oldState * Multiplier + m_increment;
+    const uint32_t xorShifted = (uint32_t)(((oldState >> 18u) ^ oldState) >> 27u);
+    const uint32_t rotation = (uint32_t)(oldState >> 59u);
+    return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31u));
+}
+
+uint32_t Random::Next(const uint32_t bound)
+{
+    if (bound == 0)
+    {
+        return 0;
+    }
+
+    // Reject the values below 2^32 % bound, such that all remainders are equally likely.
+    const uint32_t threshold = (0u - bound) % bound;
+    while (true)
+    {
+        const uint32_t value = Next();
+        if (value >= threshold)
+        {
+            return value % bound;
+        }
+    }
+}
+
+void Random::StoreToFile(std::ostream& file) const
+{
+    file.write((const char*)&m_state, sizeof(m_state));
+    file.write((const char*)&m_increment, sizeof(m_increment));
+}
+
+bool Random::LoadFromFile(std::istream& file)
+{
+    uint64_t state = 0;
+    uint64_t increment = 0;
+    file.read((char*)&state, sizeof(state));
+    file.read((char*)&increment, sizeof(increment));
+    if (!file.good() || (increment & 1u) == 0)
+    {
+        return false;
+    }
+
+    m_state = state;
+    m_increment = increment;
+
+    return true;
+}
+
+uint64_t Random::MixSeed(const uint64_t seed, const uint64_t value)
+{
+    // SplitMix64 finalizer; derives well distributed seeds for each level from a single game seed.
+    uint64_t z = seed + (value + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27u)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31u);
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// Random
+//
+// Seeded pseudo random number generator (PCG32, XSH-RR variant) for everything that influences the simulation.
+// Unlike rand(), its state is small, can be stored in a saved game and does not depend on the C runtime, such that
+// the same seed produces the same game on every platform. Independent streams are created by seeding the same
+// value with a different stream identifier.
+//
+#pragma once
+
+#include <stdint.h>
+#include <fstream>
+
+enum RandomStream
+{
+    RandomStreamSpawn = 0,
+    RandomStreamAi,
+    RandomStreamEffects,
+    RandomStreamItems,
+    RandomStreamLightning
+};
+
+class Random
+{
+public:
+    Random();
+    Random(const uint64_t seed, const uint64_t stream);
+    ~Random();
+
+    void Seed(const uint64_t seed, const uint64_t stream);
+    uint32_t Next();
+    uint32_t Next(const uint32_t bound);
+
+    void StoreToFile(std::ostream& file) const;
+    bool LoadFromFile(std::istream& file);
+
+    static uint64_t MixSeed(const uint64_t seed, const uint64_t value);
+
+private:
+    uint64_t m_state;
+    uint64_t m_increment;
+};
@@ -0,0 +1,879 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+#include "RendererSoftware.h"
+#include "Picture.h"
+#include "Font.h"
+#include "SpriteQueue.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+const float CeilingZ = 1.0f;
+const float PlayerZ = 1.5f;
+const float SpriteOffsetZ = 0.0625f;
+const float NearClippingDistance = 0.1f;
+const float NoWallHitDistance = 1.0e30f;
+
+// Texture pixels hold an EGA color index; this value marks a transparent pixel.
+const uint8_t TransparentPixel = IndexedPicture::TransparentPixel;
+const uint8_t NoColorOverride = 0xFF;
+
+RendererSoftware::RendererSoftware() :
+    m_textures(),
+    m_wallTiles(),
+    m_wallTilesWidth(0),
+    m_wallTilesHeight(0),
+    m_frameNumber(0),
+    m_layers(),
+    m_textLayoutCache(),
+    m_workers(),
+    m_workersMutex(),
+    m_framePrepared(),
+    m_columnsRendered(),
+    m_workerFrameNumber(0),
+    m_busyWorkers(0),
+    m_stopWorkers(false)
+{
+    m_frameBuffer = new uint8_t[ScreenWidth * ScreenHeight];
+    memset(m_frameBuffer, EgaBlack, ScreenWidth * ScreenHeight);
+
+    // The 3D view is stored column by column, such that each column that is cast is a contiguous block of memory.
+    m_viewBuffer = new uint8_t[ScreenWidth * ViewHeight];
+    memset(m_viewBuffer, EgaBlack, ScreenWidth * ViewHeight);
+
+    m_depthBuffer = new float[ScreenWidth];
+    for (uint16_t i = 0; i < ScreenWidth; i++)
+    {
+        m_depthBuffer[i] = NoWallHitDistance;
+    }
+    m_viewRendered = false;
+
+    m_floorColor = EgaDarkGray;
+    m_ceilingColor = EgaDarkGray;
+    m_playerAngle = 0.0f;
+    m_playerPosX = 2.5f;
+    m_playerPosY = 2.5f;
+    m_forwardX = 0.0f;
+    m_forwardY = -1.0f;
+    m_rightX = 1.0f;
+    m_rightY = 0.0f;
+    m_focalLengthX = 160.0f;
+    m_focalLengthY = 60.0f;
+}
+
+RendererSoftware::~RendererSoftware()
+{
+    StopWorkers();
+    delete[] m_frameBuffer;
+    delete[] m_viewBuffer;
+    delete[] m_depthBuffer;
+}
+
+void RendererSoftware::Setup()
+{
+
+}
+
+void RendererSoftware::SetWindowDimensions(const uint16_t /*windowWidth*/, const uint16_t /*windowHeight*/)
+{
+    // The frame buffer always has the classic 320x200 resolution; scaling it to the window is up to the platform.
+}
+
+void RendererSoftware::SetPlayerAngle(const float angle)
+{
+    m_playerAngle = angle;
+}
+
+void RendererSoftware::SetPlayerPosition(const float posX, const float posY)
+{
+    m_playerPosX = posX;
+    m_playerPosY = posY;
+}
+
+void RendererSoftware::SetTextureFilter(const TextureFilterSetting /*textureFilter*/)
+{
+    // Textures are always sampled with the nearest texel, as in the original game.
+}
+
+void RendererSoftware::SetVSync(const bool /*enabled*/)
+{
+
+}
+
+bool RendererSoftware::IsVSyncSupported()
+{
+    return false;
+}
+
+uint32_t RendererSoftware::AddTexture(const uint16_t width, const uint16_t height)
+{
+    const texture newTexture(width, height);
+    if (!m_freeTextureIds.empty())
+    {
+        const uint32_t textureId = m_freeTextureIds.back();
+        m_freeTextureIds.pop_back();
+        m_textures[textureId - 1] = newTexture;
+        return textureId;
+    }
+    m_textures.push_back(newTexture);
+    m_mipLevels.push_back(std::vector<texture>());
+
+    // Texture id 0 is reserved, such that it is never mistaken for a valid texture.
+    return (uint32_t)m_textures.size();
+}
+
+const RendererSoftware::texture* RendererSoftware::GetTexture(const uint32_t textureId) const
+{
+    if (textureId == 0 || textureId > m_textures.size() || m_textures[textureId - 1].IsEmpty())
+    {
+        return NULL;
+    }
+
+    return &m_textures[textureId - 1];
+}
+
+// Returns the smallest mip level at which a texel does not cover more than about one pixel, given the number of
+// texels of the full size texture per pixel. The texture must be valid.
+const RendererSoftware::texture* RendererSoftware::GetMipLevel(const uint32_t textureId, const float texelsPerPixel, uint8_t& level) const
+{
+    const std::vector<texture>& mipLevels = m_mipLevels[textureId - 1];
+    float remainingTexelsPerPixel = texelsPerPixel;
+    level = 0;
+    while (remainingTexelsPerPixel >= 2.0f && level < mipLevels.size())
+    {
+        remainingTexelsPerPixel /= 2.0f;
+        level++;
+    }
+
+    return (level == 0) ? &m_textures[textureId - 1] : &mipLevels[level - 1];
+}
+
+void RendererSoftware::GenerateMipLevels(const uint32_t textureId)
+{
+    std::vector<texture>& mipLevels = m_mipLevels[textureId - 1];
+    mipLevels.clear();
+    const texture* previousLevel = &m_textures[textureId - 1];
+    while (previousLevel->GetWidth() > 1 || previousLevel->GetHeight() > 1)
+    {
+        mipLevels.push_back(previousLevel->CreateHalfSize());
+        previousLevel = &mipLevels.back();
+    }
+}
+
+uint32_t RendererSoftware::LoadFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height, const bool transparent)
+{
+    const uint32_t textureId = AddTexture(width, height);
+    m_textures[textureId - 1].DecodePlanes(decompressedChunk->GetChunk(), decompressedChunk->GetSize() / 4, false, transparent, 0);
+    GenerateMipLevels(textureId);
+
+    return textureId;
+}
+
+uint32_t RendererSoftware::LoadMaskedFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height)
+{
+    const uint32_t textureId = AddTexture(width, height);
+    m_textures[textureId - 1].DecodePlanes(decompressedChunk->GetChunk(), decompressedChunk->GetSize() / 5, true, false, 0);
+    GenerateMipLevels(textureId);
+
+    return textureId;
+}
+
+uint32_t RendererSoftware::LoadTilesSize8MaskedIntoTexture(const FileChunk* decompressedChunk)
+{
+    const uint32_t numberOfTiles = decompressedChunk->GetSize() / 40;
+    const uint32_t textureId = AddTexture(8, (uint16_t)(numberOfTiles * 8));
+    const uint8_t* chunk = decompressedChunk->GetChunk();
+
+    // Each tile consists of five planes of 8 bytes, with the transparency plane first
+    for (uint32_t tile = 0; tile < numberOfTiles; tile++)
+    {
+        m_textures[textureId - 1].DecodePlanes(chunk + (tile * 40), 8, true, false, (uint16_t)(tile * 8));
+    }
+
+    return textureId;
+}
+
+uint32_t RendererSoftware::LoadFontIntoTexture(const bool* fontPicture)
+{
+    // The font picture contains 16x16 characters of 16x10 pixels each. Set pixels are stored as 1; the
+    // actual color is applied when the text is rendered.
+    const uint32_t textureId = AddTexture(256, 16 * 10);
+    texture& fontTexture = m_textures[textureId - 1];
+    for (uint32_t i = 0; i < 256 * 16 * 10; i++)
+    {
+        fontTexture.SetPixel(i % 256, i / 256, fontPicture[i] ? 1 : TransparentPixel);
+    }
+
+    return textureId;
+}
+
+// The id of an unloaded texture is reused for the next texture that is loaded.
+void RendererSoftware::UnloadTexture(const uint32_t textureId)
+{
+    if (GetTexture(textureId) == NULL)
+    {
+        return;
+    }
+
+    m_textures[textureId - 1].Clear();
+    std::vector<texture>().swap(m_mipLevels[textureId - 1]);
+    m_freeTextureIds.push_back(textureId);
+}
+
+void RendererSoftware::RenderTextCentered(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY)
+{
+    if (text == NULL || font == NULL)
+    {
+        // Nothing to render
+        return;
+    }
+
+    const TextLayoutCache::textRun& textRun = m_textLayoutCache.GetTextRun(text, font, colorIndex);
+    const uint16_t halfTotalWidth = textRun.width / 2;
+    const uint16_t leftAlignedOffsetX = offsetX - halfTotalWidth;
+    RenderTextRun(textRun, leftAlignedOffsetX, offsetY);
+}
+
+void RendererSoftware::RenderTextLeftAligned(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY)
+{
+    if (text == NULL || font == NULL)
+    {
+        // Nothing to render
+        return;
+    }
+
+    RenderTextRun(m_textLayoutCache.GetTextRun(text, font, colorIndex), offsetX, offsetY);
+}
+
+void RendererSoftware::RenderTextRun(const TextLayoutCache::textRun& textRun, const uint16_t offsetX, const uint16_t offsetY)
+{
+    const texture* fontTexture = GetTexture(textRun.font->GetTextureId());
+    if (fontTexture == NULL)
+    {
+        return;
+    }
+
+    for (const TextLayoutCache::glyphQuad& glyph : textRun.glyphs)
+    {
+        BlitTexture(fontTexture, glyph.sourceX, glyph.sourceY, glyph.width, TextLayoutCache::GlyphHeight, offsetX + glyph.offsetX, offsetY, (uint8_t)textRun.colorIndex);
+    }
+}
+
+void RendererSoftware::RenderNumber(const uint16_t value, const Font* font, const uint8_t maxDigits, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY)
+{
+    char str[10];
+    snprintf(str, 10, "%d", value);
+
+    const uint16_t widthOfBlank = font->GetCharacterWidth('0');
+    const uint16_t widthOfBlanks = widthOfBlank * (maxDigits - (uint16_t)strlen(str));
+
+    RenderTextLeftAligned(str, font, colorIndex, offsetX + widthOfBlanks, offsetY);
+}
+
+void RendererSoftware::Prepare2DRendering()
+{
+    if (m_viewRendered)
+    {
+        CopyViewToFrameBuffer();
+        m_viewRendered = false;
+    }
+}
+
+void RendererSoftware::Unprepare2DRendering()
+{
+
+}
+
+void RendererSoftware::Render2DPicture(const Picture* picture, const uint16_t offsetX, const uint16_t offsetY)
+{
+    if (picture == NULL)
+    {
+        // Nothing to render
+        return;
+    }
+
+    const texture* source = GetTexture(picture->GetTextureId());
+    if (source != NULL)
+    {
+        // Only the trimmed part of the picture is drawn, at its position within the full picture.
+        const pictureRect& trimmedRect = picture->GetTrimmedRect();
+        const pictureRect& textureRect = picture->GetTextureRect();
+        BlitTexture(
+            source,
+            trimmedRect.left - textureRect.left,
+            trimmedRect.top - textureRect.top,
+            trimmedRect.right - trimmedRect.left,
+            trimmedRect.bottom - trimmedRect.top,
+            offsetX + trimmedRect.left,
+            offsetY + trimmedRect.top,
+            NoColorOverride);
+    }
+}
+
+void RendererSoftware::Render2DTileSize8Masked(const Picture* tiles, const uint16_t tileIndex, const uint16_t offsetX, const uint16_t offsetY)
+{
+    if (tiles == NULL ||
+        tileIndex >= (tiles->GetHeight() / 8))
+    {
+        // Nothing to render
+        return;
+    }
+
+    const texture* source = GetTexture(tiles->GetTextureId());
+    if (source != NULL)
+    {
+        BlitTexture(source, 0, tileIndex * 8, 8, 8, offsetX, offsetY, NoColorOverride);
+    }
+}
+
+void RendererSoftware::Render2DBar(const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height, const egaColor colorIndex)
+{
+    if (x >= ScreenWidth || y >= ScreenHeight)
+    {
+        return;
+    }
+
+    const uint16_t clippedWidth = std::min<uint16_t>(width, ScreenWidth - x);
+    const uint16_t clippedHeight = std::min<uint16_t>(height, ScreenHeight - y);
+    for (uint16_t row = y; row < y + clippedHeight; row++)
+    {
+        memset(m_frameBuffer + (row * ScreenWidth) + x, colorIndex, clippedWidth);
+    }
+}
+
+void RendererSoftware::RenderRadarBlip(const float x, const float y, const egaColor colorIndex)
+{
+    if (x < 0.0f || y < 0.0f || x >= ScreenWidth || y >= ScreenHeight)
+    {
+        return;
+    }
+
+    m_frameBuffer[((uint16_t)y * ScreenWidth) + (uint16_t)x] = colorIndex;
+}
+
+void RendererSoftware::CaptureLayer(const uint8_t layerId, const uint16_t offsetX, const uint16_t offsetY, const uint16_t width, const uint16_t height)
+{
+    if (offsetX >= ScreenWidth || offsetY >= ScreenHeight)
+    {
+        return;
+    }
+
+    layer& capturedLayer = m_layers[layerId];
+    capturedLayer.offsetX = offsetX;
+    capturedLayer.offsetY = offsetY;
+    capturedLayer.width = std::min<uint16_t>(width, ScreenWidth - offsetX);
+    capturedLayer.height = std::min<uint16_t>(height, ScreenHeight - offsetY);
+    capturedLayer.pixels.resize(capturedLayer.width * capturedLayer.height);
+    for (uint16_t row = 0; row < capturedLayer.height; row++)
+    {
+        memcpy(&capturedLayer.pixels[row * capturedLayer.width], m_frameBuffer + ((offsetY + row) * ScreenWidth) + offsetX, capturedLayer.width);
+    }
+}
+
+bool RendererSoftware::RenderLayer(const uint8_t layerId)
+{
+    std::map<uint8_t, layer>::const_iterator it = m_layers.find(layerId);
+    if (it == m_layers.end())
+    {
+        return false;
+    }
+
+    const layer& capturedLayer = it->second;
+    for (uint16_t row = 0; row < capturedLayer.height; row++)
+    {
+        memcpy(m_frameBuffer + ((capturedLayer.offsetY + row) * ScreenWidth) + capturedLayer.offsetX, &capturedLayer.pixels[row * capturedLayer.width], capturedLayer.width);
+    }
+
+    return true;
+}
+
+void RendererSoftware::BlitTexture(const texture* source, const uint16_t sourceX, const uint16_t sourceY, const uint16_t width, const uint16_t height, const int32_t offsetX, const int32_t offsetY, const uint8_t colorOverride)
+{
+    for (int32_t row = 0; row < height; row++)
+    {
+        const int32_t screenY = offsetY + row;
+        if (screenY < 0 || screenY >= ScreenHeight || sourceY + row >= source->GetHeight())
+        {
+            continue;
+        }
+
+        uint8_t* destinationRow = m_frameBuffer + (screenY * ScreenWidth);
+        for (int32_t column = 0; column < width; column++)
+        {
+            const int32_t screenX = offsetX + column;
+            if (screenX < 0 || screenX >= ScreenWidth || sourceX + column >= source->GetWidth())
+            {
+                continue;
+            }
+
+            const uint8_t pixel = source->GetPixel((uint16_t)(sourceX + column), (uint16_t)(sourceY + row));
+            if (pixel != TransparentPixel)
+            {
+                destinationRow[screenX] = (colorOverride == NoColorOverride) ? pixel : colorOverride;
+            }
+        }
+    }
+}
+
+void RendererSoftware::Prepare3DRendering(const bool /*depthShading*/, const float aspectRatio, uint16_t fov)
+{
+    const float angleInRadians = m_playerAngle * 3.14159265f / 180.0f;
+    m_forwardX = sin(angleInRadians);
+    m_forwardY = -cos(angleInRadians);
+    m_rightX = cos(angleInRadians);
+    m_rightY = sin(angleInRadians);
+
+    // The field of view is vertical, as in the OpenGL renderer. The horizontal focal length follows from the aspect
+    // ratio of the 3D view, which covers the upper 120 of the 200 lines on a screen with the configured aspect ratio.
+    const float normalized3DViewHeight = (float)ViewHeight / (float)ScreenHeight;
+    const float viewAspectRatio = aspectRatio / normalized3DViewHeight;
+    m_focalLengthY = ((float)ViewHeight / 2.0f) / (float)tan((float)fov * 3.14159265f / 360.0f);
+    m_focalLengthX = m_focalLengthY * ((float)ScreenWidth / (float)ViewHeight) / viewAspectRatio;
+
+    // Start a new frame; wall tiles that were stamped with an older frame number are considered empty.
+    m_frameNumber++;
+    m_viewRendered = false;
+}
+
+void RendererSoftware::PrepareWalls()
+{
+
+}
+
+void RendererSoftware::UnprepareWalls()
+{
+    if (m_workers.empty())
+    {
+        RenderColumns(0, ScreenWidth);
+    }
+    else
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_workersMutex);
+            m_workerFrameNumber++;
+            m_busyWorkers = (uint8_t)m_workers.size();
+        }
+        m_framePrepared.notify_all();
+
+        RenderColumnsOfThread(0);
+
+        std::unique_lock<std::mutex> lock(m_workersMutex);
+        m_columnsRendered.wait(lock, [this]() { return m_busyWorkers == 0; });
+    }
+    m_viewRendered = true;
+}
+
+void RendererSoftware::SetNumberOfThreads(const uint8_t numberOfThreads)
+{
+    StopWorkers();
+    for (uint8_t threadIndex = 1; threadIndex < numberOfThreads; threadIndex++)
+    {
+        m_workers.push_back(std::thread(&RendererSoftware::RunWorker, this, threadIndex, m_workerFrameNumber));
+    }
+}
+
+uint8_t RendererSoftware::GetNumberOfThreads() const
+{
+    return (uint8_t)(m_workers.size() + 1);
+}
+
+// Each thread casts an equal share of the columns; thread 0 is the one that renders the frame.
+void RendererSoftware::RenderColumnsOfThread(const uint8_t threadIndex)
+{
+    const uint32_t numberOfThreads = (uint32_t)m_workers.size() + 1;
+    const uint16_t firstColumn = (uint16_t)((threadIndex * ScreenWidth) / numberOfThreads);
+    const uint16_t lastColumn = (uint16_t)(((threadIndex + 1) * ScreenWidth) / numberOfThreads);
+    RenderColumns(firstColumn, lastColumn);
+}
+
+// The walls, textures and view parameters are only read by the workers, and only while the rendering thread waits
+// for them in UnprepareWalls().
+void RendererSoftware::RunWorker(const uint8_t threadIndex, const uint32_t frameNumberAtStart)
+{
+    uint32_t frameNumber = frameNumberAtStart;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_workersMutex);
+            m_framePrepared.wait(lock, [this, frameNumber]() { return m_stopWorkers || m_workerFrameNumber != frameNumber; });
+            if (m_stopWorkers)
+            {
+                return;
+            }
+            frameNumber = m_workerFrameNumber;
+        }
+
+        RenderColumnsOfThread(threadIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(m_workersMutex);
+            m_busyWorkers--;
+        }
+        m_columnsRendered.notify_one();
+    }
+}
+
+void RendererSoftware::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_workersMutex);
+        m_stopWorkers = true;
+    }
+    m_framePrepared.notify_all();
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+    m_workers.clear();
+    m_stopWorkers = false;
+}
+
+void RendererSoftware::Render3DWall(const Picture* picture, const int16_t tileX, const int16_t tileY, const int16_t orientation)
+{
+    if (picture == NULL || tileX < 0 || tileY < 0)
+    {
+        // Nothing to render
+        return;
+    }
+
+    if (tileX >= m_wallTilesWidth || tileY >= m_wallTilesHeight)
+    {
+        // Grow the tile grid such that it covers the level
+        const uint16_t newWidth = std::max<uint16_t>(m_wallTilesWidth, tileX + 1);
+        const uint16_t newHeight = std::max<uint16_t>(m_wallTilesHeight, tileY + 1);
+        std::vector<wallTile> newWallTiles(newWidth * newHeight);
+        for (uint16_t y = 0; y < newHeight; y++)
+        {
+            for (uint16_t x = 0; x < newWidth; x++)
+            {
+                wallTile& tile = newWallTiles[(y * newWidth) + x];
+                if (x < m_wallTilesWidth && y < m_wallTilesHeight)
+                {
+                    tile = m_wallTiles[(y * m_wallTilesWidth) + x];
+                }
+                else
+                {
+                    memset(&tile, 0, sizeof(wallTile));
+                }
+            }
+        }
+        m_wallTiles.swap(newWallTiles);
+        m_wallTilesWidth = newWidth;
+        m_wallTilesHeight = newHeight;
+    }
+
+    wallTile& tile = m_wallTiles[(tileY * m_wallTilesWidth) + tileX];
+    if (tile.frameNumber != m_frameNumber)
+    {
+        memset(tile.faces, 0, sizeof(tile.faces));
+        tile.frameNumber = m_frameNumber;
+    }
+
+    // Orientation 0, 90, 180 and 270 are the north, east, south and west face of the wall tile.
+    tile.faces[(orientation / 90) % 4] = picture;
+}
+
+const Picture* RendererSoftware::GetWallFace(const int32_t tileX, const int32_t tileY, const uint8_t faceIndex) const
+{
+    const wallTile& tile = m_wallTiles[(tileY * m_wallTilesWidth) + tileX];
+    if (tile.frameNumber != m_frameNumber)
+    {
+        return NULL;
+    }
+
+    if (tile.faces[faceIndex] != NULL)
+    {
+        return tile.faces[faceIndex];
+    }
+
+    // The ray hit a face that was not marked as visible; use any other face of the same tile.
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        if (tile.faces[i] != NULL)
+        {
+            return tile.faces[i];
+        }
+    }
+
+    return NULL;
+}
+
+// Casts a ray for each column in the range [firstColumn, lastColumn). Columns do not share any state, such that
+// the range can be split over multiple workers.
+void RendererSoftware::RenderColumns(const uint16_t firstColumn, const uint16_t lastColumn)
+{
+    const float halfViewHeight = (float)ViewHeight / 2.0f;
+    const int32_t playerTileX = (int32_t)floor(m_playerPosX);
+    const int32_t playerTileY = (int32_t)floor(m_playerPosY);
+    const int32_t maxSteps = m_wallTilesWidth + m_wallTilesHeight + abs(playerTileX) + abs(playerTileY) + 2;
+
+    for (uint16_t column = firstColumn; column < lastColumn; column++)
+    {
+        uint8_t* viewColumn = m_viewBuffer + (column * ViewHeight);
+        const float cameraX = ((float)column + 0.5f - ((float)ScreenWidth / 2.0f)) / m_focalLengthX;
+        const float rayDirX = m_forwardX + (m_rightX * cameraX);
+        const float rayDirY = m_forwardY + (m_rightY * cameraX);
+
+        // Digital differential analysis through the tile grid
+        int32_t tileX = playerTileX;
+        int32_t tileY = playerTileY;
+        const float deltaDistX = (rayDirX == 0.0f) ? NoWallHitDistance : (float)fabs(1.0f / rayDirX);
+        const float deltaDistY = (rayDirY == 0.0f) ? NoWallHitDistance : (float)fabs(1.0f / rayDirY);
+        const int32_t stepX = (rayDirX < 0.0f) ? -1 : 1;
+        const int32_t stepY = (rayDirY < 0.0f) ? -1 : 1;
+        float sideDistX = (rayDirX < 0.0f) ? (m_playerPosX - tileX) * deltaDistX : (tileX + 1.0f - m_playerPosX) * deltaDistX;
+        float sideDistY = (rayDirY < 0.0f) ? (m_playerPosY - tileY) * deltaDistY : (tileY + 1.0f - m_playerPosY) * deltaDistY;
+
+        const Picture* wallPicture = NULL;
+        bool hitXWall = false;
+        uint8_t faceIndex = 0;
+        for (int32_t step = 0; step < maxSteps && wallPicture == NULL; step++)
+        {
+            if (sideDistX < sideDistY)
+            {
+                sideDistX += deltaDistX;
+                tileX += stepX;
+                hitXWall = true;
+                faceIndex = (stepX > 0) ? 3 : 1;
+            }
+            else
+            {
+                sideDistY += deltaDistY;
+                tileY += stepY;
+                hitXWall = false;
+                faceIndex = (stepY > 0) ? 0 : 2;
+            }
+
+            if (tileX < 0 || tileY < 0 || tileX >= m_wallTilesWidth || tileY >= m_wallTilesHeight)
+            {
+                if ((tileX < 0 && stepX < 0) || (tileY < 0 && stepY < 0) || (tileX >= m_wallTilesWidth && stepX > 0) || (tileY >= m_wallTilesHeight && stepY > 0))
+                {
+                    // The ray left the tile grid
+                    break;
+                }
+            }
+            else
+            {
+                wallPicture = GetWallFace(tileX, tileY, faceIndex);
+            }
+        }
+
+        const texture* fullSizeTexture = (wallPicture != NULL) ? GetTexture(wallPicture->GetTextureId()) : NULL;
+        if (fullSizeTexture == NULL)
+        {
+            FillColumn(viewColumn, 0, ViewHeight / 2, m_ceilingColor);
+            FillColumn(viewColumn, ViewHeight / 2, ViewHeight, m_floorColor);
+            m_depthBuffer[column] = NoWallHitDistance;
+            continue;
+        }
+
+        // Since the forward component of the ray direction is 1, this is the perpendicular distance to the wall.
+        const float distance = std::max(hitXWall ? (sideDistX - deltaDistX) : (sideDistY - deltaDistY), NearClippingDistance);
+        m_depthBuffer[column] = distance;
+
+        // Horizontal texture coordinate, running from left to right as seen from the player.
+        const float hitPosition = hitXWall ? (m_playerPosY + (distance * rayDirY)) : (m_playerPosX + (distance * rayDirX));
+        const float fraction = hitPosition - (float)floor(hitPosition);
+        const float u = (faceIndex == 0 || faceIndex == 1) ? 1.0f - fraction : fraction;
+
+        const float wallHeight = m_focalLengthY / distance;
+
+        // Distant walls are sampled from a smaller mip level, which aliases less and stays within the cache.
+        uint8_t mipLevel = 0;
+        const texture* wallTexture = GetMipLevel(wallPicture->GetTextureId(), (float)fullSizeTexture->GetHeight() / wallHeight, mipLevel);
+        const uint16_t textureColumn = std::min<uint16_t>((uint16_t)(u * wallTexture->GetWidth()), wallTexture->GetWidth() - 1);
+        const float wallTop = halfViewHeight - (wallHeight / 2.0f);
+        const int32_t firstRow = std::max<int32_t>((int32_t)ceil(wallTop - 0.5f), 0);
+        const int32_t lastRow = std::min<int32_t>((int32_t)ceil(wallTop + wallHeight - 0.5f), ViewHeight);
+
+        FillColumn(viewColumn, 0, (uint16_t)firstRow, m_ceilingColor);
+
+        // Step through the texture column in 16.16 fixed point
+        const uint32_t textureStep = (uint32_t)(((float)wallTexture->GetHeight() / wallHeight) * 65536.0f);
+        uint32_t texturePosition = (uint32_t)((((float)firstRow + 0.5f - wallTop) / wallHeight) * wallTexture->GetHeight() * 65536.0f);
+        const uint32_t maxTextureRow = wallTexture->GetHeight() - 1;
+        for (int32_t row = firstRow; row < lastRow; row++)
+        {
+            const uint32_t textureRow = std::min<uint32_t>(texturePosition >> 16, maxTextureRow);
+            viewColumn[row] = wallTexture->GetColorIndex(textureColumn, (uint16_t)textureRow);
+            texturePosition += textureStep;
+        }
+
+        FillColumn(viewColumn, (uint16_t)std::max<int32_t>(lastRow, firstRow), ViewHeight, m_floorColor);
+    }
+}
+
+void RendererSoftware::FillColumn(uint8_t* column, const uint16_t firstRow, const uint16_t lastRow, const uint8_t colorIndex)
+{
+    // Columns are contiguous in the view buffer, which lets memset fill them with wide stores.
+    if (lastRow > firstRow)
+    {
+        memset(column + firstRow, colorIndex, lastRow - firstRow);
+    }
+}
+
+void RendererSoftware::CopyViewToFrameBuffer()
+{
+    // Transpose the column major view buffer into the upper part of the frame buffer. This is done in blocks
+    // of 8x8 pixels to stay within the cache lines of both buffers.
+    const uint16_t blockSize = 8;
+    for (uint16_t blockX = 0; blockX < ScreenWidth; blockX += blockSize)
+    {
+        for (uint16_t blockY = 0; blockY < ViewHeight; blockY += blockSize)
+        {
+            for (uint16_t x = blockX; x < blockX + blockSize; x++)
+            {
+                const uint8_t* viewColumn = m_viewBuffer + (x * ViewHeight);
+                for (uint16_t y = blockY; y < blockY + blockSize; y++)
+                {
+                    m_frameBuffer[(y * ScreenWidth) + x] = viewColumn[y];
+                }
+            }
+        }
+    }
+}
+
+void RendererSoftware::Render3DSprite(const Picture* picture, const float offsetX, const float offsetY)
+{
+    if (picture == NULL)
+    {
+        // Nothing to render
+        return;
+    }
+
+    if (GetTexture(picture->GetTextureId()) == NULL)
+    {
+        return;
+    }
+
+    // Transform the sprite position into view space
+    const float deltaX = offsetX - m_playerPosX;
+    const float deltaY = offsetY - m_playerPosY;
+    const float distance = (deltaX * m_forwardX) + (deltaY * m_forwardY);
+    if (distance < NearClippingDistance)
+    {
+        // Sprite is behind the player
+        return;
+    }
+    const float lateral = (deltaX * m_rightX) + (deltaY * m_rightY);
+
+    // Sprites are billboards with a width and height of 64 texels per tile, hanging from just below the ceiling.
+    const float spriteWidth = ((float)picture->GetWidth() / 64.0f) * m_focalLengthX / distance;
+    const float spriteLeft = ((float)ScreenWidth / 2.0f) + (lateral * m_focalLengthX / distance) - (spriteWidth / 2.0f);
+    const float spriteHeight = ((float)picture->GetHeight() / 64.0f) * m_focalLengthY / distance;
+    const float spriteTop = ((float)ViewHeight / 2.0f) + ((CeilingZ + SpriteOffsetZ - PlayerZ) * m_focalLengthY / distance);
+
+    // Only the trimmed rectangle of the picture holds opaque pixels, so the rest of the billboard is skipped.
+    const pictureRect& trimmedRect = picture->GetTrimmedRect();
+    const pictureRect& textureRect = picture->GetTextureRect();
+    const float texelWidth = spriteWidth / (float)picture->GetWidth();
+    const float texelHeight = spriteHeight / (float)picture->GetHeight();
+    const int32_t firstColumn = std::max<int32_t>((int32_t)ceil(spriteLeft + (trimmedRect.left * texelWidth) - 0.5f), 0);
+    const int32_t lastColumn = std::min<int32_t>((int32_t)ceil(spriteLeft + (trimmedRect.right * texelWidth) - 0.5f), ScreenWidth);
+    const int32_t firstRow = std::max<int32_t>((int32_t)ceil(spriteTop + (trimmedRect.top * texelHeight) - 0.5f), 0);
+    const int32_t lastRow = std::min<int32_t>((int32_t)ceil(spriteTop + (trimmedRect.bottom * texelHeight) - 0.5f), ViewHeight);
+
+    // Distant sprites are sampled from a smaller mip level; texture coordinates are shifted down accordingly.
+    uint8_t mipLevel = 0;
+    const texture* spriteTexture = GetMipLevel(picture->GetTextureId(), 1.0f / texelWidth, mipLevel);
+    const uint16_t maxTextureColumn = spriteTexture->GetWidth() - 1;
+    const uint16_t maxTextureRow = spriteTexture->GetHeight() - 1;
+
+    for (int32_t column = firstColumn; column < lastColumn; column++)
+    {
+        if (distance >= m_depthBuffer[column])
+        {
+            // Hidden behind a wall
+            continue;
+        }
+
+        const int32_t pictureColumn = std::min<int32_t>(std::max<int32_t>((int32_t)(((float)column + 0.5f - spriteLeft) / texelWidth), trimmedRect.left), trimmedRect.right - 1);
+        const uint16_t textureColumn = std::min<uint16_t>((uint16_t)((pictureColumn - textureRect.left) >> mipLevel), maxTextureColumn);
+        uint8_t* viewColumn = m_viewBuffer + (column * ViewHeight);
+        for (int32_t row = firstRow; row < lastRow; row++)
+        {
+            const int32_t pictureRow = std::min<int32_t>(std::max<int32_t>((int32_t)(((float)row + 0.5f - spriteTop) / texelHeight), trimmedRect.top), trimmedRect.bottom - 1);
+            const uint16_t textureRow = std::min<uint16_t>((uint16_t)((pictureRow - textureRect.top) >> mipLevel), maxTextureRow);
+            const uint8_t pixel = spriteTexture->GetPixel(textureColumn, textureRow);
+            if (pixel != TransparentPixel)
+            {
+                viewColumn[row] = pixel;
+            }
+        }
+    }
+}
+
+void RendererSoftware::RenderSprites(const SpriteQueue& spriteQueue)
+{
+    // The sprites are already sorted from back to front, such that nearby sprites cover the ones further away.
+    const SpriteQueue::spriteToRender* sprites = spriteQueue.GetSprites();
+    for (uint32_t i = 0; i < spriteQueue.GetNumberOfSprites(); i++)
+    {
+        Render3DSprite(sprites[i].picture, sprites[i].offsetX, sprites[i].offsetY);
+    }
+}
+
+void RendererSoftware::PrepareFloorAndCeiling()
+{
+
+}
+
+void RendererSoftware::UnprepareFloorAndCeiling()
+{
+
+}
+
+void RendererSoftware::RenderFloor(const uint16_t /*tileX*/, const uint16_t /*tileY*/, const egaColor colorIndex)
+{
+    // The floor has a single color, which is filled in below the wall of each column.
+    m_floorColor = colorIndex;
+}
+
+void RendererSoftware::RenderCeiling(const uint16_t /*tileX*/, const uint16_t /*tileY*/, const egaColor colorIndex)
+{
+    m_ceilingColor = colorIndex;
+}
+
+void RendererSoftware::PrepareVisibilityMap()
+{
+
+}
+
+void RendererSoftware::UnprepareVisibilityMap()
+{
+
+}
+
+const uint8_t* RendererSoftware::GetFrameBuffer() const
+{
+    return m_frameBuffer;
+}
+
+uint8_t RendererSoftware::GetPixel(const uint16_t x, const uint16_t y) const
+{
+    return m_frameBuffer[(y * ScreenWidth) + x];
+}
+
+float RendererSoftware::GetDepth(const uint16_t column) const
+{
+    return m_depthBuffer[column];
+}
+
+const TextLayoutCache& RendererSoftware::GetTextLayoutCache() const
+{
+    return m_textLayoutCache;
+}
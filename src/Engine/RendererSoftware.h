@@ -0,0 +1,160 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+//
+// RendererSoftware
+//
+// Platform independent renderer that draws into a 320x200 EGA color index frame buffer, like the original engine.
+// The 3D view is rendered column by column: the wall faces passed in via Render3DWall are collected into a tile grid,
+// through which one ray per screen column is cast. Sprites are scaled and clipped against the resulting 1D depth buffer.
+// The columns can be split over multiple threads; the worker threads are started once and wait for the next frame.
+//
+#pragma once
+
+#include "IRenderer.h"
+#include "TextLayoutCache.h"
+#include "IndexedPicture.h"
+#include <vector>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class RendererSoftware : public IRenderer
+{
+public:
+    RendererSoftware();
+    ~RendererSoftware();
+
+    void Setup() override;
+    void SetWindowDimensions(const uint16_t windowWidth, const uint16_t windowHeight) override;
+    void SetPlayerAngle(const float angle) override;
+    void SetPlayerPosition(const float posX, const float posY) override;
+    void SetTextureFilter(const TextureFilterSetting textureFilter) override;
+    void SetVSync(const bool enabled) override;
+    bool IsVSyncSupported() override;
+    uint32_t LoadFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height, const bool transparent) override;
+    uint32_t LoadMaskedFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height) override;
+    uint32_t LoadTilesSize8MaskedIntoTexture(const FileChunk* decompressedChunk) override;
+    uint32_t LoadFontIntoTexture(const bool* fontPicture) override;
+    void UnloadTexture(const uint32_t textureId) override;
+
+    void RenderTextLeftAligned(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) override;
+    void RenderTextCentered(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) override;
+    void RenderNumber(const uint16_t value, const Font* font, const uint8_t maxDigits, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) override;
+
+    void Prepare2DRendering() override;
+    void Unprepare2DRendering() override;
+    void Render2DPicture(const Picture* picture, const uint16_t offsetX, const uint16_t offsetY) override;
+    void Render2DTileSize8Masked(const Picture* tiles, const uint16_t tileIndex, const uint16_t offsetX, const uint16_t offsetY) override;
+    void Render2DBar(const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height, const egaColor colorIndex) override;
+    void RenderRadarBlip(const float x, const float y, const egaColor colorIndex) override;
+    void CaptureLayer(const uint8_t layerId, const uint16_t offsetX, const uint16_t offsetY, const uint16_t width, const uint16_t height) override;
+    bool RenderLayer(const uint8_t layerId) override;
+
+    void Prepare3DRendering(const bool depthShading, const float aspectRatio, uint16_t fov) override;
+
+    void PrepareWalls() override;
+    void UnprepareWalls() override;
+    void Render3DWall(const Picture* picture, const int16_t tileX, const int16_t tileY, const int16_t orientation) override;
+    void Render3DSprite(const Picture* picture, const float offsetX, const float offsetY) override;
+
+    void RenderSprites(const SpriteQueue& spriteQueue) override;
+    void PrepareFloorAndCeiling() override;
+    void UnprepareFloorAndCeiling() override;
+    void RenderFloor(const uint16_t tileX, const uint16_t tileY, const egaColor colorIndex) override;
+    void RenderCeiling(const uint16_t tileX, const uint16_t tileY, const egaColor colorIndex) override;
+
+    void PrepareVisibilityMap() override;
+    void UnprepareVisibilityMap() override;
+
+    // Number of threads that cast the columns of the 3D view, including the thread that renders the frame.
+    void SetNumberOfThreads(const uint8_t numberOfThreads);
+    uint8_t GetNumberOfThreads() const;
+
+    const uint8_t* GetFrameBuffer() const;
+    uint8_t GetPixel(const uint16_t x, const uint16_t y) const;
+    float GetDepth(const uint16_t column) const;
+    const TextLayoutCache& GetTextLayoutCache() const;
+
+    static const uint16_t ScreenWidth = 320;
+    static const uint16_t ScreenHeight = 200;
+    static const uint16_t ViewHeight = 120;
+
+private:
+    // Textures are kept as 4-bit color indices; the palette is applied when the frame buffer is presented.
+    typedef IndexedPicture texture;
+
+    typedef struct
+    {
+        uint16_t offsetX;
+        uint16_t offsetY;
+        uint16_t width;
+        uint16_t height;
+        std::vector<uint8_t> pixels;
+    } layer;
+
+    typedef struct
+    {
+        const Picture* faces[4];
+        uint32_t frameNumber;
+    } wallTile;
+
+    uint32_t AddTexture(const uint16_t width, const uint16_t height);
+    const texture* GetTexture(const uint32_t textureId) const;
+    const texture* GetMipLevel(const uint32_t textureId, const float texelsPerPixel, uint8_t& level) const;
+    void GenerateMipLevels(const uint32_t textureId);
+    const Picture* GetWallFace(const int32_t tileX, const int32_t tileY, const uint8_t faceIndex) const;
+    void RenderColumns(const uint16_t firstColumn, const uint16_t lastColumn);
+    void RenderColumnsOfThread(const uint8_t threadIndex);
+    void RunWorker(const uint8_t threadIndex, const uint32_t frameNumberAtStart);
+    void StopWorkers();
+    void FillColumn(uint8_t* column, const uint16_t firstRow, const uint16_t lastRow, const uint8_t colorIndex);
+    void CopyViewToFrameBuffer();
+    void RenderTextRun(const TextLayoutCache::textRun& textRun, const uint16_t offsetX, const uint16_t offsetY);
+    void BlitTexture(const texture* source, const uint16_t sourceX, const uint16_t sourceY, const uint16_t width, const uint16_t height, const int32_t offsetX, const int32_t offsetY, const uint8_t colorOverride);
+
+    uint8_t* m_frameBuffer;
+    uint8_t* m_viewBuffer;
+    float* m_depthBuffer;
+    bool m_viewRendered;
+
+    std::vector<texture> m_textures;
+    std::vector<std::vector<texture>> m_mipLevels;
+    std::vector<uint32_t> m_freeTextureIds;
+    std::vector<wallTile> m_wallTiles;
+    uint16_t m_wallTilesWidth;
+    uint16_t m_wallTilesHeight;
+    uint32_t m_frameNumber;
+    std::map<uint8_t, layer> m_layers;
+    TextLayoutCache m_textLayoutCache;
+
+    egaColor m_floorColor;
+    egaColor m_ceilingColor;
+    float m_playerAngle;
+    float m_playerPosX, m_playerPosY;
+    float m_forwardX, m_forwardY;
+    float m_rightX, m_rightY;
+    float m_focalLengthX;
+    float m_focalLengthY;
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_workersMutex;
+    std::condition_variable m_framePrepared;
+    std::condition_variable m_columnsRendered;
+    uint32_t m_workerFrameNumber;
+    uint8_t m_busyWorkers;
+    bool m_stopWorkers;
+};
@@ -0,0 +1,89 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+#include "RetainedLayer.h"
+
+// Parameters of the 32 bit FNV-1a hash
+const uint32_t FnvOffsetBasis = 2166136261u;
+const uint32_t FnvPrime = 16777619u;
+
+RetainedLayer::RetainedLayer(const uint8_t layerId, const uint16_t offsetX, const uint16_t offsetY, const uint16_t width, const uint16_t height) :
+    m_layerId(layerId),
+    m_offsetX(offsetX),
+    m_offsetY(offsetY),
+    m_width(width),
+    m_height(height),
+    m_hash(FnvOffsetBasis),
+    m_capturedHash(FnvOffsetBasis),
+    m_isCaptured(false),
+    m_numberOfCaptures(0)
+{
+
+}
+
+RetainedLayer::~RetainedLayer()
+{
+
+}
+
+void RetainedLayer::ResetHash()
+{
+    m_hash = FnvOffsetBasis;
+}
+
+void RetainedLayer::AddToHash(const void* data, const uint32_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        m_hash = (m_hash ^ bytes[i]) * FnvPrime;
+    }
+}
+
+void RetainedLayer::AddToHash(const std::string& text)
+{
+    // Include the terminating zero, such that consecutive strings cannot be confused with each other.
+    AddToHash(text.c_str(), (uint32_t)text.length() + 1);
+}
+
+// Returns true when the layer was drawn from the captured content. Returns false when the content changed
+// or the renderer no longer holds the captured layer; the caller must then render the layer and capture it.
+bool RetainedLayer::RenderIfUnchanged(IRenderer& renderer)
+{
+    if (!m_isCaptured || m_hash != m_capturedHash)
+    {
+        return false;
+    }
+
+    return renderer.RenderLayer(m_layerId);
+}
+
+void RetainedLayer::Capture(IRenderer& renderer)
+{
+    renderer.CaptureLayer(m_layerId, m_offsetX, m_offsetY, m_width, m_height);
+    m_capturedHash = m_hash;
+    m_isCaptured = true;
+    m_numberOfCaptures++;
+}
+
+void RetainedLayer::Invalidate()
+{
+    m_isCaptured = false;
+}
+
+uint32_t RetainedLayer::GetNumberOfCaptures() const
+{
+    return m_numberOfCaptures;
+}
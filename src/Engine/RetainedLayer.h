@@ -0,0 +1,55 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+//
+// RetainedLayer
+//
+// Rectangular part of the 2D screen that is only rendered again when its content changes, like the status bar.
+// The content is identified by a hash over everything that is displayed in the layer. As long as the hash is
+// unchanged, the renderer draws the previously captured layer with a single call.
+//
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include "IRenderer.h"
+
+class RetainedLayer
+{
+public:
+    RetainedLayer(const uint8_t layerId, const uint16_t offsetX, const uint16_t offsetY, const uint16_t width, const uint16_t height);
+    ~RetainedLayer();
+
+    void ResetHash();
+    void AddToHash(const void* data, const uint32_t size);
+    void AddToHash(const std::string& text);
+
+    bool RenderIfUnchanged(IRenderer& renderer);
+    void Capture(IRenderer& renderer);
+    void Invalidate();
+
+    uint32_t GetNumberOfCaptures() const;
+
+private:
+    const uint8_t m_layerId;
+    const uint16_t m_offsetX;
+    const uint16_t m_offsetY;
+    const uint16_t m_width;
+    const uint16_t m_height;
+    uint32_t m_hash;
+    uint32_t m_capturedHash;
+    bool m_isCaptured;
+    uint32_t m_numberOfCaptures;
+};
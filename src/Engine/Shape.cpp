@@ -71,7 +71,11 @@ FileChunk* ext_BLoad(const char *SourceFile)
     // Open file to load....
     //
 
+#ifdef _MSC_VER
     fopen_s(&handle, SourceFile, "rb");
+#else
+    handle = fopen(SourceFile, "rb");
+#endif
     if (handle == NULL)
     {
         return NULL;
@@ -138,6 +142,7 @@ bool Shape::LoadFromFile(const char* filename)
     // Evaluate the file
     //
     uint8_t *ptr = (uint8_t*)IFFfile->GetChunk();
+    uint32_t FileLen = 0;
     if (!CHUNK("FORM"))
         goto EXIT_FUNC;
     ptr += 4;
@@ -145,7 +150,7 @@ bool Shape::LoadFromFile(const char* filename)
 #define BE_Cross_Swap16(x) ((uint16_t)(((uint16_t)(x)<<8)|((uint16_t)(x)>>8)))
 #define BE_Cross_Swap32(x) ((uint32_t)(((uint32_t)(x)<<24)|(((uint32_t)(x)<<8)&0x00FF0000)|(((uint32_t)(x)>>8)&0x0000FF00)|((uint32_t)(x)>>24)))
 
-    uint32_t FileLen = BE_Cross_Swap32(*(uint32_t*)ptr);
+    FileLen = BE_Cross_Swap32(*(uint32_t*)ptr);
     ptr += 4;
 
     if (!CHUNK("ILBM"))
@@ -0,0 +1,227 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "SpatialHash.h"
+#include "Actor.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialHash::SpatialHash(const uint16_t width, const uint16_t height) :
+    m_width(width),
+    m_height(height),
+    m_actors(),
+    m_cellStart((width * height) + 1, 0),
+    m_cellActors(),
+    m_queryStamps(),
+    m_queryStamp(0),
+    m_hits()
+{
+
+}
+
+SpatialHash::~SpatialHash()
+{
+
+}
+
+// Registers the given actors, replacing the actors of the previous build.
+void SpatialHash::Build(const std::vector<Actor*>& actors)
+{
+    m_actors = actors;
+    m_queryStamps.assign(m_actors.size(), m_queryStamp);
+    std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+
+    // First count the number of actors per cell, then turn the counts into the start of each cell
+    for (const Actor* actor : m_actors)
+    {
+        const float size = actor->GetDecorateActor().size;
+        uint16_t cellMinX, cellMinY, cellMaxX, cellMaxY;
+        GetCellRange(actor->GetX() - size, actor->GetY() - size, actor->GetX() + size, actor->GetY() + size, cellMinX, cellMinY, cellMaxX, cellMaxY);
+        for (uint16_t y = cellMinY; y <= cellMaxY; y++)
+        {
+            for (uint16_t x = cellMinX; x <= cellMaxX; x++)
+            {
+                m_cellStart[(y * m_width) + x + 1]++;
+            }
+        }
+    }
+
+    const uint32_t numberOfCells = m_width * m_height;
+    for (uint32_t cell = 0; cell < numberOfCells; cell++)
+    {
+        m_cellStart[cell + 1] += m_cellStart[cell];
+    }
+    m_cellActors.resize(m_cellStart[numberOfCells]);
+
+    // Fill in the cells, using the start of the next cell as write position
+    for (uint32_t i = 0; i < m_actors.size(); i++)
+    {
+        Actor* actor = m_actors[i];
+        actor->m_spatialHashIndex = i;
+        const float size = actor->GetDecorateActor().size;
+        uint16_t cellMinX, cellMinY, cellMaxX, cellMaxY;
+        GetCellRange(actor->GetX() - size, actor->GetY() - size, actor->GetX() + size, actor->GetY() + size, cellMinX, cellMinY, cellMaxX, cellMaxY);
+        for (uint16_t y = cellMinY; y <= cellMaxY; y++)
+        {
+            for (uint16_t x = cellMinX; x <= cellMaxX; x++)
+            {
+                m_cellActors[m_cellStart[(y * m_width) + x + 1] - 1] = i;
+                m_cellStart[(y * m_width) + x + 1]--;
+            }
+        }
+    }
+
+    // Each write position has been moved back to the start of its cell; move them to the entry of that cell
+    for (uint32_t cell = 0; cell < numberOfCells; cell++)
+    {
+        m_cellStart[cell] = m_cellStart[cell + 1];
+    }
+    m_cellStart[numberOfCells] = (uint32_t)m_cellActors.size();
+}
+
+// Removes an actor that is deleted or no longer blocking before the next build. The actor is looked up through the
+// position it got in the last build; an actor that was not part of that build is ignored.
+void SpatialHash::Remove(const Actor* actor)
+{
+    const uint32_t actorIndex = actor->m_spatialHashIndex;
+    if (actorIndex < m_actors.size() && m_actors[actorIndex] == actor)
+    {
+        m_actors[actorIndex] = NULL;
+    }
+}
+
+// Returns the actors of which the bounding box overlaps the given box, each actor once.
+void SpatialHash::GetActorsInBox(const float minX, const float minY, const float maxX, const float maxY, std::vector<Actor*>& actors) const
+{
+    m_queryStamp++;
+    uint16_t cellMinX, cellMinY, cellMaxX, cellMaxY;
+    GetCellRange(minX, minY, maxX, maxY, cellMinX, cellMinY, cellMaxX, cellMaxY);
+    for (uint16_t y = cellMinY; y <= cellMaxY; y++)
+    {
+        for (uint16_t x = cellMinX; x <= cellMaxX; x++)
+        {
+            const uint32_t cell = (y * m_width) + x;
+            for (uint32_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; i++)
+            {
+                const uint32_t actorIndex = m_cellActors[i];
+                Actor* actor = m_actors[actorIndex];
+                if (actor == NULL || m_queryStamps[actorIndex] == m_queryStamp)
+                {
+                    continue;
+                }
+                m_queryStamps[actorIndex] = m_queryStamp;
+
+                const float size = actor->GetDecorateActor().size;
+                if (actor->GetX() + size > minX && actor->GetX() - size < maxX && actor->GetY() + size > minY && actor->GetY() - size < maxY)
+                {
+                    actors.push_back(actor);
+                }
+            }
+        }
+    }
+}
+
+// Returns the actors that a box with the given half size hits while it moves from the start to the end position,
+// in the order in which they are hit.
+void SpatialHash::GetActorsOnPath(const float startX, const float startY, const float endX, const float endY, const float size, std::vector<Actor*>& actors) const
+{
+    m_queryStamp++;
+    m_hits.clear();
+    uint16_t cellMinX, cellMinY, cellMaxX, cellMaxY;
+    GetCellRange(std::min(startX, endX) - size, std::min(startY, endY) - size, std::max(startX, endX) + size, std::max(startY, endY) + size, cellMinX, cellMinY, cellMaxX, cellMaxY);
+    for (uint16_t y = cellMinY; y <= cellMaxY; y++)
+    {
+        for (uint16_t x = cellMinX; x <= cellMaxX; x++)
+        {
+            const uint32_t cell = (y * m_width) + x;
+            for (uint32_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; i++)
+            {
+                const uint32_t actorIndex = m_cellActors[i];
+                Actor* actor = m_actors[actorIndex];
+                if (actor == NULL || m_queryStamps[actorIndex] == m_queryStamp)
+                {
+                    continue;
+                }
+                m_queryStamps[actorIndex] = m_queryStamp;
+
+                float entryTime = 0.0f;
+                if (SweepBoxes(startX, startY, endX, endY, size, actor->GetX(), actor->GetY(), actor->GetDecorateActor().size, entryTime))
+                {
+                    const hit newHit = { entryTime, actor };
+                    m_hits.push_back(newHit);
+                }
+            }
+        }
+    }
+
+    std::stable_sort(m_hits.begin(), m_hits.end(), [](const hit& a, const hit& b) { return a.entryTime < b.entryTime; });
+    for (const hit& actorHit : m_hits)
+    {
+        actors.push_back(actorHit.actor);
+    }
+}
+
+size_t SpatialHash::GetNumberOfActors() const
+{
+    return m_actors.size();
+}
+
+// Checks whether a box with the given half size hits another box while it moves from the start to the end position.
+// The moving box is shrunk to a point and the other box grown by the same size, after which the path is clipped
+// against the slabs of the grown box. The boxes only hit when they overlap; touching is not enough.
+// On a hit, the entry time is the fraction of the path at which the boxes start to overlap.
+bool SpatialHash::SweepBoxes(const float startX, const float startY, const float endX, const float endY, const float size, const float x, const float y, const float otherSize, float& entryTime)
+{
+    const float extent = size + otherSize;
+    const float start[2] = { startX - x, startY - y };
+    const float delta[2] = { endX - startX, endY - startY };
+    float enter = 0.0f;
+    float exit = 1.0f;
+    for (uint8_t axis = 0; axis < 2; axis++)
+    {
+        if (delta[axis] == 0.0f)
+        {
+            if (std::abs(start[axis]) >= extent)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            float t0 = (-extent - start[axis]) / delta[axis];
+            float t1 = (extent - start[axis]) / delta[axis];
+            if (t0 > t1)
+            {
+                std::swap(t0, t1);
+            }
+            enter = std::max(enter, t0);
+            exit = std::min(exit, t1);
+            if (enter >= exit)
+            {
+                return false;
+            }
+        }
+    }
+
+    entryTime = enter;
+    return true;
+}
+
+void SpatialHash::GetCellRange(const float minX, const float minY, const float maxX, const float maxY, uint16_t& cellMinX, uint16_t& cellMinY, uint16_t& cellMaxX, uint16_t& cellMaxY) const
+{
+    cellMinX = (minX < 0.0f) ? 0 : (minX >= m_width) ? m_width - 1 : (uint16_t)minX;
+    cellMinY = (minY < 0.0f) ? 0 : (minY >= m_height) ? m_height - 1 : (uint16_t)minY;
+    cellMaxX = (maxX < 0.0f) ? 0 : (maxX >= m_width) ? m_width - 1 : (uint16_t)maxX;
+    cellMaxY = (maxY < 0.0f) ? 0 : (maxY >= m_height) ? m_height - 1 : (uint16_t)maxY;
+}
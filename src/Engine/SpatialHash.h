@@ -0,0 +1,65 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// SpatialHash
+//
+// Uniform grid with a cell for each tile of the level, in which actors are registered by their bounding box.
+// An actor that overlaps multiple tiles, like a monster that is halfway between two tiles, is registered in each
+// of them. The grid is rebuilt every frame in one go: the actors of all cells are stored in a single array, sorted
+// by cell, which keeps a rebuild free of allocations once the arrays have grown to size.
+// Used to find the actors that a projectile hits while it moves, in time proportional to the number of actors near
+// its path.
+//
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+class Actor;
+
+class SpatialHash
+{
+public:
+    SpatialHash(const uint16_t width, const uint16_t height);
+    ~SpatialHash();
+
+    void Build(const std::vector<Actor*>& actors);
+    void Remove(const Actor* actor);
+    void GetActorsInBox(const float minX, const float minY, const float maxX, const float maxY, std::vector<Actor*>& actors) const;
+    void GetActorsOnPath(const float startX, const float startY, const float endX, const float endY, const float size, std::vector<Actor*>& actors) const;
+    size_t GetNumberOfActors() const;
+
+    static bool SweepBoxes(const float startX, const float startY, const float endX, const float endY, const float size, const float x, const float y, const float otherSize, float& entryTime);
+
+private:
+    typedef struct
+    {
+        float entryTime;
+        Actor* actor;
+    } hit;
+
+    void GetCellRange(const float minX, const float minY, const float maxX, const float maxY, uint16_t& cellMinX, uint16_t& cellMinY, uint16_t& cellMaxX, uint16_t& cellMaxY) const;
+
+    const uint16_t m_width;
+    const uint16_t m_height;
+    std::vector<Actor*> m_actors;
+    std::vector<uint32_t> m_cellStart;
+    std::vector<uint32_t> m_cellActors;
+    mutable std::vector<uint32_t> m_queryStamps;
+    mutable uint32_t m_queryStamp;
+    mutable std::vector<hit> m_hits;
+};
+
@@ -0,0 +1,126 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+#include "SpriteQueue.h"
+#include <string.h>
+
+SpriteQueue::SpriteQueue() :
+    m_sprites(),
+    m_sortBuffer(),
+    m_viewPointX(0.0f),
+    m_viewPointY(0.0f)
+{
+
+}
+
+SpriteQueue::~SpriteQueue()
+{
+
+}
+
+void SpriteQueue::Reset(const float viewPointX, const float viewPointY)
+{
+    // Clearing keeps the allocated capacity, such that no allocations are needed once the queue has grown.
+    m_sprites.clear();
+    m_viewPointX = viewPointX;
+    m_viewPointY = viewPointY;
+}
+
+void SpriteQueue::AddSprite(const Picture* picture, const float offsetX, const float offsetY)
+{
+    spriteToRender sprite;
+    sprite.picture = picture;
+    sprite.offsetX = offsetX;
+    sprite.offsetY = offsetY;
+    sprite.squaredDistance = ((offsetX - m_viewPointX) * (offsetX - m_viewPointX)) + ((offsetY - m_viewPointY) * (offsetY - m_viewPointY));
+    m_sprites.push_back(sprite);
+}
+
+// Least significant digit radix sort on the bits of the squared distance, one byte per pass.
+// For non-negative floats the bit pattern has the same ordering as the value itself. The bits are inverted,
+// such that an ascending sort on the key results in the sprites being ordered from far to near.
+void SpriteQueue::SortBackToFront()
+{
+    const uint32_t numberOfSprites = (uint32_t)m_sprites.size();
+    if (numberOfSprites < 2)
+    {
+        return;
+    }
+
+    uint32_t histogram[4][256];
+    memset(histogram, 0, sizeof(histogram));
+    for (uint32_t i = 0; i < numberOfSprites; i++)
+    {
+        uint32_t key;
+        memcpy(&key, &m_sprites[i].squaredDistance, sizeof(key));
+        key = ~key;
+        histogram[0][key & 0xFF]++;
+        histogram[1][(key >> 8) & 0xFF]++;
+        histogram[2][(key >> 16) & 0xFF]++;
+        histogram[3][key >> 24]++;
+    }
+
+    m_sortBuffer.resize(numberOfSprites);
+    spriteToRender* source = m_sprites.data();
+    spriteToRender* destination = m_sortBuffer.data();
+
+    for (uint8_t pass = 0; pass < 4; pass++)
+    {
+        const uint8_t shift = pass * 8;
+        uint32_t* counts = histogram[pass];
+
+        // A pass in which all keys have the same digit would not change the order; skip it.
+        uint32_t key;
+        memcpy(&key, &source[0].squaredDistance, sizeof(key));
+        if (counts[((~key) >> shift) & 0xFF] == numberOfSprites)
+        {
+            continue;
+        }
+
+        // Turn the counts into start offsets
+        uint32_t offset = 0;
+        for (uint16_t digit = 0; digit < 256; digit++)
+        {
+            const uint32_t count = counts[digit];
+            counts[digit] = offset;
+            offset += count;
+        }
+
+        for (uint32_t i = 0; i < numberOfSprites; i++)
+        {
+            memcpy(&key, &source[i].squaredDistance, sizeof(key));
+            destination[counts[((~key) >> shift) & 0xFF]++] = source[i];
+        }
+
+        spriteToRender* swap = source;
+        source = destination;
+        destination = swap;
+    }
+
+    if (source != m_sprites.data())
+    {
+        m_sprites.swap(m_sortBuffer);
+    }
+}
+
+uint32_t SpriteQueue::GetNumberOfSprites() const
+{
+    return (uint32_t)m_sprites.size();
+}
+
+const SpriteQueue::spriteToRender* SpriteQueue::GetSprites() const
+{
+    return m_sprites.data();
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+//
+// SpriteQueue
+//
+// Collects the sprites that are visible in the current frame and sorts them from back to front, such that
+// renderers can draw them in order without having to sort them themselves.
+//
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+class Picture;
+
+class SpriteQueue
+{
+public:
+    typedef struct
+    {
+        const Picture* picture;
+        float offsetX;
+        float offsetY;
+        float squaredDistance;
+    } spriteToRender;
+
+    SpriteQueue();
+    ~SpriteQueue();
+
+    void Reset(const float viewPointX, const float viewPointY);
+    void AddSprite(const Picture* picture, const float offsetX, const float offsetY);
+    void SortBackToFront();
+
+    uint32_t GetNumberOfSprites() const;
+    const spriteToRender* GetSprites() const;
+
+private:
+    std::vector<spriteToRender> m_sprites;
+    std::vector<spriteToRender> m_sortBuffer;
+    float m_viewPointX;
+    float m_viewPointY;
+};
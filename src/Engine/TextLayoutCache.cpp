@@ -0,0 +1,120 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+#include "TextLayoutCache.h"
+#include "Font.h"
+
+const float TextLayoutCache::GlyphTextureHeight = 1.0f / 16.0f;
+
+TextLayoutCache::TextLayoutCache(const uint16_t maxNumberOfRuns) :
+    m_textRuns(),
+    m_maxNumberOfRuns(maxNumberOfRuns),
+    m_hits(0),
+    m_misses(0)
+{
+
+}
+
+TextLayoutCache::~TextLayoutCache()
+{
+
+}
+
+const TextLayoutCache::textRun& TextLayoutCache::GetTextRun(const char* text, const Font* font, const egaColor colorIndex)
+{
+    textRunKey key;
+    key.font = font;
+    key.colorIndex = colorIndex;
+    key.text = text;
+
+    std::map<textRunKey, textRun>::iterator it = m_textRuns.find(key);
+    if (it != m_textRuns.end())
+    {
+        m_hits++;
+        return it->second;
+    }
+
+    m_misses++;
+    if (m_textRuns.size() >= m_maxNumberOfRuns)
+    {
+        // Strings that change every frame, like the frame rate counter, would make the cache grow without limit.
+        // Start over when it is full; the strings that are still in use will quickly be added again.
+        m_textRuns.clear();
+    }
+
+    textRun& run = m_textRuns[key];
+    run.font = font;
+    run.colorIndex = colorIndex;
+    LayoutText(text, run);
+
+    return run;
+}
+
+// The font texture contains 16x16 characters of 16x10 pixels each, ordered by character index.
+void TextLayoutCache::LayoutText(const char* text, textRun& run) const
+{
+    run.glyphs.clear();
+    uint16_t combinedWidth = 0;
+    for (const char* character = text; *character != 0; character++)
+    {
+        const uint8_t charIndex = (uint8_t)*character;
+        const uint16_t charWidth = run.font->GetCharacterWidth(charIndex);
+
+        glyphQuad glyph;
+        glyph.offsetX = combinedWidth;
+        glyph.width = charWidth;
+        glyph.sourceX = (charIndex % 16) * 16;
+        glyph.sourceY = (charIndex / 16) * GlyphHeight;
+        glyph.textureOffsetX = float(charIndex % 16) / 16.0f;
+        glyph.textureOffsetY = float(charIndex / 16) / 16.0f;
+        glyph.textureWidth = (float)(charWidth) / 256.0f;
+        run.glyphs.push_back(glyph);
+
+        combinedWidth += charWidth;
+    }
+    run.width = combinedWidth;
+}
+
+void TextLayoutCache::Clear()
+{
+    m_textRuns.clear();
+}
+
+uint32_t TextLayoutCache::GetNumberOfRuns() const
+{
+    return (uint32_t)m_textRuns.size();
+}
+
+uint32_t TextLayoutCache::GetHits() const
+{
+    return m_hits;
+}
+
+uint32_t TextLayoutCache::GetMisses() const
+{
+    return m_misses;
+}
+
+float TextLayoutCache::GetHitRate() const
+{
+    const uint32_t lookups = m_hits + m_misses;
+    return (lookups == 0) ? 0.0f : (float)m_hits / (float)lookups;
+}
+
+void TextLayoutCache::ResetCounters()
+{
+    m_hits = 0;
+    m_misses = 0;
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+//
+// TextLayoutCache
+//
+// Keeps the glyph layout of recently rendered strings, such that text that is identical from frame to frame
+// (location names, status messages, numbers in the status bar) does not need to be laid out again.
+//
+#pragma once
+
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "EgaColor.h"
+
+class Font;
+
+class TextLayoutCache
+{
+public:
+    typedef struct
+    {
+        int16_t offsetX;
+        uint16_t width;
+        uint16_t sourceX;
+        uint16_t sourceY;
+        float textureOffsetX;
+        float textureOffsetY;
+        float textureWidth;
+    } glyphQuad;
+
+    typedef struct
+    {
+        const Font* font;
+        egaColor colorIndex;
+        uint16_t width;
+        std::vector<glyphQuad> glyphs;
+    } textRun;
+
+    static const uint16_t GlyphHeight = 10;
+    static const float GlyphTextureHeight;
+
+    TextLayoutCache(const uint16_t maxNumberOfRuns = 256);
+    ~TextLayoutCache();
+
+    const textRun& GetTextRun(const char* text, const Font* font, const egaColor colorIndex);
+    void Clear();
+
+    uint32_t GetNumberOfRuns() const;
+    uint32_t GetHits() const;
+    uint32_t GetMisses() const;
+    float GetHitRate() const;
+    void ResetCounters();
+
+private:
+    typedef struct textRunKey
+    {
+        const Font* font;
+        egaColor colorIndex;
+        std::string text;
+
+        bool operator<(const textRunKey& other) const
+        {
+            if (font != other.font)
+            {
+                return font < other.font;
+            }
+            if (colorIndex != other.colorIndex)
+            {
+                return colorIndex < other.colorIndex;
+            }
+            return text < other.text;
+        }
+    } textRunKey;
+
+    void LayoutText(const char* text, textRun& run) const;
+
+    std::map<textRunKey, textRun> m_textRuns;
+    const uint16_t m_maxNumberOfRuns;
+    uint32_t m_hits;
+    uint32_t m_misses;
+};
@@ -0,0 +1,192 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "TextureResidency.h"
+#include "Picture.h"
+
+TextureResidency::TextureResidency(IRenderer& renderer, const uint32_t budgetInBytes) :
+    m_renderer(renderer),
+    m_entries(),
+    m_leastRecentlyUsed(NoEntry),
+    m_mostRecentlyUsed(NoEntry),
+    m_budgetInBytes(budgetInBytes),
+    m_frameNumber(1),
+    m_numberOfResidentPictures(0),
+    m_residentBytes(0),
+    m_numberOfEvictions(0),
+    m_numberOfRedecodes(0)
+{
+
+}
+
+TextureResidency::~TextureResidency()
+{
+    // The pictures in the slots are owned by the EgaGraph.
+}
+
+// Registers a range of picture slots. Returns the entry id of the first slot; the other slots follow consecutively.
+uint32_t TextureResidency::AddSlots(Picture** slots, const uint16_t numberOfSlots)
+{
+    const uint32_t firstEntryId = (uint32_t)m_entries.size();
+    for (uint16_t i = 0; i < numberOfSlots; i++)
+    {
+        const residencyEntry entry = { &slots[i], 0, 0, false, NoEntry, NoEntry };
+        m_entries.push_back(entry);
+    }
+    return firstEntryId;
+}
+
+// To be called after a picture was decoded into the slot of the given entry.
+void TextureResidency::SetResident(const uint32_t entryId)
+{
+    residencyEntry& entry = m_entries.at(entryId);
+    const Picture* picture = *entry.slot;
+    if (picture == NULL || entry.sizeInBytes != 0)
+    {
+        return;
+    }
+
+    entry.sizeInBytes = (uint32_t)picture->GetTextureWidth() * (uint32_t)picture->GetTextureHeight() * BytesPerTexel;
+    entry.lastUsedFrame = m_frameNumber;
+    m_numberOfResidentPictures++;
+    m_residentBytes += entry.sizeInBytes;
+    AddToMostRecentlyUsed(entryId);
+    if (entry.evicted)
+    {
+        m_numberOfRedecodes++;
+        entry.evicted = false;
+    }
+}
+
+void TextureResidency::Touch(const uint32_t entryId)
+{
+    residencyEntry& entry = m_entries[entryId];
+    if (entry.lastUsedFrame == m_frameNumber)
+    {
+        return;
+    }
+
+    entry.lastUsedFrame = m_frameNumber;
+    if (entry.sizeInBytes != 0)
+    {
+        RemoveFromList(entryId);
+        AddToMostRecentlyUsed(entryId);
+    }
+}
+
+void TextureResidency::BeginFrame()
+{
+    m_frameNumber++;
+    if (m_residentBytes > m_budgetInBytes)
+    {
+        EvictLeastRecentlyUsed();
+    }
+}
+
+void TextureResidency::EvictLeastRecentlyUsed()
+{
+    while (m_residentBytes > m_budgetInBytes && m_leastRecentlyUsed != NoEntry)
+    {
+        const uint32_t entryId = m_leastRecentlyUsed;
+        residencyEntry& entry = m_entries[entryId];
+
+        // Pictures that were drawn in the previous frame are likely to be drawn again; evicting those would only
+        // result in decoding them every frame. The working set does not fit, so the budget is exceeded for now.
+        if (entry.lastUsedFrame + 1 >= m_frameNumber)
+        {
+            return;
+        }
+
+        Picture* picture = *entry.slot;
+        m_renderer.UnloadTexture(picture->GetTextureId());
+        delete picture;
+        *entry.slot = NULL;
+
+        RemoveFromList(entryId);
+        m_residentBytes -= entry.sizeInBytes;
+        m_numberOfResidentPictures--;
+        m_numberOfEvictions++;
+        entry.sizeInBytes = 0;
+        entry.evicted = true;
+    }
+}
+
+void TextureResidency::AddToMostRecentlyUsed(const uint32_t entryId)
+{
+    residencyEntry& entry = m_entries[entryId];
+    entry.previous = m_mostRecentlyUsed;
+    entry.next = NoEntry;
+    if (m_mostRecentlyUsed != NoEntry)
+    {
+        m_entries[m_mostRecentlyUsed].next = entryId;
+    }
+    else
+    {
+        m_leastRecentlyUsed = entryId;
+    }
+    m_mostRecentlyUsed = entryId;
+}
+
+void TextureResidency::RemoveFromList(const uint32_t entryId)
+{
+    residencyEntry& entry = m_entries[entryId];
+    if (entry.previous != NoEntry)
+    {
+        m_entries[entry.previous].next = entry.next;
+    }
+    else
+    {
+        m_leastRecentlyUsed = entry.next;
+    }
+    if (entry.next != NoEntry)
+    {
+        m_entries[entry.next].previous = entry.previous;
+    }
+    else
+    {
+        m_mostRecentlyUsed = entry.previous;
+    }
+    entry.previous = NoEntry;
+    entry.next = NoEntry;
+}
+
+void TextureResidency::SetBudget(const uint32_t budgetInBytes)
+{
+    m_budgetInBytes = budgetInBytes;
+}
+
+uint32_t TextureResidency::GetBudget() const
+{
+    return m_budgetInBytes;
+}
+
+uint32_t TextureResidency::GetNumberOfResidentPictures() const
+{
+    return m_numberOfResidentPictures;
+}
+
+uint32_t TextureResidency::GetResidentBytes() const
+{
+    return m_residentBytes;
+}
+
+uint32_t TextureResidency::GetNumberOfEvictions() const
+{
+    return m_numberOfEvictions;
+}
+
+uint32_t TextureResidency::GetNumberOfRedecodes() const
+{
+    return m_numberOfRedecodes;
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// TextureResidency
+//
+// Keeps track of the memory used by decoded pictures and their textures. Each picture slot of the EgaGraph is
+// registered as an entry. When the total size of the resident pictures exceeds the budget, the least recently
+// drawn pictures are deleted at the start of the next frame; they are decoded again when needed.
+// The resident pictures are kept in a list from least to most recently used, which is updated at most once per
+// picture per frame. Pictures that were drawn in the previous frame are not evicted; if the budget cannot be met
+// without them, it is exceeded until the pictures are no longer drawn.
+//
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "IRenderer.h"
+
+class Picture;
+
+class TextureResidency
+{
+public:
+    TextureResidency(IRenderer& renderer, const uint32_t budgetInBytes);
+    ~TextureResidency();
+
+    uint32_t AddSlots(Picture** slots, const uint16_t numberOfSlots);
+    void SetResident(const uint32_t entryId);
+    void Touch(const uint32_t entryId);
+    void BeginFrame();
+
+    void SetBudget(const uint32_t budgetInBytes);
+    uint32_t GetBudget() const;
+
+    uint32_t GetNumberOfResidentPictures() const;
+    uint32_t GetResidentBytes() const;
+    uint32_t GetNumberOfEvictions() const;
+    uint32_t GetNumberOfRedecodes() const;
+
+    static const uint32_t BytesPerTexel = 4;
+
+private:
+    typedef struct
+    {
+        Picture** slot;
+        uint32_t sizeInBytes;
+        uint32_t lastUsedFrame;
+        bool evicted;
+        uint32_t previous;
+        uint32_t next;
+    } residencyEntry;
+
+    void EvictLeastRecentlyUsed();
+    void AddToMostRecentlyUsed(const uint32_t entryId);
+    void RemoveFromList(const uint32_t entryId);
+
+    static const uint32_t NoEntry = 0xFFFFFFFF;
+
+    IRenderer& m_renderer;
+    std::vector<residencyEntry> m_entries;
+    uint32_t m_leastRecentlyUsed;
+    uint32_t m_mostRecentlyUsed;
+    uint32_t m_budgetInBytes;
+    uint32_t m_frameNumber;
+    uint32_t m_numberOfResidentPictures;
+    uint32_t m_residentBytes;
+    uint32_t m_numberOfEvictions;
+    uint32_t m_numberOfRedecodes;
+};
@@ -0,0 +1,188 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "TimerWheel.h"
+#include "Actor.h"
+
+TimerWheel::TimerWheel() :
+    m_numberOfScheduledActors(0),
+    m_currentTime(0)
+{
+
+}
+
+TimerWheel::~TimerWheel()
+{
+
+}
+
+// Schedules the actor to wake up at the given time. An earlier wake-up of the same actor is replaced.
+// A wake-up time that has already passed is due at the next advance of the wheel.
+void TimerWheel::Schedule(Actor* actor, const uint32_t wakeUpTime)
+{
+    Remove(actor);
+    const wakeUp entry = { actor, wakeUpTime };
+    Insert(entry, m_currentTime + 1);
+    m_numberOfScheduledActors++;
+}
+
+void TimerWheel::Cancel(const Actor* actor)
+{
+    Remove(actor);
+}
+
+bool TimerWheel::IsScheduled(const Actor* actor) const
+{
+    return HoldsWakeUpOf(actor);
+}
+
+// Moves the wheel forward to the given time and collects all actors that are due, in order of wake-up time.
+// The wheel never moves back; it stands still for as long as the time does, like while time is frozen.
+void TimerWheel::Advance(const uint32_t currentTime, std::vector<Actor*>& dueActors)
+{
+    while (m_currentTime < currentTime)
+    {
+        const uint32_t nextEventTime = (m_numberOfScheduledActors == 0) ? UINT32_MAX : GetNextEventTime();
+        if (nextEventTime > currentTime)
+        {
+            // Nothing happens before the given time; skip ahead.
+            m_currentTime = currentTime;
+            break;
+        }
+
+        m_currentTime = nextEventTime;
+
+        // Each time a level completes a full turn, the next slot of the level above is spread over the levels below.
+        for (uint8_t level = 1; level < NumberOfLevels; level++)
+        {
+            const uint8_t shift = level * SlotBits;
+            if ((m_currentTime & ((1u << shift) - 1)) != 0)
+            {
+                break;
+            }
+
+            std::vector<wakeUp> entries;
+            entries.swap(m_slots[level][(m_currentTime >> shift) & (SlotsPerLevel - 1)]);
+            for (const wakeUp& entry : entries)
+            {
+                Insert(entry, m_currentTime);
+            }
+        }
+
+        std::vector<wakeUp>& slot = m_slots[0][m_currentTime & (SlotsPerLevel - 1)];
+        for (const wakeUp& entry : slot)
+        {
+            dueActors.push_back(entry.actor);
+        }
+        m_numberOfScheduledActors -= slot.size();
+        slot.clear();
+    }
+}
+
+uint32_t TimerWheel::GetCurrentTime() const
+{
+    return m_currentTime;
+}
+
+size_t TimerWheel::GetNumberOfScheduledActors() const
+{
+    return m_numberOfScheduledActors;
+}
+
+// Puts the wake-up in the lowest level that spans its wake-up time, but not before the given earliest time.
+// Wake-ups beyond the reach of the highest level are put in its last slot and moved down again from there.
+void TimerWheel::Insert(const wakeUp& entry, const uint32_t earliestTime)
+{
+    const uint32_t wakeUpTime = (entry.wakeUpTime > earliestTime) ? entry.wakeUpTime : earliestTime;
+    uint32_t delta = wakeUpTime - m_currentTime;
+    const uint32_t maxDelta = (1u << (NumberOfLevels * SlotBits)) - 1;
+    if (delta > maxDelta)
+    {
+        delta = maxDelta;
+    }
+
+    uint8_t level = 0;
+    while (level < NumberOfLevels - 1 && delta >= (1u << ((level + 1) * SlotBits)))
+    {
+        level++;
+    }
+
+    const uint32_t slotTime = m_currentTime + delta;
+    const uint8_t slotIndex = (slotTime >> (level * SlotBits)) & (SlotsPerLevel - 1);
+    std::vector<wakeUp>& slot = m_slots[level][slotIndex];
+    entry.actor->m_wakeUpLevel = level;
+    entry.actor->m_wakeUpSlot = slotIndex;
+    entry.actor->m_wakeUpIndex = (uint32_t)slot.size();
+    slot.push_back(entry);
+}
+
+// Takes the wake-up of the actor out of its slot, by moving the last wake-up of that slot in its place.
+void TimerWheel::Remove(const Actor* actor)
+{
+    if (!HoldsWakeUpOf(actor))
+    {
+        return;
+    }
+
+    std::vector<wakeUp>& slot = m_slots[actor->m_wakeUpLevel][actor->m_wakeUpSlot];
+    const uint32_t index = actor->m_wakeUpIndex;
+    if (index + 1 < slot.size())
+    {
+        slot[index] = slot.back();
+        slot[index].actor->m_wakeUpIndex = index;
+    }
+    slot.pop_back();
+    m_numberOfScheduledActors--;
+}
+
+// The position that an actor keeps is only valid as long as the wake-up at that position is its own; it is not
+// cleared when the wake-up is due.
+bool TimerWheel::HoldsWakeUpOf(const Actor* actor) const
+{
+    if (actor == NULL || actor->m_wakeUpLevel >= NumberOfLevels || actor->m_wakeUpSlot >= SlotsPerLevel)
+    {
+        return false;
+    }
+
+    const std::vector<wakeUp>& slot = m_slots[actor->m_wakeUpLevel][actor->m_wakeUpSlot];
+    return actor->m_wakeUpIndex < slot.size() && slot[actor->m_wakeUpIndex].actor == actor;
+}
+
+// Returns the earliest time after the current time at which the wheel has work to do: either a slot in the first
+// level that holds wake-ups, or a slot in a higher level that holds wake-ups and is about to be spread over the
+// levels below. Wake-ups are never more than one turn of their level ahead, so each level is searched for one turn.
+uint32_t TimerWheel::GetNextEventTime() const
+{
+    uint32_t nextEventTime = UINT32_MAX;
+    for (uint8_t level = 0; level < NumberOfLevels; level++)
+    {
+        const uint8_t shift = level * SlotBits;
+        for (uint32_t step = 1; step <= SlotsPerLevel; step++)
+        {
+            const uint32_t slotTime = ((m_currentTime >> shift) + step) << shift;
+            if (slotTime >= nextEventTime)
+            {
+                break;
+            }
+
+            if (!m_slots[level][(slotTime >> shift) & (SlotsPerLevel - 1)].empty())
+            {
+                nextEventTime = slotTime;
+                break;
+            }
+        }
+    }
+
+    return nextEventTime;
+}
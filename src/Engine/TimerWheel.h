@@ -0,0 +1,67 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// TimerWheel
+//
+// Hierarchical timer wheel that keeps track of when actors need to wake up, keyed on the time of the world in
+// milliseconds. Each level of the wheel has 64 slots; a slot in the first level spans one millisecond, a slot in
+// each next level spans all slots of the level below it. A wake-up is stored in the lowest level that can hold it
+// and moves down a level each time the wheel passes its slot, such that scheduling, cancelling and advancing the
+// wheel take constant time per actor, regardless of how many actors are asleep. Advancing the wheel jumps straight
+// to the next slot that holds a wake-up, so long stretches without wake-ups cost nothing.
+// Each actor keeps the position of its wake-up in the wheel, such that it can be found without a search.
+//
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+class Actor;
+
+class TimerWheel
+{
+public:
+    TimerWheel();
+    ~TimerWheel();
+
+    void Schedule(Actor* actor, const uint32_t wakeUpTime);
+    void Cancel(const Actor* actor);
+    bool IsScheduled(const Actor* actor) const;
+    void Advance(const uint32_t currentTime, std::vector<Actor*>& dueActors);
+    uint32_t GetCurrentTime() const;
+    size_t GetNumberOfScheduledActors() const;
+
+    static const uint8_t NumberOfLevels = 4;
+    static const uint8_t SlotBits = 6;
+    static const uint8_t SlotsPerLevel = 1 << SlotBits;
+
+private:
+    typedef struct
+    {
+        Actor* actor;
+        uint32_t wakeUpTime;
+    } wakeUp;
+
+    void Insert(const wakeUp& entry, const uint32_t earliestTime);
+    void Remove(const Actor* actor);
+    bool HoldsWakeUpOf(const Actor* actor) const;
+    uint32_t GetNextEventTime() const;
+
+    std::vector<wakeUp> m_slots[NumberOfLevels][SlotsPerLevel];
+    size_t m_numberOfScheduledActors;
+    uint32_t m_currentTime;
+};
+
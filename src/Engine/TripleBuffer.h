@@ -0,0 +1,90 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// TripleBuffer
+//
+// Lock-free hand-over of data from one producer thread to one consumer thread. The producer fills the back
+// buffer and publishes it; the consumer takes the most recently published buffer. Neither thread ever waits
+// for the other: a buffer that is published before the consumer took the previous one simply replaces it.
+//
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+template <class T>
+class TripleBuffer
+{
+public:
+    TripleBuffer() :
+        m_writeIndex(0),
+        m_readIndex(1),
+        m_pendingIndex(2)
+    {
+
+    }
+
+    ~TripleBuffer()
+    {
+
+    }
+
+    // Producer only: buffer to fill before calling Publish().
+    T& GetWriteBuffer()
+    {
+        return m_buffers[m_writeIndex];
+    }
+
+    // Producer only: hands over the write buffer and continues with the buffer that was not taken by the consumer.
+    void Publish()
+    {
+        const uint8_t previousIndex = m_pendingIndex.exchange(m_writeIndex | NewDataFlag, std::memory_order_acq_rel);
+        m_writeIndex = previousIndex & IndexMask;
+    }
+
+    // Consumer only: takes the most recently published buffer, if any. Returns true if new data was taken.
+    bool Acquire()
+    {
+        if (!IsNewDataAvailable())
+        {
+            return false;
+        }
+
+        const uint8_t previousIndex = m_pendingIndex.exchange(m_readIndex, std::memory_order_acq_rel);
+        m_readIndex = previousIndex & IndexMask;
+        return true;
+    }
+
+    // Consumer only: returns true if a buffer was published since the last call to Acquire().
+    bool IsNewDataAvailable() const
+    {
+        return (m_pendingIndex.load(std::memory_order_relaxed) & NewDataFlag) != 0;
+    }
+
+    // Consumer only: the buffer that was taken with the last call to Acquire().
+    const T& GetReadBuffer() const
+    {
+        return m_buffers[m_readIndex];
+    }
+
+private:
+    static const uint8_t IndexMask = 0x03;
+    static const uint8_t NewDataFlag = 0x04;
+
+    T m_buffers[3];
+    uint8_t m_writeIndex;
+    uint8_t m_readIndex;
+    std::atomic<uint8_t> m_pendingIndex;
+};
@@ -0,0 +1,133 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "WorldSnapshot.h"
+#include "EgaGraph.h"
+#include "SpriteQueue.h"
+
+WorldSnapshot::WorldSnapshot() :
+    showWorld(false),
+    playerX(0.0f),
+    playerY(0.0f),
+    playerAngle(0.0f),
+    groundColor(EgaBlack),
+    skyColor(EgaBlack),
+    vSync(false),
+    textureFilter(IRenderer::Nearest),
+    depthShading(false),
+    aspectRatio(1.0f),
+    fov(25),
+    showFps(false),
+    engineState(0),
+    victoryState(0),
+    readingScroll(255),
+    difficultyLevel(0),
+    godModeIsOn(false),
+    menuActive(false),
+    timeStampOfPlayer(0),
+    timeStampOfWorld(0),
+    actualTime(0),
+    playerIsDead(false),
+    playerHealth(100),
+    handHeight(0),
+    playerInventory(NULL)
+{
+
+}
+
+WorldSnapshot::~WorldSnapshot()
+{
+
+}
+
+// The containers keep their capacity, such that filling a snapshot does not allocate memory in a steady state.
+void WorldSnapshot::ClearWorld()
+{
+    m_visibleTiles.clear();
+    m_walls.clear();
+    m_sprites.clear();
+}
+
+void WorldSnapshot::AddVisibleTile(const uint16_t tileX, const uint16_t tileY)
+{
+    const snapshotTile tile = { tileX, tileY };
+    m_visibleTiles.push_back(tile);
+}
+
+void WorldSnapshot::AddWall(const uint16_t pictureIndex, const int16_t tileX, const int16_t tileY, const int16_t orientation)
+{
+    const snapshotWall wall = { pictureIndex, tileX, tileY, orientation };
+    m_walls.push_back(wall);
+}
+
+void WorldSnapshot::AddSprite(const uint16_t pictureIndex, const float x, const float y)
+{
+    const snapshotSprite sprite = { pictureIndex, x, y };
+    m_sprites.push_back(sprite);
+}
+
+uint32_t WorldSnapshot::GetNumberOfVisibleTiles() const
+{
+    return (uint32_t)m_visibleTiles.size();
+}
+
+uint32_t WorldSnapshot::GetNumberOfWalls() const
+{
+    return (uint32_t)m_walls.size();
+}
+
+uint32_t WorldSnapshot::GetNumberOfSprites() const
+{
+    return (uint32_t)m_sprites.size();
+}
+
+void WorldSnapshot::DrawWorld(IRenderer& renderer, EgaGraph* egaGraph, SpriteQueue& spriteQueue) const
+{
+    renderer.PrepareFloorAndCeiling();
+    for (const snapshotTile& tile : m_visibleTiles)
+    {
+        renderer.RenderFloor(tile.tileX, tile.tileY, groundColor);
+        renderer.RenderCeiling(tile.tileX, tile.tileY, skyColor);
+    }
+    renderer.UnprepareFloorAndCeiling();
+
+    renderer.PrepareWalls();
+    for (const snapshotWall& wall : m_walls)
+    {
+        renderer.Render3DWall(egaGraph->GetPicture(wall.pictureIndex), wall.tileX, wall.tileY, wall.orientation);
+    }
+    renderer.UnprepareWalls();
+
+    spriteQueue.Reset(playerX, playerY);
+    for (const snapshotSprite& sprite : m_sprites)
+    {
+        Picture* picture = egaGraph->GetPicture(sprite.pictureIndex);
+        if (picture != NULL)
+        {
+            spriteQueue.AddSprite(picture, sprite.x, sprite.y);
+        }
+    }
+    spriteQueue.SortBackToFront();
+    renderer.RenderSprites(spriteQueue);
+}
+
+void WorldSnapshot::DrawVisibilityMap(IRenderer& renderer) const
+{
+    renderer.PrepareVisibilityMap();
+    for (const snapshotTile& tile : m_visibleTiles)
+    {
+        renderer.RenderFloor(tile.tileX, tile.tileY, EgaBrightWhite);
+    }
+    renderer.UnprepareVisibilityMap();
+}
@@ -0,0 +1,117 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// WorldSnapshot
+//
+// Immutable copy of everything that is needed to draw a frame: the player pose, the visible floor tiles and wall faces,
+// the sprites, and the state of the HUD and popups. The snapshot is filled by the simulation and handed over to the
+// renderer, such that drawing a frame does not require access to the level.
+// Pictures are referred to by their index in the EgaGraph, since the textures can only be created by the render thread.
+//
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "IRenderer.h"
+#include "Radar.h"
+#include "PlayerInventory.h"
+
+class EgaGraph;
+class SpriteQueue;
+
+class WorldSnapshot
+{
+public:
+    WorldSnapshot();
+    ~WorldSnapshot();
+
+    void ClearWorld();
+    void AddVisibleTile(const uint16_t tileX, const uint16_t tileY);
+    void AddWall(const uint16_t pictureIndex, const int16_t tileX, const int16_t tileY, const int16_t orientation);
+    void AddSprite(const uint16_t pictureIndex, const float x, const float y);
+
+    uint32_t GetNumberOfVisibleTiles() const;
+    uint32_t GetNumberOfWalls() const;
+    uint32_t GetNumberOfSprites() const;
+
+    void DrawWorld(IRenderer& renderer, EgaGraph* egaGraph, SpriteQueue& spriteQueue) const;
+    void DrawVisibilityMap(IRenderer& renderer) const;
+
+    // View
+    bool showWorld;
+    float playerX;
+    float playerY;
+    float playerAngle;
+    egaColor groundColor;
+    egaColor skyColor;
+
+    // Render settings
+    bool vSync;
+    IRenderer::TextureFilterSetting textureFilter;
+    bool depthShading;
+    float aspectRatio;
+    uint16_t fov;
+    bool showFps;
+
+    // Game state
+    uint8_t engineState;
+    uint8_t victoryState;
+    uint8_t readingScroll;
+    uint8_t difficultyLevel;
+    bool godModeIsOn;
+    bool menuActive;
+    uint32_t timeStampOfPlayer;
+    uint32_t timeStampOfWorld;
+    uint32_t actualTime;
+
+    // HUD and popups
+    bool playerIsDead;
+    int16_t playerHealth;
+    uint16_t handHeight;
+    PlayerInventory playerInventory;
+    Radar radar;
+    std::string locationMessage;
+    std::string statusMessage;
+    std::string messageInPopup;
+    std::string levelName;
+    std::string warpCheatText;
+
+private:
+    typedef struct
+    {
+        uint16_t tileX;
+        uint16_t tileY;
+    } snapshotTile;
+
+    typedef struct
+    {
+        uint16_t pictureIndex;
+        int16_t tileX;
+        int16_t tileY;
+        int16_t orientation;
+    } snapshotWall;
+
+    typedef struct
+    {
+        uint16_t pictureIndex;
+        float x;
+        float y;
+    } snapshotSprite;
+
+    std::vector<snapshotTile> m_visibleTiles;
+    std::vector<snapshotWall> m_walls;
+    std::vector<snapshotSprite> m_sprites;
+};
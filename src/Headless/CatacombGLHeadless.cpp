@@ -0,0 +1,96 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+//
+// CatacombGLHeadless
+//
+// Command line front end of the HeadlessRunner. Starts a game of The Catacomb Abyss, runs in circles while shooting
+// for the given number of minutes of game time and reports how many ticks per second the simulation reached.
+// When a number of render threads is given, each frame is also drawn with the software renderer, which then
+// reports the frame rate as well.
+//
+// Usage: CatacombGL_Headless [folder with the game files] [minutes of game time] [render threads]
+//
+
+#include "HeadlessRunner.h"
+#include "../Test/RendererStub.h"
+#include "../Engine/RendererSoftware.h"
+#include "../Engine/GameDetection.h"
+#include "../Abyss/GameAbyss.h"
+#include "../Abyss/GameDetectionAbyss.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static const uint8_t GameIdCatacombAbyssv113 = 1;
+static const uint8_t GameIdCatacombAbyssv124 = 2;
+
+int main(int argc, char* argv[])
+{
+    std::string folder = (argc > 1) ? argv[1] : ".";
+    if (folder.back() != '/' && folder.back() != '\\')
+    {
+        folder += "/";
+    }
+    const int minutes = (argc > 2) ? atoi(argv[2]) : 10;
+    const int renderThreads = (argc > 3) ? atoi(argv[3]) : 0;
+    if (minutes <= 0 || renderThreads < 0 || renderThreads > 64)
+    {
+        fprintf(stderr, "Usage: %s [folder with the game files] [minutes of game time] [render threads]\n", argv[0]);
+        return 1;
+    }
+
+    GameDetection gameDetection;
+    if (gameDetection.GetDetectionReport(GameIdCatacombAbyssv113, folder, abyssFilesv113).score != 0)
+    {
+        gameDetection.GetDetectionReport(GameIdCatacombAbyssv124, folder, abyssFilesv124);
+    }
+
+    const DetectionReport& report = gameDetection.GetBestMatch();
+    if (report.score != 0)
+    {
+        fprintf(stderr, "Failed to detect the Catacomb Abyss game files in %s: %s\n", folder.c_str(), report.infoString.c_str());
+        return 1;
+    }
+
+    RendererStub rendererStub;
+    RendererSoftware rendererSoftware;
+    IRenderer& renderer = (renderThreads > 0) ? (IRenderer&)rendererSoftware : (IRenderer&)rendererStub;
+    GameAbyss game(report.gameId, report.folder, renderer);
+    HeadlessRunner runner(game);
+    if (renderThreads > 0)
+    {
+        rendererSoftware.SetNumberOfThreads((uint8_t)renderThreads);
+        runner.SetRenderer(rendererSoftware);
+    }
+    runner.GetEngineCore().SetRandomSeedForNewGame(1);
+    runner.AddKeysToStartGame();
+    runner.AddKeysToRunInCircles(3000);
+    if (runner.Run(3000))
+    {
+        fprintf(stderr, "The game exited before it started\n");
+        return 1;
+    }
+
+    // The player may get killed along the way, after which the world is no longer simulated.
+    const uint64_t ticksBeforeRun = runner.GetNumberOfTicks();
+    runner.Run((uint32_t)minutes * 60 * 1000);
+    printf("%llu ticks in %d minutes of game time: %.0f ticks per second\n", (unsigned long long)(runner.GetNumberOfTicks() - ticksBeforeRun), minutes, runner.GetTicksPerSecond());
+    if (renderThreads > 0)
+    {
+        printf("Software renderer with %d threads: %.0f frames per second\n", renderThreads, runner.GetFramesPerSecond());
+    }
+
+    return 0;
+}
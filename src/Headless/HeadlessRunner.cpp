@@ -0,0 +1,153 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+#include "HeadlessRunner.h"
+#include <algorithm>
+#include <chrono>
+
+static const uint8_t KeyEnter = 0x0D;
+static const uint8_t KeyControl = 0x11;
+static const uint8_t KeyLeft = 0x25;
+static const uint8_t KeyUp = 0x26;
+static const uint8_t KeyN = 0x4E;
+
+HeadlessRunner::HeadlessRunner(IGame& game) :
+    m_system(""),
+    m_playerInput(),
+    m_clock(1),
+    m_engineCore(NULL),
+    m_renderer(NULL),
+    m_keyEvents(),
+    m_nextKeyEvent(0),
+    m_numberOfFrames(0),
+    m_ticksInRun(0),
+    m_framesDrawnInRun(0),
+    m_secondsInRun(0.0)
+{
+    // The sound manager is not started, so the audio player must not touch the sound device.
+    game.GetAudioPlayer()->SetOutputEnabled(false);
+    m_engineCore = new EngineCore(game, m_system, m_playerInput);
+    m_engineCore->SetClock(m_clock);
+}
+
+HeadlessRunner::~HeadlessRunner()
+{
+    delete m_engineCore;
+}
+
+void HeadlessRunner::AddKeyEvent(const uint32_t timeStamp, const uint8_t keyCode, const bool pressed)
+{
+    const keyEvent event = { timeStamp, keyCode, pressed };
+    const auto it = std::upper_bound(m_keyEvents.begin() + m_nextKeyEvent, m_keyEvents.end(), event,
+        [](const keyEvent& first, const keyEvent& second) { return first.timeStamp < second.timeStamp; });
+    m_keyEvents.insert(it, event);
+}
+
+// Presses the key long enough for the engine to see it in at least one frame.
+void HeadlessRunner::AddKeyPress(const uint32_t timeStamp, const uint8_t keyCode)
+{
+    AddKeyEvent(timeStamp, keyCode, true);
+    AddKeyEvent(timeStamp + 50, keyCode, false);
+}
+
+// Walks through the introduction screens into the first level as a novice, which takes three seconds.
+void HeadlessRunner::AddKeysToStartGame()
+{
+    AddKeyPress(100, KeyEnter);
+    AddKeyPress(200, KeyN);
+    AddKeyPress(300, KeyEnter);
+    AddKeyPress(400, KeyEnter);
+}
+
+// Runs in circles while shooting from the given time on, such that actors wake up and projectiles fly around.
+void HeadlessRunner::AddKeysToRunInCircles(const uint32_t timeStamp)
+{
+    AddKeyEvent(timeStamp, KeyUp, true);
+    AddKeyEvent(timeStamp, KeyLeft, true);
+    AddKeyEvent(timeStamp, KeyControl, true);
+}
+
+// The renderer must be the one with which the game loaded its pictures.
+void HeadlessRunner::SetRenderer(IRenderer& renderer)
+{
+    m_renderer = &renderer;
+}
+
+// Runs the engine for the given number of milliseconds of virtual time, with one frame per tick of the simulation.
+// Returns true when the game was exited.
+bool HeadlessRunner::Run(const uint32_t duration)
+{
+    const uint64_t ticksAtStart = m_engineCore->GetNumberOfTicks();
+    const uint32_t endTime = m_clock.GetMilliseconds() + duration;
+    bool exitGame = false;
+    m_framesDrawnInRun = 0;
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    while (!exitGame && m_clock.GetMilliseconds() < endTime)
+    {
+        m_numberOfFrames++;
+        m_clock.SetTime(1 + (uint32_t)((uint64_t)m_numberOfFrames * 1000 / FixedTimeStep::TicksPerSecond));
+        ApplyKeyEvents();
+        exitGame = m_engineCore->Think();
+        if (m_renderer != NULL && m_engineCore->IsNewSnapshotAvailable())
+        {
+            m_engineCore->DrawScene(*m_renderer);
+            m_framesDrawnInRun++;
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    m_ticksInRun = m_engineCore->GetNumberOfTicks() - ticksAtStart;
+    m_secondsInRun = std::chrono::duration<double>(end - start).count();
+
+    return exitGame;
+}
+
+void HeadlessRunner::ApplyKeyEvents()
+{
+    while (m_nextKeyEvent < m_keyEvents.size() && m_keyEvents.at(m_nextKeyEvent).timeStamp <= m_clock.GetMilliseconds())
+    {
+        const keyEvent& event = m_keyEvents.at(m_nextKeyEvent);
+        m_playerInput.SetKeyPressed(event.keyCode, event.pressed);
+        m_nextKeyEvent++;
+    }
+}
+
+EngineCore& HeadlessRunner::GetEngineCore()
+{
+    return *m_engineCore;
+}
+
+uint32_t HeadlessRunner::GetTime() const
+{
+    return m_clock.GetMilliseconds();
+}
+
+uint64_t HeadlessRunner::GetNumberOfTicks() const
+{
+    return m_engineCore->GetNumberOfTicks();
+}
+
+// Number of ticks that were simulated per second of real time during the last run.
+double HeadlessRunner::GetTicksPerSecond() const
+{
+    return (m_secondsInRun > 0.0) ? m_ticksInRun / m_secondsInRun : 0.0;
+}
+
+// Number of frames that were drawn per second of real time during the last run, including the simulation.
+double HeadlessRunner::GetFramesPerSecond() const
+{
+    return (m_secondsInRun > 0.0) ? m_framesDrawnInRun / m_secondsInRun : 0.0;
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+//
+// HeadlessRunner
+//
+// Runs the EngineCore without a window, sound or real time: the renderer and system are stubs, the audio output is
+// disabled, the input is scripted and the time comes from a virtual clock that advances one tick per frame. The game
+// is simulated as fast as the CPU allows, which gives a throughput baseline for the simulation. Optionally, each frame
+// is drawn with a given renderer, like the software renderer, to measure the frame rate of that renderer as well.
+//
+#pragma once
+
+#include "../Engine/EngineCore.h"
+#include "../Engine/ClockVirtual.h"
+#include "SystemStub.h"
+#include <vector>
+
+class HeadlessRunner
+{
+public:
+    HeadlessRunner(IGame& game);
+    ~HeadlessRunner();
+
+    void AddKeyEvent(const uint32_t timeStamp, const uint8_t keyCode, const bool pressed);
+    void AddKeyPress(const uint32_t timeStamp, const uint8_t keyCode);
+    void AddKeysToStartGame();
+    void AddKeysToRunInCircles(const uint32_t timeStamp);
+    void SetRenderer(IRenderer& renderer);
+    bool Run(const uint32_t duration);
+
+    EngineCore& GetEngineCore();
+    uint32_t GetTime() const;
+    uint64_t GetNumberOfTicks() const;
+    double GetTicksPerSecond() const;
+    double GetFramesPerSecond() const;
+
+private:
+    typedef struct
+    {
+        uint32_t timeStamp;
+        uint8_t keyCode;
+        bool pressed;
+    } keyEvent;
+
+    void ApplyKeyEvents();
+
+    SystemStub m_system;
+    PlayerInput m_playerInput;
+    ClockVirtual m_clock;
+    EngineCore* m_engineCore;
+    IRenderer* m_renderer;
+    std::vector<keyEvent> m_keyEvents;
+    size_t m_nextKeyEvent;
+    uint32_t m_numberOfFrames;
+    uint64_t m_ticksInRun;
+    uint32_t m_framesDrawnInRun;
+    double m_secondsInRun;
+};
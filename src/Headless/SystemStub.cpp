@@ -0,0 +1,39 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+#include "SystemStub.h"
+
+SystemStub::SystemStub(const std::string& configurationFilePath) :
+    m_configurationFilePath(configurationFilePath)
+{
+}
+
+SystemStub::~SystemStub()
+{
+}
+
+const std::string& SystemStub::GetConfigurationFilePath() const
+{
+    return m_configurationFilePath;
+}
+
+void SystemStub::GetSavedGameNamesFromFolder(const std::string& /*path*/, std::vector<std::string>& /*filesFound*/) const
+{
+}
+
+bool SystemStub::CreatePath(const std::string& /*path*/) const
+{
+    return false;
+}
@@ -0,0 +1,30 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#pragma once
+#include "../Engine/ISystem.h"
+
+class SystemStub: public ISystem
+{
+public:
+    SystemStub(const std::string& configurationFilePath);
+    ~SystemStub();
+
+    virtual const std::string& GetConfigurationFilePath() const override;
+    virtual void GetSavedGameNamesFromFolder(const std::string& path, std::vector<std::string>& filesFound) const override;
+    virtual bool CreatePath(const std::string& path) const override;
+
+private:
+    const std::string m_configurationFilePath;
+};
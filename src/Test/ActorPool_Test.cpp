@@ -0,0 +1,96 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "ActorPool_Test.h"
+#include "../Engine/ActorPool.h"
+#include "../Engine/Actor.h"
+#include "../Abyss/DecorateMisc.h"
+#include <chrono>
+#include <cstddef>
+#include <algorithm>
+
+ActorPool_Test::ActorPool_Test()
+{
+
+}
+
+ActorPool_Test::~ActorPool_Test()
+{
+
+}
+
+TEST(ActorPool_Test, FreedSlotIsReused)
+{
+    ActorPool pool(100, 4);
+    void* slot = pool.Allocate();
+    EXPECT_EQ(4u, pool.GetNumberOfSlots());
+    EXPECT_EQ(3u, pool.GetNumberOfFreeSlots());
+
+    pool.Free(slot);
+    EXPECT_EQ(4u, pool.GetNumberOfFreeSlots());
+    EXPECT_EQ(slot, pool.Allocate());
+}
+
+TEST(ActorPool_Test, GrowsBeyondOneBlock)
+{
+    ActorPool pool(100, 4);
+    std::vector<void*> slots;
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        void* slot = pool.Allocate();
+        EXPECT_EQ(slots.end(), std::find(slots.begin(), slots.end(), slot));
+        slots.push_back(slot);
+    }
+    EXPECT_EQ(12u, pool.GetNumberOfSlots());
+    EXPECT_EQ(2u, pool.GetNumberOfFreeSlots());
+
+    for (void* slot : slots)
+    {
+        pool.Free(slot);
+    }
+    EXPECT_EQ(12u, pool.GetNumberOfFreeSlots());
+}
+
+TEST(ActorPool_Test, SlotsAreAligned)
+{
+    ActorPool pool(3, 8);
+    EXPECT_EQ(0u, pool.GetSlotSize() % alignof(std::max_align_t));
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        EXPECT_EQ(0u, (uintptr_t)pool.Allocate() % alignof(std::max_align_t));
+    }
+}
+
+TEST(ActorPool_Test, DISABLED_BenchmarkSpawnAndRemoveActors)
+{
+    const uint32_t numberOfRounds = 1000;
+    const uint16_t numberOfActors = 200;
+    Actor* actors[numberOfActors];
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (uint32_t round = 0; round < numberOfRounds; round++)
+    {
+        for (uint16_t i = 0; i < numberOfActors; i++)
+        {
+            actors[i] = new Actor(1.5f, 1.5f, round, decoratePlayer);
+        }
+        for (uint16_t i = 0; i < numberOfActors; i++)
+        {
+            delete actors[i];
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    RecordProperty("Microseconds", (int)microseconds);
+}
@@ -0,0 +1,198 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "ActorStore_Test.h"
+#include "../Engine/ActorStore.h"
+#include "../Engine/Actor.h"
+#include "../Engine/Level.h"
+#include <chrono>
+
+ActorStore_Test::ActorStore_Test()
+{
+
+}
+
+ActorStore_Test::~ActorStore_Test()
+{
+
+}
+
+constexpr DecorateAnimationFrame testWalkAnimation[] =
+{
+    { 10, 8, ActionChase },
+    { 11, 8, ActionChase }
+};
+
+constexpr DecorateState testStateWalk =
+{
+    testWalkAnimation,
+    StateIdAttack
+};
+
+constexpr DecorateAnimationFrame testAttackAnimation[] =
+{
+    { 12, 20, ActionAttack }
+};
+
+constexpr DecorateState testStateAttack =
+{
+    testAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateStatePair testStates[] =
+{
+    std::make_pair(StateIdWalk, testStateWalk),
+    std::make_pair(StateIdAttack, testStateAttack)
+};
+
+constexpr DecorateActor decorateTest =
+{
+    1,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard
+    10,  // initialHealth;
+    0.4f,    // size;
+    Always,  // radarVisibility;
+    EgaRed,   // radarColor;
+    testStates,
+    StateIdWalk,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+static const LevelInfo TestLevelInfo = { "Test", EgaBlack, EgaDarkGray, false, false };
+static const std::vector<WallInfo> TestWallsInfo = { { {}, {}, WTOpen } };
+
+TEST(ActorStore_Test, RemovedActorKeepsAnimationState)
+{
+    ActorStore store;
+    Actor actor(1.5f, 1.5f, 0, decorateTest);
+    store.Add(&actor);
+    actor.SetActive(true);
+    actor.SetState(StateIdAttack, 100);
+    actor.SetActionPerformed(true);
+
+    EXPECT_TRUE(store.Remove(&actor));
+    EXPECT_TRUE(actor.IsActive());
+    EXPECT_TRUE(actor.IsActionPerformed());
+    EXPECT_EQ(12u, actor.GetPictureIndex());
+    EXPECT_FALSE(store.Contains(&actor));
+}
+
+TEST(ActorStore_Test, RemoveMovesLastActorIntoSlot)
+{
+    ActorStore store;
+    Actor first(1.5f, 1.5f, 0, decorateTest);
+    Actor last(2.5f, 1.5f, 0, decorateTest);
+    store.Add(&first);
+    store.Add(&last);
+    last.SetState(StateIdAttack, 0);
+
+    store.Remove(&first);
+    ASSERT_EQ(1u, store.GetActors().size());
+    EXPECT_EQ(&last, store.GetActors().at(0));
+    EXPECT_EQ(12u, last.GetPictureIndex());
+    EXPECT_EQ(ActionAttack, last.GetAction());
+}
+
+TEST(ActorStore_Test, BatchedThinkMatchesActorThink)
+{
+    ActorStore store;
+    Actor storedActor(1.5f, 1.5f, 0, decorateTest);
+    Actor actor(1.5f, 1.5f, 0, decorateTest);
+    store.Add(&storedActor);
+
+    for (uint32_t timestamp = 0; timestamp < 2000; timestamp += 16)
+    {
+        store.Think(timestamp, false);
+        actor.Think(timestamp);
+        ASSERT_EQ(actor.GetPictureIndex(), storedActor.GetPictureIndex());
+        ASSERT_EQ(actor.IsActionPerformed(), storedActor.IsActionPerformed());
+        actor.SetActionPerformed(true);
+        storedActor.SetActionPerformed(true);
+    }
+    store.Remove(&storedActor);
+}
+
+TEST(ActorStore_Test, ThinkOnlyActiveActors)
+{
+    ActorStore store;
+    Actor activeActor(1.5f, 1.5f, 0, decorateTest);
+    Actor inactiveActor(2.5f, 1.5f, 0, decorateTest);
+    store.Add(&activeActor);
+    store.Add(&inactiveActor);
+    activeActor.SetActive(true);
+
+    store.Think(1000, true);
+    EXPECT_EQ(11u, activeActor.GetPictureIndex());
+    EXPECT_EQ(10u, inactiveActor.GetPictureIndex());
+    store.Remove(&activeActor);
+    store.Remove(&inactiveActor);
+}
+
+TEST(ActorStore_Test, DISABLED_BenchmarkAnimateActors)
+{
+    const uint16_t mapWidth = 128;
+    const uint16_t mapHeight = 128;
+    const uint32_t numberOfFrames = 200;
+    std::vector<uint16_t> plane(mapWidth * mapHeight, 0);
+
+    for (uint32_t numberOfActors = 100; numberOfActors <= 10000; numberOfActors *= 10)
+    {
+        // Reference: individual actors that each think by themselves
+        std::vector<Actor*> actors;
+        for (uint32_t i = 0; i < numberOfActors; i++)
+        {
+            actors.push_back(new Actor((i % mapWidth) + 0.5f, (i / mapWidth) + 0.5f, i, decorateTest));
+        }
+        const auto actorStart = std::chrono::high_resolution_clock::now();
+        for (uint32_t frame = 0; frame < numberOfFrames; frame++)
+        {
+            for (Actor* actor : actors)
+            {
+                actor->Think(frame * 16);
+            }
+        }
+        const auto actorEnd = std::chrono::high_resolution_clock::now();
+        for (Actor* actor : actors)
+        {
+            delete actor;
+        }
+
+        // Same actors in a level, animated in one batch
+        Level level(0, mapWidth, mapHeight, plane.data(), plane.data(), TestLevelInfo, TestWallsInfo);
+        for (uint32_t i = 0; i < numberOfActors; i++)
+        {
+            Actor* actor = new Actor((i % mapWidth) + 0.5f, (i / mapWidth) + 0.5f, i, decorateTest);
+            actor->SetActive(true);
+            level.SetBlockingActor(actor->GetTileX(), actor->GetTileY(), actor);
+        }
+        const auto storeStart = std::chrono::high_resolution_clock::now();
+        for (uint32_t frame = 0; frame < numberOfFrames; frame++)
+        {
+            level.AnimateBlockingActors(frame * 16);
+        }
+        const auto storeEnd = std::chrono::high_resolution_clock::now();
+
+        const long long actorNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(actorEnd - actorStart).count();
+        const long long storeNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(storeEnd - storeStart).count();
+        RecordProperty("ThinkNanosecondsPerFrame" + std::to_string(numberOfActors), (int)(actorNanoseconds / numberOfFrames));
+        RecordProperty("BatchedNanosecondsPerFrame" + std::to_string(numberOfActors), (int)(storeNanoseconds / numberOfFrames));
+    }
+}
@@ -0,0 +1,217 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "DecorateFrameTable_Test.h"
+#include "../Engine/DecorateFrameTable.h"
+#include "../Engine/Actor.h"
+#include <chrono>
+
+DecorateFrameTable_Test::DecorateFrameTable_Test()
+{
+
+}
+
+DecorateFrameTable_Test::~DecorateFrameTable_Test()
+{
+
+}
+
+constexpr DecorateAnimationFrame testWalkAnimation[] =
+{
+    { 10, 8, ActionChase },
+    { 11, 8, ActionChase }
+};
+
+constexpr DecorateState testStateWalk =
+{
+    testWalkAnimation,
+    StateIdAttack
+};
+
+constexpr DecorateAnimationFrame testAttackAnimation[] =
+{
+    { 12, 20, ActionAttack }
+};
+
+constexpr DecorateState testStateAttack =
+{
+    testAttackAnimation,
+    StateIdWalk
+};
+
+constexpr DecorateAnimationFrame testDyingAnimation[] =
+{
+    { 13, 10, ActionNone },
+    { 14, 10, ActionNone }
+};
+
+constexpr DecorateState testStateDying =
+{
+    testDyingAnimation,
+    StateIdDead
+};
+
+constexpr DecorateStatePair testStates[] =
+{
+    std::make_pair(StateIdWalk, testStateWalk),
+    std::make_pair(StateIdAttack, testStateAttack),
+    std::make_pair(StateIdDying, testStateDying)
+};
+
+constexpr DecorateActor decorateTest =
+{
+    1,   // Id
+    0, // spawnOnAllDifficulties;
+    0, // spawnOnNormalAndHard;
+    0,  // spawnOnHard
+    10,  // initialHealth;
+    0.4f,    // size;
+    Always,  // radarVisibility;
+    EgaRed,   // radarColor;
+    testStates,
+    StateIdWalk,   // initialState;
+    0,  // meleeDamage;
+    0, // hitSound;
+    0,    // speed;
+    0, // actionParameter
+    0 // ProjectileId
+};
+
+static const uint16_t NoFrame = DecorateFrameTable::NoFrame;
+
+TEST(DecorateFrameTable_Test, FramesAreLinkedAcrossStates)
+{
+    const DecorateFrameTable table(decorateTest);
+    ASSERT_EQ(5u, table.GetNumberOfFrames());
+    EXPECT_TRUE(table.HasState(StateIdWalk));
+    EXPECT_TRUE(table.HasState(StateIdAttack));
+    EXPECT_FALSE(table.HasState(StateIdPain));
+
+    const uint16_t walk = table.GetFirstFrameIndex(StateIdWalk);
+    const uint16_t attack = table.GetFirstFrameIndex(StateIdAttack);
+    EXPECT_EQ(10u, table.GetFrame(walk).pictureIndex);
+    EXPECT_EQ(StateIdWalk, table.GetFrame(walk).stateId);
+    EXPECT_EQ(walk + 1, table.GetFrame(walk).nextFrameIndex);
+    EXPECT_EQ(11u, table.GetFrame(walk + 1).pictureIndex);
+    EXPECT_EQ(attack, table.GetFrame(walk + 1).nextFrameIndex);
+    EXPECT_EQ(ActionAttack, table.GetFrame(attack).action);
+    EXPECT_EQ(20u, table.GetFrame(attack).durationInTics);
+    EXPECT_EQ(walk, table.GetFrame(attack).nextFrameIndex);
+    EXPECT_EQ(NoFrame, table.GetFirstFrameIndex(StateIdPain));
+}
+
+TEST(DecorateFrameTable_Test, MissingNextStateRepeatsState)
+{
+    // The dying state is followed by the dead state, which is not defined
+    const DecorateFrameTable table(decorateTest);
+    const uint16_t dying = table.GetFirstFrameIndex(StateIdDying);
+    EXPECT_EQ(dying, table.GetFrame(dying + 1).nextFrameIndex);
+}
+
+TEST(DecorateFrameTable_Test, GetReturnsSameTable)
+{
+    const DecorateFrameTable& table = DecorateFrameTable::Get(decorateTest);
+    EXPECT_EQ(&table, &DecorateFrameTable::Get(decorateTest));
+}
+
+TEST(DecorateFrameTable_Test, ActorFollowsFrames)
+{
+    Actor actor(1.5f, 1.5f, 0, decorateTest);
+    EXPECT_EQ(10u, actor.GetPictureIndex());
+    EXPECT_EQ(ActionChase, actor.GetAction());
+
+    // 8 tics take 133 ms; the frame only advances once more tics have passed
+    actor.Think(100);
+    EXPECT_EQ(10u, actor.GetPictureIndex());
+    actor.Think(150);
+    EXPECT_EQ(11u, actor.GetPictureIndex());
+    actor.Think(300);
+    EXPECT_EQ(12u, actor.GetPictureIndex());
+    EXPECT_EQ(ActionAttack, actor.GetAction());
+    actor.Think(700);
+    EXPECT_EQ(10u, actor.GetPictureIndex());
+
+    actor.SetState(StateIdDying, 700);
+    EXPECT_EQ(13u, actor.GetPictureIndex());
+    actor.SetState(StateIdPain, 700);
+    EXPECT_EQ(13u, actor.GetPictureIndex());
+}
+
+TEST(DecorateFrameTable_Test, DISABLED_BenchmarkThink10000Actors)
+{
+    const uint32_t numberOfActors = 10000;
+    const uint32_t numberOfFrames = 100;
+    std::vector<Actor*> actors;
+    for (uint32_t i = 0; i < numberOfActors; i++)
+    {
+        actors.push_back(new Actor(1.5f, 1.5f, 0, decorateTest));
+    }
+
+    // Think, picture and action through a map of states, as done before the frame tables
+    const std::map<DecorateStateId, DecorateState> states(decorateTest.states.begin(), decorateTest.states.end());
+    typedef struct
+    {
+        DecorateStateId stateId;
+        uint16_t animationFrame;
+        uint32_t timestamp;
+    } mapActor;
+    std::vector<mapActor> mapActors(numberOfActors, { StateIdWalk, 0, 0 });
+    uint32_t pictureSum = 0;
+    const auto mapStartTime = std::chrono::high_resolution_clock::now();
+    for (uint32_t frame = 0; frame < numberOfFrames; frame++)
+    {
+        const uint32_t timestamp = frame * 100;
+        for (mapActor& actor : mapActors)
+        {
+            const uint16_t deltaTicks = (uint16_t)(((timestamp - actor.timestamp) * 60) / 1000);
+            const DecorateState& currentState = states.find(actor.stateId)->second;
+            if (deltaTicks > currentState.animation[actor.animationFrame].durationInTics)
+            {
+                actor.animationFrame++;
+                actor.timestamp = timestamp;
+                if (currentState.animation.size() <= actor.animationFrame)
+                {
+                    actor.stateId = currentState.nextState;
+                    actor.animationFrame = 0;
+                }
+            }
+            pictureSum += states.find(actor.stateId)->second.animation[actor.animationFrame].pictureIndex;
+            pictureSum += states.find(actor.stateId)->second.animation[actor.animationFrame].action;
+        }
+    }
+    const auto mapEndTime = std::chrono::high_resolution_clock::now();
+
+    const auto tableStartTime = std::chrono::high_resolution_clock::now();
+    for (uint32_t frame = 0; frame < numberOfFrames; frame++)
+    {
+        for (Actor* actor : actors)
+        {
+            actor->Think(frame * 100);
+            pictureSum += actor->GetPictureIndex();
+            pictureSum += actor->GetAction();
+        }
+    }
+    const auto tableEndTime = std::chrono::high_resolution_clock::now();
+
+    EXPECT_GT(pictureSum, 0u);
+    for (Actor* actor : actors)
+    {
+        delete actor;
+    }
+
+    const long long mapNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(mapEndTime - mapStartTime).count();
+    const long long tableNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(tableEndTime - tableStartTime).count();
+    RecordProperty("StateMapNanosecondsPerActor", (int)(mapNanoseconds / (numberOfActors * numberOfFrames)));
+    RecordProperty("FrameTableNanosecondsPerActor", (int)(tableNanoseconds / (numberOfActors * numberOfFrames)));
+}
@@ -0,0 +1,167 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "Demo_Test.h"
+#include "../Engine/Demo.h"
+#include <cstdio>
+
+static const uint8_t KeyUp = 0x26;
+
+Demo_Test::Demo_Test()
+{
+
+}
+
+Demo_Test::~Demo_Test()
+{
+
+}
+
+TEST(Demo_Test, FramesAreReadBackAsRecorded)
+{
+    Demo demo;
+    Demo::demoInput input;
+    Demo::InitInput(input);
+    demo.AddFrame(14, input);
+    input.keysPressed[KeyUp] = true;
+    input.keysJustPressed[KeyUp] = true;
+    demo.AddFrame(15, input);
+    input.keysJustPressed[KeyUp] = false;
+    input.buttonsPressed = 1;
+    input.mouseX = -12;
+    input.mouseY = 3;
+    demo.AddFrame(0, input);
+    input.keysPressed[KeyUp] = false;
+    input.hasFocus = false;
+    demo.AddFrame(100000, input);
+    EXPECT_EQ(4u, demo.GetNumberOfFrames());
+
+    size_t position = 0;
+    uint32_t timeDelta = 0;
+    Demo::demoInput readInput;
+    Demo::InitInput(readInput);
+    EXPECT_TRUE(demo.ReadFrame(position, timeDelta, readInput));
+    EXPECT_EQ(14u, timeDelta);
+    EXPECT_FALSE(readInput.keysPressed.any());
+    EXPECT_TRUE(demo.ReadFrame(position, timeDelta, readInput));
+    EXPECT_EQ(15u, timeDelta);
+    EXPECT_TRUE(readInput.keysPressed[KeyUp]);
+    EXPECT_TRUE(readInput.keysJustPressed[KeyUp]);
+    EXPECT_TRUE(demo.ReadFrame(position, timeDelta, readInput));
+    EXPECT_EQ(0u, timeDelta);
+    EXPECT_TRUE(readInput.keysPressed[KeyUp]);
+    EXPECT_FALSE(readInput.keysJustPressed[KeyUp]);
+    EXPECT_EQ(1u, readInput.buttonsPressed);
+    EXPECT_EQ(-12, readInput.mouseX);
+    EXPECT_EQ(3, readInput.mouseY);
+    EXPECT_TRUE(demo.ReadFrame(position, timeDelta, readInput));
+    EXPECT_EQ(100000u, timeDelta);
+    EXPECT_FALSE(readInput.keysPressed[KeyUp]);
+    EXPECT_FALSE(readInput.hasFocus);
+    EXPECT_FALSE(demo.ReadFrame(position, timeDelta, readInput));
+}
+
+TEST(Demo_Test, UnchangedInputTakesOneBytePerFrame)
+{
+    Demo demo;
+    Demo::demoInput input;
+    Demo::InitInput(input);
+    input.keysPressed[KeyUp] = true;
+    demo.AddFrame(14, input);
+    const size_t sizeAfterFirstFrame = demo.GetSize();
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        demo.AddFrame(14, input);
+    }
+    EXPECT_EQ(sizeAfterFirstFrame + 1000u, demo.GetSize());
+}
+
+TEST(Demo_Test, StoreAndLoadFile)
+{
+    Demo demo;
+    Demo::demoStart start = demo.GetStart();
+    start.gameId = 5;
+    start.randomSeed = 0x0123456789abcdefull;
+    start.mapIndex = 3;
+    start.health = 42;
+    start.timeToEnterLevel = 2000;
+    start.inventory = std::string("\0\1\2", 3);
+    demo.SetStart(start);
+    Demo::demoInput input;
+    Demo::InitInput(input);
+    input.mouseX = 7;
+    demo.AddFrame(16, input);
+    demo.SetChecksum(0xfedcba9876543210ull);
+
+    const std::string filename = "Demo_Test.dem";
+    EXPECT_TRUE(demo.StoreToFile(filename));
+    Demo loadedDemo;
+    EXPECT_TRUE(loadedDemo.LoadFromFile(filename));
+    std::remove(filename.c_str());
+
+    EXPECT_EQ(5u, loadedDemo.GetStart().gameId);
+    EXPECT_EQ(0x0123456789abcdefull, loadedDemo.GetStart().randomSeed);
+    EXPECT_EQ(3u, loadedDemo.GetStart().mapIndex);
+    EXPECT_EQ(42, loadedDemo.GetStart().health);
+    EXPECT_EQ(2000u, loadedDemo.GetStart().timeToEnterLevel);
+    EXPECT_EQ(start.inventory, loadedDemo.GetStart().inventory);
+    EXPECT_EQ(0xfedcba9876543210ull, loadedDemo.GetChecksum());
+    EXPECT_EQ(1u, loadedDemo.GetNumberOfFrames());
+
+    size_t position = 0;
+    uint32_t timeDelta = 0;
+    Demo::demoInput readInput;
+    Demo::InitInput(readInput);
+    EXPECT_TRUE(loadedDemo.ReadFrame(position, timeDelta, readInput));
+    EXPECT_EQ(16u, timeDelta);
+    EXPECT_EQ(7, readInput.mouseX);
+}
+
+TEST(Demo_Test, LoadFileWithoutDemoHeaderFails)
+{
+    const std::string filename = "Demo_Test.dem";
+    std::ofstream file(filename, std::ofstream::binary);
+    file << "CATACOMBGL";
+    file.close();
+    Demo demo;
+    EXPECT_FALSE(demo.LoadFromFile(filename));
+    std::remove(filename.c_str());
+}
+
+TEST(Demo_Test, CapturedInputIsAppliedToPlayerInput)
+{
+    PlayerInput recordedInput;
+    recordedInput.SetKeyPressed('W', true);
+    recordedInput.SetMouseButtonPressed(0, true);
+    recordedInput.SetMouseXPos(-20);
+    recordedInput.SetMouseYPos(8);
+    Demo::demoInput input;
+    Demo::InitInput(input);
+    Demo::CaptureInput(recordedInput, input);
+
+    PlayerInput playedInput;
+    Demo::ApplyInput(input, playedInput);
+    EXPECT_EQ(recordedInput.IsKeyPressed(SDLK_w), playedInput.IsKeyPressed(SDLK_w));
+    EXPECT_EQ(recordedInput.IsKeyJustPressed(SDLK_w), playedInput.IsKeyJustPressed(SDLK_w));
+    EXPECT_TRUE(playedInput.IsKeyPressed(SDLK_w));
+    EXPECT_TRUE(playedInput.IsMouseButtonPressed(0));
+    EXPECT_EQ(-20, playedInput.GetMouseXPos());
+    EXPECT_EQ(8, playedInput.GetMouseYPos());
+
+    recordedInput.ClearJustPressed();
+    recordedInput.SetKeyPressed('W', false);
+    Demo::CaptureInput(recordedInput, input);
+    Demo::ApplyInput(input, playedInput);
+    EXPECT_FALSE(playedInput.IsKeyPressed(SDLK_w));
+}
@@ -0,0 +1,113 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "FixedTimeStep_Test.h"
+#include "../Engine/FixedTimeStep.h"
+
+FixedTimeStep_Test::FixedTimeStep_Test()
+{
+
+}
+
+FixedTimeStep_Test::~FixedTimeStep_Test()
+{
+
+}
+
+static uint32_t RunTicks(FixedTimeStep& fixedTimeStep, const uint32_t timeStamp)
+{
+    fixedTimeStep.SetTime(timeStamp);
+    uint32_t ticks = 0;
+    while (fixedTimeStep.RunNextTick())
+    {
+        ticks++;
+    }
+    return ticks;
+}
+
+TEST(FixedTimeStep_Test, NoTicksOnFirstFrame)
+{
+    FixedTimeStep fixedTimeStep;
+    EXPECT_EQ(0u, RunTicks(fixedTimeStep, 5000));
+    EXPECT_EQ(350u, fixedTimeStep.GetTick());
+}
+
+TEST(FixedTimeStep_Test, SeventyTicksPerSecond)
+{
+    FixedTimeStep fixedTimeStep;
+    RunTicks(fixedTimeStep, 0);
+
+    // The number of ticks does not depend on the frame rate.
+    uint32_t ticksAt60Fps = 0;
+    for (uint32_t frame = 1; frame <= 60; frame++)
+    {
+        ticksAt60Fps += RunTicks(fixedTimeStep, frame * 1000 / 60);
+    }
+    EXPECT_EQ(70u, ticksAt60Fps);
+
+    uint32_t ticksAt250Fps = 0;
+    for (uint32_t frame = 1; frame <= 250; frame++)
+    {
+        ticksAt250Fps += RunTicks(fixedTimeStep, 1000 + (frame * 4));
+    }
+    EXPECT_EQ(70u, ticksAt250Fps);
+}
+
+TEST(FixedTimeStep_Test, MultipleTicksPerSlowFrame)
+{
+    FixedTimeStep fixedTimeStep;
+    RunTicks(fixedTimeStep, 0);
+    EXPECT_EQ(7u, RunTicks(fixedTimeStep, 100));
+    EXPECT_EQ(10u, RunTicks(fixedTimeStep, 2000));
+    EXPECT_EQ(140u, fixedTimeStep.GetTick());
+}
+
+TEST(FixedTimeStep_Test, TimeStampOfTick)
+{
+    FixedTimeStep fixedTimeStep;
+    RunTicks(fixedTimeStep, 0);
+    fixedTimeStep.SetTime(30);
+    EXPECT_TRUE(fixedTimeStep.RunNextTick());
+    EXPECT_EQ(15u, fixedTimeStep.GetTimeStampOfTick());
+    EXPECT_TRUE(fixedTimeStep.RunNextTick());
+    EXPECT_EQ(29u, fixedTimeStep.GetTimeStampOfTick());
+    EXPECT_FALSE(fixedTimeStep.RunNextTick());
+}
+
+TEST(FixedTimeStep_Test, InterpolationBetweenTicks)
+{
+    FixedTimeStep fixedTimeStep;
+    RunTicks(fixedTimeStep, 0);
+    EXPECT_FLOAT_EQ(0.0f, fixedTimeStep.GetInterpolation());
+
+    // Part way the first tick
+    RunTicks(fixedTimeStep, 5);
+    EXPECT_EQ(0u, fixedTimeStep.GetTick());
+    EXPECT_FLOAT_EQ(0.35f, fixedTimeStep.GetInterpolation());
+
+    RunTicks(fixedTimeStep, 20);
+    EXPECT_EQ(1u, fixedTimeStep.GetTick());
+    EXPECT_FLOAT_EQ(0.4f, fixedTimeStep.GetInterpolation());
+}
+
+TEST(FixedTimeStep_Test, RestartsWhenTimeGoesBack)
+{
+    FixedTimeStep fixedTimeStep;
+    RunTicks(fixedTimeStep, 10000);
+    EXPECT_EQ(0u, RunTicks(fixedTimeStep, 1000));
+    EXPECT_EQ(70u, fixedTimeStep.GetTick());
+
+    fixedTimeStep.Reset();
+    EXPECT_EQ(0u, RunTicks(fixedTimeStep, 5000));
+}
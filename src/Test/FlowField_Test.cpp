@@ -0,0 +1,150 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "FlowField_Test.h"
+#include "../Engine/FlowField.h"
+#include "../Engine/Level.h"
+#include "../Abyss/DecorateMisc.h"
+
+FlowField_Test::FlowField_Test()
+{
+
+}
+
+FlowField_Test::~FlowField_Test()
+{
+
+}
+
+static const LevelInfo TestLevelInfo = { "Test", EgaBlack, EgaDarkGray, false, false };
+static const std::vector<WallInfo> TestWallsInfo = { { {}, {}, WTOpen }, { {}, {}, WTSolid } };
+static const uint16_t Unreachable = FlowField::Unreachable;
+
+// Creates a level from a map in which '#' is a solid wall.
+static Level* CreateLevel(const char* map, const uint16_t width, const uint16_t height)
+{
+    std::vector<uint16_t> plane0(width * height);
+    std::vector<uint16_t> plane2(width * height, 0);
+    for (uint16_t i = 0; i < width * height; i++)
+    {
+        plane0[i] = (map[i] == '#') ? 1 : 0;
+    }
+
+    return new Level(0, width, height, plane0.data(), plane2.data(), TestLevelInfo, TestWallsInfo);
+}
+
+TEST(FlowField_Test, DistancesInOpenLevel)
+{
+    const char* map =
+        "#####"
+        "#...#"
+        "#...#"
+        "#...#"
+        "#####";
+    Level* level = CreateLevel(map, 5, 5);
+    FlowField flowField(5, 5);
+    flowField.Compute(*level, 1, 1, 0);
+
+    EXPECT_EQ(0u, flowField.GetDistance(1, 1));
+    EXPECT_EQ(1u, flowField.GetDistance(2, 1));
+    EXPECT_EQ(2u, flowField.GetDistance(2, 2));
+    EXPECT_EQ(4u, flowField.GetDistance(3, 3));
+    EXPECT_EQ(Unreachable, flowField.GetDistance(0, 0));
+    EXPECT_EQ(Unreachable, flowField.GetDistance(-1, 2));
+    EXPECT_EQ(Unreachable, flowField.GetDistance(2, 5));
+    delete level;
+}
+
+TEST(FlowField_Test, DistancesAroundWall)
+{
+    const char* map =
+        "#######"
+        "#.....#"
+        "####..#"
+        "#.....#"
+        "#######";
+    Level* level = CreateLevel(map, 7, 5);
+    FlowField flowField(7, 5);
+    flowField.Compute(*level, 1, 1, 0);
+
+    // The tile below the target can only be reached by walking around the wall
+    EXPECT_EQ(Unreachable, flowField.GetDistance(1, 2));
+    EXPECT_EQ(5u, flowField.GetDistance(4, 3));
+    EXPECT_EQ(8u, flowField.GetDistance(1, 3));
+    delete level;
+}
+
+TEST(FlowField_Test, TargetInsideWall)
+{
+    const char* map =
+        "###"
+        "#.#"
+        "###";
+    Level* level = CreateLevel(map, 3, 3);
+    FlowField flowField(3, 3);
+    flowField.Compute(*level, 0, 0, 0);
+
+    EXPECT_EQ(Unreachable, flowField.GetDistance(1, 1));
+    delete level;
+}
+
+TEST(FlowField_Test, IsComputedFor)
+{
+    const char* map =
+        "###"
+        "#.#"
+        "###";
+    Level* level = CreateLevel(map, 3, 3);
+    FlowField flowField(3, 3);
+    EXPECT_FALSE(flowField.IsComputedFor(0, 0, 0));
+
+    flowField.Compute(*level, 1, 1, 7);
+    EXPECT_TRUE(flowField.IsComputedFor(1, 1, 7));
+    EXPECT_FALSE(flowField.IsComputedFor(1, 1, 8));
+    EXPECT_FALSE(flowField.IsComputedFor(1, 0, 7));
+    delete level;
+}
+
+TEST(FlowField_Test, ChasePlayerAroundWall)
+{
+    // The player is straight below the actor, but behind a wall. The greedy chase would walk south into the wall.
+    const char* map =
+        "#######"
+        "#..A..#"
+        "###.###"
+        "#.#.#.#"
+        "#.....#"
+        "#######";
+    Level* level = CreateLevel(map, 7, 6);
+    level->GetPlayerActor()->SetX(1.5f);
+    level->GetPlayerActor()->SetY(3.5f);
+    Actor actor(3.5f, 1.5f, 0, decoratePlayer);
+    actor.SetDirection(west);
+    Random random(0, RandomStreamAi);
+
+    level->ChaseThink(&actor, false, ChasePlayer, random);
+    EXPECT_EQ(south, actor.GetDirection());
+    EXPECT_EQ(3u, actor.GetTileX());
+    EXPECT_EQ(2u, actor.GetTileY());
+
+    // Opening a wall must update the path
+    level->ChaseThink(&actor, false, ChasePlayer, random);
+    EXPECT_EQ(3u, actor.GetTileY());
+    level->SetWallTile(2, 3, 0);
+    level->ChaseThink(&actor, false, ChasePlayer, random);
+    EXPECT_EQ(west, actor.GetDirection());
+    EXPECT_EQ(2u, actor.GetTileX());
+    EXPECT_EQ(3u, actor.GetTileY());
+    delete level;
+}
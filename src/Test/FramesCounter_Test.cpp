@@ -14,7 +14,7 @@
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
 
 #include "FramesCounter_Test.h"
-#include "..\Engine\FramesCounter.h"
+#include "../Engine/FramesCounter.h"
 
 FramesCounter_Test::FramesCounter_Test()
 {
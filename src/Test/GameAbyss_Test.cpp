@@ -14,7 +14,7 @@
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
 
 #include "GameAbyss_Test.h"
-#include "..\Abyss\GameAbyss.h"
+#include "../Abyss/GameAbyss.h"
 #include "RendererStub.h"
 
 GameAbyss_Test::GameAbyss_Test()
@@ -30,7 +30,7 @@ GameAbyss_Test::~GameAbyss_Test()
 TEST(GameAbyss_Test, CheckGetDecorateActors)
 {
     RendererStub renderer;
-    GameAbyss gameAbyss(0, ".\\", renderer);
+    GameAbyss gameAbyss(0, "./", renderer);
     auto decorateActors = gameAbyss.GetDecorateActors();
     ASSERT_GT(decorateActors.size(), 0u);
 
@@ -44,7 +44,7 @@ TEST(GameAbyss_Test, CheckGetDecorateActors)
         ASSERT_GT(decorateActorPair.second.states.size(), 0u);
 
         // Initial state must be present in states list
-        EXPECT_NE(decorateActorPair.second.states.end(), decorateActorPair.second.states.find(decorateActorPair.second.initialState));
+        EXPECT_TRUE(DecorateHasState(decorateActorPair.second, decorateActorPair.second.initialState));
 
         // Check each state
         for (auto decorateStatePair : decorateActorPair.second.states)
@@ -53,7 +53,7 @@ TEST(GameAbyss_Test, CheckGetDecorateActors)
             EXPECT_GE(decorateStatePair.second.animation.size(), 0u);
 
             // The next state must be present in states list
-            EXPECT_NE(decorateActorPair.second.states.end(), decorateActorPair.second.states.find(decorateStatePair.second.nextState));
+            EXPECT_TRUE(DecorateHasState(decorateActorPair.second, decorateStatePair.second.nextState));
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,153 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+#include "GameTimer_Test.h"
+#include "../Engine/GameTimer.h"
+#include "../Engine/ClockVirtual.h"
+#include "../Engine/ClockScaled.h"
+#include <chrono>
+
+GameTimer_Test::GameTimer_Test()
+{
+
+}
+
+GameTimer_Test::~GameTimer_Test()
+{
+
+}
+
+TEST(GameTimer_Test, FollowsVirtualClock)
+{
+    ClockVirtual clock(5000);
+    GameTimer gameTimer(clock);
+    gameTimer.Reset();
+    EXPECT_EQ(0u, gameTimer.GetMillisecondsForPlayer());
+
+    clock.Advance(1400);
+    EXPECT_EQ(1400u, gameTimer.GetMillisecondsForPlayer());
+    EXPECT_EQ(100u, gameTimer.GetTicksForPlayer());
+    EXPECT_EQ(1400u, gameTimer.GetMilliSecondsForWorld());
+    EXPECT_EQ(6400u, gameTimer.GetActualTime());
+}
+
+TEST(GameTimer_Test, PausedTimeIsSkipped)
+{
+    ClockVirtual clock;
+    GameTimer gameTimer(clock);
+    gameTimer.Reset();
+    clock.Advance(1000);
+    gameTimer.Pause();
+    clock.Advance(60000);
+    EXPECT_TRUE(gameTimer.IsPaused());
+    EXPECT_EQ(1000u, gameTimer.GetMillisecondsForPlayer());
+
+    gameTimer.Resume();
+    clock.Advance(500);
+    EXPECT_EQ(1500u, gameTimer.GetMillisecondsForPlayer());
+}
+
+TEST(GameTimer_Test, WorldStandsStillWhileTimeIsFrozen)
+{
+    ClockVirtual clock;
+    GameTimer gameTimer(clock);
+    gameTimer.Reset();
+    clock.Advance(2000);
+    gameTimer.FreezeTime();
+    clock.Advance(20000);
+    EXPECT_EQ(2000u, gameTimer.GetMilliSecondsForWorld());
+    EXPECT_EQ(30000u, gameTimer.GetRemainingFreezeTime());
+
+    clock.Advance(30000);
+    EXPECT_EQ(0u, gameTimer.GetRemainingFreezeTime());
+    EXPECT_EQ(2000u, gameTimer.GetMilliSecondsForWorld());
+    clock.Advance(1000);
+    EXPECT_EQ(3000u, gameTimer.GetMilliSecondsForWorld());
+}
+
+TEST(GameTimer_Test, ContinuesAfterStoreAndLoad)
+{
+    ClockVirtual clock;
+    GameTimer gameTimer(clock);
+    gameTimer.Reset();
+    clock.Advance(3000);
+    gameTimer.FreezeTime();
+    clock.Advance(1000);
+
+    const std::string filename = "GameTimer_Test.sav";
+    std::ofstream outputFile(filename, std::ofstream::binary);
+    gameTimer.StoreToFile(outputFile);
+    outputFile.close();
+
+    ClockVirtual otherClock(123456);
+    GameTimer loadedGameTimer(otherClock);
+    std::ifstream inputFile(filename, std::ifstream::binary);
+    EXPECT_TRUE(loadedGameTimer.LoadFromFile(inputFile));
+    inputFile.close();
+    std::remove(filename.c_str());
+
+    EXPECT_EQ(4000u, loadedGameTimer.GetMillisecondsForPlayer());
+    EXPECT_EQ(3000u, loadedGameTimer.GetMilliSecondsForWorld());
+    EXPECT_EQ(49000u, loadedGameTimer.GetRemainingFreezeTime());
+}
+
+TEST(GameTimer_Test, ScaledClockRunsFasterAndSlower)
+{
+    ClockVirtual clock(1000);
+    ClockScaled scaledClock(clock, 16.0f);
+    GameTimer gameTimer(scaledClock);
+    gameTimer.Reset();
+    clock.Advance(1000);
+    EXPECT_EQ(16000u, gameTimer.GetMillisecondsForPlayer());
+
+    scaledClock.SetScale(0.25f);
+    EXPECT_EQ(16000u, gameTimer.GetMillisecondsForPlayer());
+    clock.Advance(1000);
+    EXPECT_EQ(16250u, gameTimer.GetMillisecondsForPlayer());
+}
+
+TEST(GameTimer_Test, SwitchingClockKeepsTime)
+{
+    ClockVirtual clock(100);
+    GameTimer gameTimer(clock);
+    gameTimer.Reset();
+    clock.Advance(700);
+
+    ClockVirtual otherClock(90000);
+    gameTimer.SetClock(otherClock);
+    EXPECT_EQ(700u, gameTimer.GetMillisecondsForPlayer());
+    otherClock.Advance(300);
+    clock.Advance(5000);
+    EXPECT_EQ(1000u, gameTimer.GetMillisecondsForPlayer());
+}
+
+TEST(GameTimer_Test, DISABLED_BenchmarkHourOfFrames)
+{
+    // With a virtual clock, an hour of frames at 60 Hz passes as fast as the frames can be computed.
+    ClockVirtual clock;
+    GameTimer gameTimer(clock);
+    gameTimer.Reset();
+    const auto start = std::chrono::high_resolution_clock::now();
+    uint32_t lastWorldTime = 0;
+    for (uint32_t frame = 0; frame < 3600u * 60u; frame++)
+    {
+        clock.Advance(16);
+        const uint32_t worldTime = gameTimer.GetMilliSecondsForWorld();
+        EXPECT_LE(lastWorldTime, worldTime);
+        lastWorldTime = worldTime;
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(3600u * 60u * 16u, lastWorldTime);
+    const long long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    RecordProperty("Milliseconds", (int)milliseconds);
+}
@@ -0,0 +1,98 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "HeadlessRunner_Test.h"
+#include "../Headless/HeadlessRunner.h"
+#include "RendererStub.h"
+#include "../Abyss/GameAbyss.h"
+#include <fstream>
+
+static const uint8_t KeyControl = 0x11;
+static const uint8_t KeyLeft = 0x25;
+static const uint8_t KeyUp = 0x26;
+
+HeadlessRunner_Test::HeadlessRunner_Test()
+{
+
+}
+
+HeadlessRunner_Test::~HeadlessRunner_Test()
+{
+
+}
+
+// The runner plays the actual game, so it needs the game files of The Catacomb Abyss in the working folder.
+static bool AreGameFilesPresent()
+{
+    std::ifstream file("./GAMEMAPS.ABS", std::ifstream::binary);
+    return file.is_open();
+}
+
+TEST(HeadlessRunner_Test, DISABLED_BenchmarkTicksPerSecond)
+{
+    if (!AreGameFilesPresent())
+    {
+        return;
+    }
+
+    RendererStub renderer;
+    GameAbyss gameAbyss(0, "./", renderer);
+    HeadlessRunner runner(gameAbyss);
+    runner.GetEngineCore().SetRandomSeedForNewGame(1);
+    runner.AddKeysToStartGame();
+    runner.AddKeysToRunInCircles(3000);
+
+    EXPECT_FALSE(runner.Run(3000));
+
+    // The player may get killed along the way, after which the world is no longer simulated.
+    const uint32_t gameTime = 10 * 60 * 1000;
+    const uint64_t ticksBeforeRun = runner.GetNumberOfTicks();
+    EXPECT_FALSE(runner.Run(gameTime));
+    EXPECT_GT(runner.GetNumberOfTicks(), ticksBeforeRun);
+    RecordProperty("TicksPerSecond", (int)runner.GetTicksPerSecond());
+}
+
+TEST(HeadlessRunner_Test, DemoPlaybackMatchesRecording)
+{
+    if (!AreGameFilesPresent())
+    {
+        return;
+    }
+
+    RendererStub recordingRenderer;
+    GameAbyss recordingGame(0, "./", recordingRenderer);
+    HeadlessRunner recordingRunner(recordingGame);
+    recordingRunner.GetEngineCore().SetRandomSeedForNewGame(2);
+    recordingRunner.GetEngineCore().StartDemoRecording();
+    recordingRunner.AddKeysToStartGame();
+    recordingRunner.AddKeyEvent(3000, KeyUp, true);
+    recordingRunner.AddKeyEvent(3000, KeyControl, true);
+    recordingRunner.AddKeyEvent(5000, KeyLeft, true);
+    recordingRunner.AddKeyEvent(6000, KeyLeft, false);
+    recordingRunner.AddKeyEvent(9000, KeyUp, false);
+    EXPECT_FALSE(recordingRunner.Run(20000));
+    recordingRunner.GetEngineCore().StopDemo();
+    const Demo& demo = recordingRunner.GetEngineCore().GetDemo();
+    EXPECT_GT(demo.GetNumberOfFrames(), 0u);
+
+    RendererStub playbackRenderer;
+    GameAbyss playbackGame(0, "./", playbackRenderer);
+    HeadlessRunner playbackRunner(playbackGame);
+    EXPECT_TRUE(playbackRunner.GetEngineCore().StartDemoPlayback(demo));
+    while (playbackRunner.GetEngineCore().IsPlayingDemo())
+    {
+        EXPECT_FALSE(playbackRunner.Run(1000));
+    }
+    EXPECT_TRUE(playbackRunner.GetEngineCore().DemoPlaybackMatchesRecording());
+}
@@ -0,0 +1,141 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "IndexedPicture_Test.h"
+#include "../Engine/IndexedPicture.h"
+#include "../Engine/EgaColor.h"
+
+IndexedPicture_Test::IndexedPicture_Test()
+{
+
+}
+
+IndexedPicture_Test::~IndexedPicture_Test()
+{
+
+}
+
+static const uint8_t TransparentPixel = IndexedPicture::TransparentPixel;
+
+TEST(IndexedPicture_Test, NewPictureIsTransparent)
+{
+    IndexedPicture picture(3, 3);
+    EXPECT_FALSE(picture.IsEmpty());
+    EXPECT_EQ(3, picture.GetWidth());
+    EXPECT_EQ(3, picture.GetHeight());
+    EXPECT_TRUE(picture.IsTransparent(2, 2));
+    EXPECT_EQ(TransparentPixel, picture.GetPixel(1, 2));
+}
+
+TEST(IndexedPicture_Test, SetPixel)
+{
+    IndexedPicture picture(3, 3);
+    for (uint16_t y = 0; y < 3; y++)
+    {
+        for (uint16_t x = 0; x < 3; x++)
+        {
+            picture.SetPixel(x, y, (uint8_t)((y * 3) + x + 7));
+        }
+    }
+    picture.SetPixel(1, 1, TransparentPixel);
+
+    // Neighbouring pixels that share a byte keep their value
+    EXPECT_EQ(7, picture.GetPixel(0, 0));
+    EXPECT_EQ(10, picture.GetPixel(0, 1));
+    EXPECT_EQ(TransparentPixel, picture.GetPixel(1, 1));
+    EXPECT_EQ(12, picture.GetPixel(2, 1));
+    EXPECT_EQ(15, picture.GetPixel(2, 2));
+
+    picture.SetPixel(1, 1, EgaBrightRed);
+    EXPECT_FALSE(picture.IsTransparent(1, 1));
+    EXPECT_EQ(EgaBrightRed, picture.GetColorIndex(1, 1));
+}
+
+TEST(IndexedPicture_Test, DecodeMaskedPlanes)
+{
+    // 8x2 pixels: transparency, blue, green, red and intensity planes
+    const uint8_t planes[10] =
+    {
+        0x0F, 0x00,
+        0x80, 0x00,
+        0x40, 0xFF,
+        0x00, 0x01,
+        0x00, 0x01,
+    };
+    IndexedPicture picture(8, 2);
+    picture.DecodePlanes(planes, 2, true, false, 0);
+
+    EXPECT_EQ(EgaBlue, picture.GetPixel(0, 0));
+    EXPECT_EQ(EgaGreen, picture.GetPixel(1, 0));
+    EXPECT_EQ(EgaBlack, picture.GetPixel(2, 0));
+    EXPECT_EQ(TransparentPixel, picture.GetPixel(4, 0));
+    EXPECT_EQ(TransparentPixel, picture.GetPixel(7, 0));
+    EXPECT_EQ(EgaGreen, picture.GetPixel(0, 1));
+    EXPECT_EQ(EgaBrightYellow, picture.GetPixel(7, 1));
+}
+
+TEST(IndexedPicture_Test, DecodePlanesWithMagentaAsTransparentColor)
+{
+    // 8x1 pixels: blue, green, red and intensity planes. The first pixel is magenta, the second bright magenta.
+    const uint8_t planes[4] = { 0xC0, 0x00, 0xC0, 0x40 };
+    IndexedPicture transparentPicture(8, 1);
+    transparentPicture.DecodePlanes(planes, 1, false, true, 0);
+    EXPECT_EQ(TransparentPixel, transparentPicture.GetPixel(0, 0));
+    EXPECT_EQ(EgaBrightMagenta, transparentPicture.GetPixel(1, 0));
+    EXPECT_EQ(EgaBlack, transparentPicture.GetPixel(2, 0));
+
+    IndexedPicture opaquePicture(8, 1);
+    opaquePicture.DecodePlanes(planes, 1, false, false, 0);
+    EXPECT_EQ(EgaMagenta, opaquePicture.GetPixel(0, 0));
+}
+
+TEST(IndexedPicture_Test, DecodePlanesFromRow)
+{
+    const uint8_t planes[5] = { 0x7F, 0x80, 0x00, 0x00, 0x00 };
+    IndexedPicture picture(8, 3);
+    picture.DecodePlanes(planes, 1, true, false, 2);
+    EXPECT_EQ(TransparentPixel, picture.GetPixel(0, 0));
+    EXPECT_EQ(EgaBlue, picture.GetPixel(0, 2));
+    EXPECT_EQ(TransparentPixel, picture.GetPixel(1, 2));
+}
+
+TEST(IndexedPicture_Test, SizeInBytes)
+{
+    // Half a byte per pixel for the color index, plus one bit for the transparency
+    IndexedPicture picture(64, 64);
+    EXPECT_EQ(64u * 64u * 5u / 8u, picture.GetSizeInBytes());
+
+    picture.Clear();
+    EXPECT_TRUE(picture.IsEmpty());
+    EXPECT_EQ(0u, picture.GetSizeInBytes());
+}
+
+TEST(IndexedPicture_Test, CreateHalfSizeTakesMostCommonValue)
+{
+    IndexedPicture picture(4, 3);
+    picture.SetPixel(0, 0, EgaRed);
+    picture.SetPixel(1, 0, EgaBlue);
+    picture.SetPixel(0, 1, EgaBlue);
+    picture.SetPixel(1, 1, EgaGreen);
+    picture.SetPixel(2, 0, EgaRed);
+    picture.SetPixel(3, 1, EgaGreen);
+
+    const IndexedPicture halfSize = picture.CreateHalfSize();
+    EXPECT_EQ(2, halfSize.GetWidth());
+    EXPECT_EQ(1, halfSize.GetHeight());
+    EXPECT_EQ(EgaBlue, halfSize.GetPixel(0, 0));
+
+    // Two transparent pixels outweigh two different colors
+    EXPECT_EQ(TransparentPixel, halfSize.GetPixel(1, 0));
+}
@@ -0,0 +1,183 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "LevelCache_Test.h"
+#include "RendererStub.h"
+#include "../Engine/LevelCache.h"
+#include "../Abyss/GameAbyss.h"
+#include "../Abyss/DecorateMisc.h"
+#include <chrono>
+#include <fstream>
+
+LevelCache_Test::LevelCache_Test()
+{
+
+}
+
+LevelCache_Test::~LevelCache_Test()
+{
+
+}
+
+static const LevelInfo TestLevelInfo = { "Test", EgaBlack, EgaDarkGray, false, false };
+static const std::vector<WallInfo> TestWallsInfo;
+
+static Level* CreateLevel(const uint8_t mapIndex)
+{
+    uint16_t plane0[8 * 8];
+    uint16_t plane2[8 * 8];
+    for (uint16_t i = 0; i < 8 * 8; i++)
+    {
+        plane0[i] = mapIndex;
+        plane2[i] = i;
+    }
+
+    Level* level = new Level(mapIndex, 8, 8, plane0, plane2, TestLevelInfo, TestWallsInfo);
+    level->SetBlockingActor(3, 4, new Actor(3.5f, 4.5f, 0, decoratePlayer));
+    return level;
+}
+
+TEST(LevelCache_Test, GetLevelThatIsNotCached)
+{
+    LevelCache levelCache(4);
+    EXPECT_EQ(NULL, levelCache.GetLevel(0, Easy));
+    EXPECT_EQ(0u, levelCache.GetNumberOfLevels());
+}
+
+TEST(LevelCache_Test, GetLevelReturnsPristineCopy)
+{
+    LevelCache levelCache(4);
+    Level* level = CreateLevel(2);
+    levelCache.StoreLevel(*level, Easy);
+
+    // Play the original level
+    level->SetWallTile(1, 1, 70);
+    level->GetBlockingActor(3, 4)->SetHealth(1);
+
+    Level* copy = levelCache.GetLevel(2, Easy);
+    ASSERT_NE(nullptr, copy);
+    EXPECT_EQ(2u, copy->GetLevelIndex());
+    EXPECT_EQ(2u, copy->GetWallTile(1, 1));
+    EXPECT_EQ(12u, copy->GetFloorTile(4, 1));
+    ASSERT_NE(nullptr, copy->GetBlockingActor(3, 4));
+    EXPECT_NE(level->GetBlockingActor(3, 4), copy->GetBlockingActor(3, 4));
+    EXPECT_EQ(decoratePlayer.initialHealth, copy->GetBlockingActor(3, 4)->GetHealth());
+    EXPECT_EQ(NULL, copy->GetBlockingActor(4, 3));
+
+    // Playing the copy must not affect the cache
+    copy->SetWallTile(1, 1, 70);
+    Level* secondCopy = levelCache.GetLevel(2, Easy);
+    ASSERT_NE(nullptr, secondCopy);
+    EXPECT_EQ(2u, secondCopy->GetWallTile(1, 1));
+
+    delete secondCopy;
+    delete copy;
+    delete level;
+}
+
+TEST(LevelCache_Test, DifficultyLevelIsPartOfKey)
+{
+    LevelCache levelCache(4);
+    Level* level = CreateLevel(5);
+    levelCache.StoreLevel(*level, Hard);
+    delete level;
+
+    EXPECT_EQ(NULL, levelCache.GetLevel(5, Easy));
+    Level* copy = levelCache.GetLevel(5, Hard);
+    EXPECT_NE(nullptr, copy);
+    delete copy;
+}
+
+TEST(LevelCache_Test, EvictLeastRecentlyUsedLevel)
+{
+    LevelCache levelCache(2);
+    for (uint8_t mapIndex = 0; mapIndex < 2; mapIndex++)
+    {
+        Level* level = CreateLevel(mapIndex);
+        levelCache.StoreLevel(*level, Easy);
+        delete level;
+    }
+
+    // Map 0 becomes the most recently used
+    delete levelCache.GetLevel(0, Easy);
+
+    Level* level = CreateLevel(2);
+    levelCache.StoreLevel(*level, Easy);
+    delete level;
+
+    EXPECT_EQ(2u, levelCache.GetNumberOfLevels());
+    EXPECT_EQ(NULL, levelCache.GetLevel(1, Easy));
+    Level* copy0 = levelCache.GetLevel(0, Easy);
+    Level* copy2 = levelCache.GetLevel(2, Easy);
+    EXPECT_NE(nullptr, copy0);
+    EXPECT_NE(nullptr, copy2);
+    delete copy0;
+    delete copy2;
+}
+
+TEST(LevelCache_Test, StoreSameLevelTwice)
+{
+    LevelCache levelCache(4);
+    Level* level = CreateLevel(1);
+    levelCache.StoreLevel(*level, Easy);
+    levelCache.StoreLevel(*level, Easy);
+    delete level;
+
+    EXPECT_EQ(1u, levelCache.GetNumberOfLevels());
+}
+
+TEST(LevelCache_Test, DISABLED_BenchmarkWarpToAllLevels)
+{
+    std::ifstream file("./GAMEMAPS.ABS", std::ifstream::binary);
+    if (!file.is_open())
+    {
+        // The benchmark needs the level data of the game
+        return;
+    }
+    file.close();
+
+    RendererStub renderer;
+    GameAbyss gameAbyss(0, "./", renderer);
+    GameMaps* gameMaps = gameAbyss.GetGameMaps();
+    const uint8_t numberOfLevels = gameMaps->GetNumberOfLevels();
+    LevelCache levelCache(numberOfLevels);
+
+    long long totalDecodeMicroseconds = 0;
+    long long totalCopyMicroseconds = 0;
+    for (uint8_t mapIndex = 0; mapIndex < numberOfLevels; mapIndex++)
+    {
+        const auto decodeStart = std::chrono::high_resolution_clock::now();
+        Level* level = gameMaps->GetLevelFromStart(mapIndex);
+        Random random(mapIndex, RandomStreamSpawn);
+        gameAbyss.SpawnActors(level, Easy, random);
+        const auto decodeEnd = std::chrono::high_resolution_clock::now();
+
+        levelCache.StoreLevel(*level, Easy);
+        delete level;
+
+        const auto copyStart = std::chrono::high_resolution_clock::now();
+        Level* copy = levelCache.GetLevel(mapIndex, Easy);
+        const auto copyEnd = std::chrono::high_resolution_clock::now();
+        ASSERT_NE(nullptr, copy);
+        delete copy;
+
+        const long long decodeMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(decodeEnd - decodeStart).count();
+        const long long copyMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(copyEnd - copyStart).count();
+        totalDecodeMicroseconds += decodeMicroseconds;
+        totalCopyMicroseconds += copyMicroseconds;
+    }
+
+    RecordProperty("DecodeMicroseconds", (int)totalDecodeMicroseconds);
+    RecordProperty("CachedMicroseconds", (int)totalCopyMicroseconds);
+}
@@ -14,7 +14,7 @@
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
 
 #include "LevelLocationNames_Test.h"
-#include "..\Engine\LevelLocationNames.h"
+#include "../Engine/LevelLocationNames.h"
 
 LevelLocationNames_Test::LevelLocationNames_Test()
 {
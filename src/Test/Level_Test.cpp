@@ -0,0 +1,257 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "Level_Test.h"
+#include "../Engine/Level.h"
+#include "../Abyss/DecorateMisc.h"
+#include "../Abyss/DecorateMonsters.h"
+#include <algorithm>
+
+Level_Test::Level_Test()
+{
+
+}
+
+Level_Test::~Level_Test()
+{
+
+}
+
+static const LevelInfo TestLevelInfo = { "Test", EgaBlack, EgaDarkGray, false, false };
+static const std::vector<WallInfo> TestWallsInfo = { { {}, {}, WTOpen } };
+
+static Level* CreateLevel()
+{
+    const uint16_t plane[8 * 8] = {};
+    return new Level(0, 8, 8, plane, plane, TestLevelInfo, TestWallsInfo);
+}
+
+static bool ContainsActor(const std::vector<Actor*>& actors, const Actor* actor)
+{
+    return std::find(actors.begin(), actors.end(), actor) != actors.end();
+}
+
+TEST(Level_Test, SetBlockingActorAddsToList)
+{
+    Level* level = CreateLevel();
+    Actor* actor = new Actor(2.5f, 3.5f, 0, decoratePlayer);
+    level->SetBlockingActor(2, 3, actor);
+
+    EXPECT_EQ(actor, level->GetBlockingActor(2, 3));
+    ASSERT_EQ(1u, level->GetBlockingActors().size());
+    EXPECT_EQ(actor, level->GetBlockingActors().at(0));
+    delete level;
+}
+
+TEST(Level_Test, WalkingActorStaysInList)
+{
+    Level* level = CreateLevel();
+    Actor* actor = new Actor(2.5f, 3.5f, 0, decoratePlayer);
+    level->SetBlockingActor(2, 3, actor);
+
+    // Lift the actor from its tile and set it down on the next tile
+    level->SetBlockingActor(2, 3, NULL);
+    actor->SetDirection(east);
+    EXPECT_TRUE(level->Walk(actor));
+    level->SetBlockingActor(actor->GetTileX(), actor->GetTileY(), actor);
+
+    EXPECT_EQ(NULL, level->GetBlockingActor(2, 3));
+    EXPECT_EQ(actor, level->GetBlockingActor(3, 3));
+    EXPECT_EQ(1u, level->GetBlockingActors().size());
+    delete level;
+}
+
+TEST(Level_Test, ChasingActorStandsStillWhileTimeIsFrozen)
+{
+    Level* level = CreateLevel();
+    level->GetPlayerActor()->SetX(1.5f);
+    level->GetPlayerActor()->SetY(1.5f);
+    Actor* actor = new Actor(6.5f, 6.5f, 0, decorateOrc);
+    actor->SetActive(true);
+    level->SetBlockingActor(6, 6, actor);
+    Random random(0, RandomStreamAi);
+
+    // The world time advances from tick to tick
+    level->StartTick(0);
+    level->StartTick(14);
+    level->Chase(actor, true, ChasePlayer, random);
+    level->StartTick(28);
+    level->Chase(actor, true, ChasePlayer, random);
+    const float x = actor->GetX();
+    const float y = actor->GetY();
+    EXPECT_TRUE(x != 6.5f || y != 6.5f);
+
+    // While time is frozen, the world time stays the same in every tick
+    for (uint8_t tick = 0; tick < 10; tick++)
+    {
+        level->StartTick(28);
+        level->Chase(actor, true, ChasePlayer, random);
+        EXPECT_EQ(x, actor->GetX());
+        EXPECT_EQ(y, actor->GetY());
+    }
+    EXPECT_EQ(0.0f, level->GetDistanceInTick(decorateOrc.speed));
+
+    level->StartTick(42);
+    level->Chase(actor, true, ChasePlayer, random);
+    EXPECT_TRUE(x != actor->GetX() || y != actor->GetY());
+    delete level;
+}
+
+TEST(Level_Test, RemoveActorMovesLastActorIntoSlot)
+{
+    Level* level = CreateLevel();
+    Actor* actors[3];
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        actors[i] = new Actor(i + 1.5f, 1.5f, 0, decoratePlayer);
+        level->SetBlockingActor(i + 1, 1, actors[i]);
+    }
+
+    level->RemoveActor(actors[0]);
+    EXPECT_EQ(NULL, level->GetBlockingActor(1, 1));
+    ASSERT_EQ(2u, level->GetBlockingActors().size());
+    EXPECT_EQ(actors[2], level->GetBlockingActors().at(0));
+    EXPECT_EQ(actors[1], level->GetBlockingActors().at(1));
+
+    // The moved actor must still be removable
+    level->RemoveActor(actors[2]);
+    ASSERT_EQ(1u, level->GetBlockingActors().size());
+    EXPECT_EQ(actors[1], level->GetBlockingActors().at(0));
+    EXPECT_EQ(NULL, level->GetBlockingActor(3, 1));
+    EXPECT_EQ(actors[1], level->GetBlockingActor(2, 1));
+    delete level;
+}
+
+TEST(Level_Test, RemoveNonBlockingActor)
+{
+    Level* level = CreateLevel();
+    Actor* blockingActor = new Actor(1.5f, 1.5f, 0, decoratePlayer);
+    level->SetBlockingActor(1, 1, blockingActor);
+    Actor* projectile = new Actor(4.5f, 4.5f, 0, decoratePlayer);
+    level->AddNonBlockingActor(projectile);
+
+    level->RemoveActor(projectile);
+    EXPECT_EQ(NULL, level->GetNonBlockingActor(0));
+    EXPECT_EQ(1u, level->GetBlockingActors().size());
+    delete level;
+}
+
+TEST(Level_Test, NoNonBlockingActorsAreLost)
+{
+    Level* level = CreateLevel();
+    const uint16_t numberOfProjectiles = 500;
+    for (uint16_t i = 0; i < numberOfProjectiles; i++)
+    {
+        level->AddNonBlockingActor(new Actor(4.5f, 4.5f, 0, decoratePlayer));
+    }
+    EXPECT_EQ(numberOfProjectiles, level->GetNonBlockingActors().size());
+
+    // Remove every other projectile; the remaining ones stay contiguous
+    std::vector<Actor*> projectiles = level->GetNonBlockingActors();
+    for (uint16_t i = 0; i < numberOfProjectiles; i += 2)
+    {
+        level->RemoveActor(projectiles.at(i));
+    }
+    ASSERT_EQ(numberOfProjectiles / 2u, level->GetNonBlockingActors().size());
+    for (uint16_t i = 1; i < numberOfProjectiles; i += 2)
+    {
+        EXPECT_TRUE(ContainsActor(level->GetNonBlockingActors(), projectiles.at(i)));
+    }
+    EXPECT_EQ(NULL, level->GetNonBlockingActor(numberOfProjectiles / 2));
+    delete level;
+}
+
+TEST(Level_Test, SleepingActorDoesNotAnimate)
+{
+    Level* level = CreateLevel();
+    Actor* actor = new Actor(2.5f, 2.5f, 0, decoratePlayer);
+    actor->SetActive(true);
+    level->SetBlockingActor(2, 2, actor);
+    const uint32_t timestampOfNextFrame = actor->GetTimestampOfNextFrame();
+    const uint16_t pictureIndex = actor->GetPictureIndex();
+
+    level->PutActorToSleep(actor, timestampOfNextFrame + 1000);
+    level->WakeUpActors(timestampOfNextFrame);
+    level->AnimateBlockingActors(timestampOfNextFrame);
+    EXPECT_TRUE(actor->IsAsleep());
+    EXPECT_EQ(pictureIndex, actor->GetPictureIndex());
+
+    level->WakeUpActors(timestampOfNextFrame + 1000);
+    EXPECT_FALSE(actor->IsAsleep());
+    delete level;
+}
+
+TEST(Level_Test, ChangeOfStateWakesUpActor)
+{
+    Level* level = CreateLevel();
+    Actor* actor = new Actor(2.5f, 2.5f, 0, decoratePlayer);
+    level->AddNonBlockingActor(actor);
+
+    level->PutActorToSleep(actor, 1000);
+    EXPECT_TRUE(actor->IsAsleep());
+    actor->SetState(StateIdWalk, 10);
+    EXPECT_FALSE(actor->IsAsleep());
+    delete level;
+}
+
+TEST(Level_Test, BlockingActorBecomesNonBlocking)
+{
+    Level* level = CreateLevel();
+    Actor* actor = new Actor(2.5f, 2.5f, 0, decoratePlayer);
+    level->SetBlockingActor(2, 2, actor);
+
+    // Like a monster that dies
+    level->AddNonBlockingActor(actor);
+    EXPECT_EQ(NULL, level->GetBlockingActor(2, 2));
+    EXPECT_EQ(0u, level->GetBlockingActors().size());
+    EXPECT_EQ(actor, level->GetNonBlockingActor(0));
+    delete level;
+}
+
+TEST(Level_Test, ReplaceBlockingActor)
+{
+    Level* level = CreateLevel();
+    Actor* actor = new Actor(5.5f, 6.5f, 0, decoratePlayer);
+    level->SetBlockingActor(5, 6, actor);
+    Actor* replacement = new Actor(5.5f, 6.5f, 0, decoratePlayer);
+    replacement->SetTile(5, 6);
+
+    level->ReplaceBlockingActor(actor, replacement);
+    EXPECT_EQ(replacement, level->GetBlockingActor(5, 6));
+    ASSERT_EQ(1u, level->GetBlockingActors().size());
+    EXPECT_FALSE(ContainsActor(level->GetBlockingActors(), actor));
+
+    // The replaced actor is not owned by the level anymore
+    delete actor;
+    delete level;
+}
+
+TEST(Level_Test, CopyLevelWithBlockingActors)
+{
+    Level* level = CreateLevel();
+    Actor* actor = new Actor(5.5f, 6.5f, 0, decoratePlayer);
+    level->SetBlockingActor(5, 6, actor);
+
+    Level* copy = new Level(*level);
+    ASSERT_EQ(1u, copy->GetBlockingActors().size());
+    Actor* copiedActor = copy->GetBlockingActors().at(0);
+    EXPECT_NE(actor, copiedActor);
+    EXPECT_EQ(copiedActor, copy->GetBlockingActor(5, 6));
+
+    copy->RemoveActor(copiedActor);
+    EXPECT_EQ(0u, copy->GetBlockingActors().size());
+    EXPECT_EQ(actor, level->GetBlockingActor(5, 6));
+    delete copy;
+    delete level;
+}
@@ -0,0 +1,113 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "MipChain_Test.h"
+#include "../Engine/MipChain.h"
+#include "../Engine/EgaColor.h"
+
+MipChain_Test::MipChain_Test()
+{
+
+}
+
+MipChain_Test::~MipChain_Test()
+{
+
+}
+
+static const IRenderer::rgbColor palette[EgaRange] =
+{
+    { 0, 0, 0 },
+    { 0, 0, 170 },
+    { 0, 170, 0},
+    { 0, 170, 170 },
+    { 170, 0, 0 },
+    { 170, 0, 170 },
+    { 170, 85, 0 },
+    { 170, 170, 170 },
+    { 85, 85, 85 },
+    { 85, 85, 255 },
+    { 85, 255, 85 },
+    { 85, 255, 255 },
+    { 255, 85, 85 },
+    { 255, 85, 255 },
+    { 255, 255, 85 },
+    { 255, 255, 255 }
+};
+
+TEST(MipChain_Test, LevelsAreHalvedUntilSinglePixel)
+{
+    IndexedPicture picture(64, 16);
+    const MipChain mipChain(picture, palette);
+    EXPECT_EQ(7, mipChain.GetNumberOfLevels());
+    EXPECT_EQ(64, mipChain.GetLevel(0).width);
+    EXPECT_EQ(16, mipChain.GetLevel(0).height);
+    EXPECT_EQ(32, mipChain.GetLevel(1).width);
+    EXPECT_EQ(8, mipChain.GetLevel(1).height);
+    EXPECT_EQ(4, mipChain.GetLevel(4).width);
+    EXPECT_EQ(1, mipChain.GetLevel(4).height);
+    EXPECT_EQ(1, mipChain.GetLevel(6).width);
+    EXPECT_EQ(1, mipChain.GetLevel(6).height);
+    EXPECT_EQ(4u, mipChain.GetLevel(6).texels.size());
+}
+
+TEST(MipChain_Test, OpaqueTexelsAreAveraged)
+{
+    IndexedPicture picture(2, 2);
+    picture.SetPixel(0, 0, EgaBrightWhite);
+    picture.SetPixel(1, 0, EgaBlack);
+    picture.SetPixel(0, 1, EgaBrightRed);
+    picture.SetPixel(1, 1, EgaBrightRed);
+
+    const MipChain mipChain(picture, palette);
+    ASSERT_EQ(2, mipChain.GetNumberOfLevels());
+    const uint8_t* texel = &mipChain.GetLevel(1).texels[0];
+    EXPECT_EQ((255 + 0 + 255 + 255 + 2) / 4, texel[0]);
+    EXPECT_EQ((255 + 0 + 85 + 85 + 2) / 4, texel[1]);
+    EXPECT_EQ((255 + 0 + 85 + 85 + 2) / 4, texel[2]);
+    EXPECT_EQ(255, texel[3]);
+}
+
+TEST(MipChain_Test, TransparentTexelsArePremultiplied)
+{
+    // Half of the block is transparent; the color is premultiplied by the resulting alpha of one half.
+    IndexedPicture picture(2, 2);
+    picture.SetPixel(0, 0, EgaBrightWhite);
+    picture.SetPixel(0, 1, EgaBrightWhite);
+
+    const MipChain mipChain(picture, palette);
+    const uint8_t* firstLevel = &mipChain.GetLevel(0).texels[0];
+    EXPECT_EQ(255, firstLevel[3]);
+    EXPECT_EQ(0, firstLevel[4]);
+    EXPECT_EQ(0, firstLevel[7]);
+
+    const uint8_t* texel = &mipChain.GetLevel(1).texels[0];
+    EXPECT_EQ(128, texel[0]);
+    EXPECT_EQ(128, texel[1]);
+    EXPECT_EQ(128, texel[2]);
+    EXPECT_EQ(128, texel[3]);
+}
+
+TEST(MipChain_Test, OddSizeDropsLastColumn)
+{
+    IndexedPicture picture(3, 1);
+    picture.SetPixel(0, 0, EgaBrightWhite);
+    picture.SetPixel(1, 0, EgaBrightWhite);
+    picture.SetPixel(2, 0, EgaBlack);
+
+    const MipChain mipChain(picture, palette);
+    ASSERT_EQ(2, mipChain.GetNumberOfLevels());
+    EXPECT_EQ(1, mipChain.GetLevel(1).width);
+    EXPECT_EQ(255, mipChain.GetLevel(1).texels[0]);
+}
@@ -0,0 +1,147 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "PictureTrimmer_Test.h"
+#include "../Engine/PictureTrimmer.h"
+
+PictureTrimmer_Test::PictureTrimmer_Test()
+{
+
+}
+
+PictureTrimmer_Test::~PictureTrimmer_Test()
+{
+
+}
+
+// Creates a masked picture of 24x8 pixels that is fully transparent.
+static FileChunk* CreateMaskedPicture()
+{
+    const uint32_t planeSize = 3 * 8;
+    FileChunk* chunk = new FileChunk(planeSize * 5);
+    memset(chunk->GetChunk(), 0, planeSize * 5);
+    memset(chunk->GetChunk(), 0xFF, planeSize);
+    return chunk;
+}
+
+static void SetOpaquePixel(FileChunk* chunk, const uint16_t x, const uint16_t y, const uint8_t colorBits)
+{
+    const uint32_t planeSize = 3 * 8;
+    const uint32_t offset = (y * 3) + (x / 8);
+    const uint8_t bit = 0x80 >> (x % 8);
+    chunk->GetChunk()[offset] &= ~bit;
+    for (uint32_t plane = 0; plane < 4; plane++)
+    {
+        if ((colorBits & (1 << plane)) != 0)
+        {
+            chunk->GetChunk()[((plane + 1) * planeSize) + offset] |= bit;
+        }
+    }
+}
+
+TEST(PictureTrimmer_Test, GetOpaqueRectOfMaskedPicture)
+{
+    FileChunk* chunk = CreateMaskedPicture();
+    SetOpaquePixel(chunk, 5, 2, 1);
+    SetOpaquePixel(chunk, 17, 6, 2);
+
+    pictureRect opaqueRect;
+    EXPECT_TRUE(PictureTrimmer::GetOpaqueRect(chunk, 24, 8, true, opaqueRect));
+    EXPECT_EQ(5, opaqueRect.left);
+    EXPECT_EQ(2, opaqueRect.top);
+    EXPECT_EQ(18, opaqueRect.right);
+    EXPECT_EQ(7, opaqueRect.bottom);
+
+    delete chunk;
+}
+
+TEST(PictureTrimmer_Test, GetOpaqueRectOfFullyTransparentPicture)
+{
+    FileChunk* chunk = CreateMaskedPicture();
+
+    pictureRect opaqueRect;
+    EXPECT_FALSE(PictureTrimmer::GetOpaqueRect(chunk, 24, 8, true, opaqueRect));
+
+    delete chunk;
+}
+
+TEST(PictureTrimmer_Test, GetOpaqueRectOfPictureWithMagentaAsTransparentColor)
+{
+    // 16x4 pixels, all magenta except for a single red and a single black pixel
+    const uint32_t planeSize = 2 * 4;
+    FileChunk* chunk = new FileChunk(planeSize * 4);
+    uint8_t* planes = chunk->GetChunk();
+    memset(planes, 0, planeSize * 4);
+    memset(planes, 0xFF, planeSize);
+    memset(planes + (2 * planeSize), 0xFF, planeSize);
+    planes[(1 * 2) + 1] = 0xFE;
+    planes[(2 * 2) + 0] = 0x7F;
+    planes[(2 * 2) + 0 + (2 * planeSize)] = 0x7F;
+
+    pictureRect opaqueRect;
+    EXPECT_TRUE(PictureTrimmer::GetOpaqueRect(chunk, 16, 4, false, opaqueRect));
+    EXPECT_EQ(0, opaqueRect.left);
+    EXPECT_EQ(1, opaqueRect.top);
+    EXPECT_EQ(16, opaqueRect.right);
+    EXPECT_EQ(3, opaqueRect.bottom);
+
+    delete chunk;
+}
+
+TEST(PictureTrimmer_Test, CropAlignsTextureToBytes)
+{
+    FileChunk* chunk = CreateMaskedPicture();
+    SetOpaquePixel(chunk, 9, 3, 15);
+    SetOpaquePixel(chunk, 14, 4, 4);
+
+    pictureRect opaqueRect;
+    EXPECT_TRUE(PictureTrimmer::GetOpaqueRect(chunk, 24, 8, true, opaqueRect));
+
+    pictureRect textureRect;
+    FileChunk* croppedChunk = PictureTrimmer::Crop(chunk, 24, 8, true, opaqueRect, textureRect);
+    ASSERT_TRUE(croppedChunk != NULL);
+    EXPECT_EQ(8, textureRect.left);
+    EXPECT_EQ(3, textureRect.top);
+    EXPECT_EQ(16, textureRect.right);
+    EXPECT_EQ(5, textureRect.bottom);
+
+    // Two rows of a single byte, in five planes
+    EXPECT_EQ(10u, croppedChunk->GetSize());
+    const uint8_t* planes = croppedChunk->GetChunk();
+    EXPECT_EQ(0xBF, planes[0]);
+    EXPECT_EQ(0xFD, planes[1]);
+    EXPECT_EQ(0x40, planes[2]);
+    EXPECT_EQ(0x00, planes[3]);
+    EXPECT_EQ(0x40, planes[6]);
+    EXPECT_EQ(0x02, planes[7]);
+
+    // The cropped picture has the same opaque pixels
+    pictureRect croppedOpaqueRect;
+    EXPECT_TRUE(PictureTrimmer::GetOpaqueRect(croppedChunk, 8, 2, true, croppedOpaqueRect));
+    EXPECT_EQ(1, croppedOpaqueRect.left);
+    EXPECT_EQ(7, croppedOpaqueRect.right);
+
+    delete croppedChunk;
+    delete chunk;
+}
+
+TEST(PictureTrimmer_Test, ContainsRect)
+{
+    const pictureRect outerRect = { 2, 2, 10, 10 };
+    const pictureRect innerRect = { 2, 3, 9, 10 };
+    const pictureRect overlappingRect = { 1, 3, 9, 10 };
+    EXPECT_TRUE(PictureTrimmer::ContainsRect(outerRect, innerRect));
+    EXPECT_TRUE(PictureTrimmer::ContainsRect(outerRect, outerRect));
+    EXPECT_FALSE(PictureTrimmer::ContainsRect(outerRect, overlappingRect));
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "Random_Test.h"
+#include "../Engine/Random.h"
+#include <set>
+
+Random_Test::Random_Test()
+{
+
+}
+
+Random_Test::~Random_Test()
+{
+
+}
+
+TEST(Random_Test, SameSeedGivesSameSequence)
+{
+    Random first(1234, RandomStreamAi);
+    Random second(1234, RandomStreamAi);
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        EXPECT_EQ(first.Next(), second.Next());
+    }
+}
+
+TEST(Random_Test, StreamsAreIndependent)
+{
+    Random ai(1234, RandomStreamAi);
+    Random effects(1234, RandomStreamEffects);
+    uint16_t equalValues = 0;
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        if (ai.Next() == effects.Next())
+        {
+            equalValues++;
+        }
+    }
+    EXPECT_LT(equalValues, 2);
+}
+
+TEST(Random_Test, KnownSequence)
+{
+    // Reference output of the PCG32 demo program (seed 42, sequence 54); guards against platform differences.
+    Random random(42, 54);
+    EXPECT_EQ(0xa15c02b7u, random.Next());
+    EXPECT_EQ(0x7b47f409u, random.Next());
+    EXPECT_EQ(0xba1d3330u, random.Next());
+}
+
+TEST(Random_Test, BoundedValuesCoverWholeRange)
+{
+    Random random(7, RandomStreamSpawn);
+    std::set<uint32_t> values;
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        const uint32_t value = random.Next(6);
+        EXPECT_LT(value, 6u);
+        values.insert(value);
+    }
+    EXPECT_EQ(6u, values.size());
+    EXPECT_EQ(0u, random.Next(0));
+}
+
+TEST(Random_Test, DifferentLevelsGetDifferentSeeds)
+{
+    EXPECT_NE(Random::MixSeed(1234, 0), Random::MixSeed(1234, 1));
+    EXPECT_NE(Random::MixSeed(1234, 0), Random::MixSeed(1235, 0));
+    EXPECT_EQ(Random::MixSeed(1234, 3), Random::MixSeed(1234, 3));
+}
+
+TEST(Random_Test, ContinuesAfterStoreAndLoad)
+{
+    Random random(99, RandomStreamItems);
+    random.Next();
+    random.Next();
+
+    const std::string filename = "Random_Test.sav";
+    std::ofstream outputFile(filename, std::ofstream::binary);
+    random.StoreToFile(outputFile);
+    outputFile.close();
+
+    Random loaded;
+    std::ifstream inputFile(filename, std::ifstream::binary);
+    EXPECT_TRUE(loaded.LoadFromFile(inputFile));
+    inputFile.close();
+    std::remove(filename.c_str());
+
+    for (uint16_t i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(random.Next(), loaded.Next());
+    }
+}
+
+TEST(Random_Test, LoadFromTruncatedFileFails)
+{
+    const std::string filename = "Random_Test.sav";
+    std::ofstream outputFile(filename, std::ofstream::binary);
+    const uint32_t partialState = 1;
+    outputFile.write((const char*)&partialState, sizeof(partialState));
+    outputFile.close();
+
+    Random random(5, RandomStreamAi);
+    Random reference(5, RandomStreamAi);
+    std::ifstream inputFile(filename, std::ifstream::binary);
+    EXPECT_FALSE(random.LoadFromFile(inputFile));
+    inputFile.close();
+    std::remove(filename.c_str());
+
+    EXPECT_EQ(reference.Next(), random.Next());
+}
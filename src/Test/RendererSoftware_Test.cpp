@@ -0,0 +1,226 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+#include "RendererSoftware_Test.h"
+#include "../Engine/RendererSoftware.h"
+#include "../Engine/Picture.h"
+#include "../Engine/SpriteQueue.h"
+#include <string.h>
+#include <chrono>
+
+RendererSoftware_Test::RendererSoftware_Test()
+{
+
+}
+
+RendererSoftware_Test::~RendererSoftware_Test()
+{
+
+}
+
+// Creates a 64x64 picture in a single color, stored as four EGA planes like the pictures in the EGAGRAPH file.
+static Picture* CreateSingleColorPicture(RendererSoftware& renderer, const egaColor color)
+{
+    const uint32_t planeSize = (64 * 64) / 8;
+    FileChunk chunk(planeSize * 4);
+    for (uint8_t plane = 0; plane < 4; plane++)
+    {
+        memset(chunk.GetChunk() + (plane * planeSize), ((color >> plane) & 1) ? 0xFF : 0x00, planeSize);
+    }
+
+    const uint32_t textureId = renderer.LoadFileChunkIntoTexture(&chunk, 64, 64, false);
+    return new Picture(textureId, 64, 64);
+}
+
+// Renders a single frame with a row of walls at tile row 1, facing south towards the player.
+static void RenderFrame(RendererSoftware& renderer, const Picture* wallPicture, const Picture* spritePicture, const float playerY, const float spriteY)
+{
+    renderer.SetPlayerAngle(0.0f);
+    renderer.SetPlayerPosition(2.5f, playerY);
+    renderer.Prepare3DRendering(false, 4.0f / 3.0f, 60);
+
+    renderer.PrepareFloorAndCeiling();
+    renderer.RenderFloor(2, 2, EgaGreen);
+    renderer.RenderCeiling(2, 2, EgaBlue);
+    renderer.UnprepareFloorAndCeiling();
+
+    renderer.PrepareWalls();
+    for (int16_t x = 0; x < 5; x++)
+    {
+        renderer.Render3DWall(wallPicture, x, 1, 180);
+    }
+    renderer.UnprepareWalls();
+
+    SpriteQueue spriteQueue;
+    spriteQueue.Reset(2.5f, playerY);
+    if (spritePicture != NULL)
+    {
+        spriteQueue.AddSprite(spritePicture, 2.5f, spriteY);
+    }
+    spriteQueue.SortBackToFront();
+    renderer.RenderSprites(spriteQueue);
+
+    renderer.Prepare2DRendering();
+    renderer.Unprepare2DRendering();
+}
+
+TEST(RendererSoftware_Test, WallCoversColumnWhenNearby)
+{
+    RendererSoftware renderer;
+    Picture* wallPicture = CreateSingleColorPicture(renderer, EgaBrightRed);
+
+    RenderFrame(renderer, wallPicture, NULL, 2.5f, 0.0f);
+
+    EXPECT_NEAR(0.5f, renderer.GetDepth(RendererSoftware::ScreenWidth / 2), 0.01f);
+    EXPECT_EQ(EgaBrightRed, renderer.GetPixel(160, 0));
+    EXPECT_EQ(EgaBrightRed, renderer.GetPixel(160, 60));
+    EXPECT_EQ(EgaBrightRed, renderer.GetPixel(160, 119));
+
+    delete wallPicture;
+}
+
+TEST(RendererSoftware_Test, FloorAndCeilingAroundDistantWall)
+{
+    RendererSoftware renderer;
+    Picture* wallPicture = CreateSingleColorPicture(renderer, EgaBrightRed);
+
+    RenderFrame(renderer, wallPicture, NULL, 4.5f, 0.0f);
+
+    EXPECT_NEAR(2.5f, renderer.GetDepth(RendererSoftware::ScreenWidth / 2), 0.01f);
+    EXPECT_EQ(EgaBlue, renderer.GetPixel(160, 0));
+    EXPECT_EQ(EgaBrightRed, renderer.GetPixel(160, 60));
+    EXPECT_EQ(EgaGreen, renderer.GetPixel(160, 119));
+
+    delete wallPicture;
+}
+
+TEST(RendererSoftware_Test, SpriteInFrontOfWallIsVisible)
+{
+    RendererSoftware renderer;
+    Picture* wallPicture = CreateSingleColorPicture(renderer, EgaBrightRed);
+    Picture* spritePicture = CreateSingleColorPicture(renderer, EgaBrightYellow);
+
+    RenderFrame(renderer, wallPicture, spritePicture, 4.5f, 3.0f);
+
+    EXPECT_EQ(EgaBrightYellow, renderer.GetPixel(160, 60));
+
+    delete spritePicture;
+    delete wallPicture;
+}
+
+TEST(RendererSoftware_Test, SpriteBehindWallIsHidden)
+{
+    RendererSoftware renderer;
+    Picture* wallPicture = CreateSingleColorPicture(renderer, EgaBrightRed);
+    Picture* spritePicture = CreateSingleColorPicture(renderer, EgaBrightYellow);
+
+    RenderFrame(renderer, wallPicture, spritePicture, 4.5f, 1.5f);
+
+    EXPECT_EQ(EgaBrightRed, renderer.GetPixel(160, 60));
+
+    delete spritePicture;
+    delete wallPicture;
+}
+
+TEST(RendererSoftware_Test, BarIsDrawnOnTopOfView)
+{
+    RendererSoftware renderer;
+    Picture* wallPicture = CreateSingleColorPicture(renderer, EgaBrightRed);
+
+    RenderFrame(renderer, wallPicture, NULL, 2.5f, 0.0f);
+    renderer.Prepare2DRendering();
+    renderer.Render2DBar(150, 50, 20, 20, EgaBlack);
+    renderer.Unprepare2DRendering();
+
+    EXPECT_EQ(EgaBlack, renderer.GetPixel(160, 60));
+    EXPECT_EQ(EgaBrightRed, renderer.GetPixel(140, 60));
+
+    delete wallPicture;
+}
+
+TEST(RendererSoftware_Test, ColumnsSplitOverThreadsGiveTheSameFrame)
+{
+    RendererSoftware singleThreadRenderer;
+    RendererSoftware multiThreadRenderer;
+    multiThreadRenderer.SetNumberOfThreads(4);
+    EXPECT_EQ(4u, multiThreadRenderer.GetNumberOfThreads());
+    Picture* singleThreadWall = CreateSingleColorPicture(singleThreadRenderer, EgaBrightRed);
+    Picture* multiThreadWall = CreateSingleColorPicture(multiThreadRenderer, EgaBrightRed);
+
+    for (uint8_t frame = 0; frame < 3; frame++)
+    {
+        const float playerY = 2.5f + frame;
+        RenderFrame(singleThreadRenderer, singleThreadWall, NULL, playerY, 0.0f);
+        RenderFrame(multiThreadRenderer, multiThreadWall, NULL, playerY, 0.0f);
+        EXPECT_EQ(0, memcmp(singleThreadRenderer.GetFrameBuffer(), multiThreadRenderer.GetFrameBuffer(), RendererSoftware::ScreenWidth * RendererSoftware::ScreenHeight));
+        for (uint16_t column = 0; column < RendererSoftware::ScreenWidth; column++)
+        {
+            EXPECT_EQ(singleThreadRenderer.GetDepth(column), multiThreadRenderer.GetDepth(column));
+        }
+    }
+
+    delete multiThreadWall;
+    delete singleThreadWall;
+}
+
+// Renders a 64x64 room with a pillar on every fourth tile, while the player turns around in the middle of it.
+static long long MeasureMicrosecondsPerFrame(const uint8_t numberOfThreads)
+{
+    const uint32_t numberOfFrames = 1000;
+    RendererSoftware renderer;
+    renderer.SetNumberOfThreads(numberOfThreads);
+    Picture* wallPicture = CreateSingleColorPicture(renderer, EgaBrightRed);
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    for (uint32_t frame = 0; frame < numberOfFrames; frame++)
+    {
+        renderer.SetPlayerAngle((float)(frame % 360));
+        renderer.SetPlayerPosition(32.5f, 32.5f);
+        renderer.Prepare3DRendering(false, 4.0f / 3.0f, 60);
+        renderer.PrepareWalls();
+        for (int16_t i = 0; i < 64; i++)
+        {
+            renderer.Render3DWall(wallPicture, i, 0, 180);
+            renderer.Render3DWall(wallPicture, i, 63, 0);
+            renderer.Render3DWall(wallPicture, 0, i, 90);
+            renderer.Render3DWall(wallPicture, 63, i, 270);
+        }
+        for (int16_t y = 4; y < 63; y += 4)
+        {
+            for (int16_t x = 4; x < 63; x += 4)
+            {
+                renderer.Render3DWall(wallPicture, x, y, 0);
+            }
+        }
+        renderer.UnprepareWalls();
+        renderer.Prepare2DRendering();
+        renderer.Unprepare2DRendering();
+    }
+    const auto endTime = std::chrono::high_resolution_clock::now();
+
+    delete wallPicture;
+    return std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count() / numberOfFrames;
+}
+
+TEST(RendererSoftware_Test, DISABLED_BenchmarkFramesPerSecond)
+{
+    for (uint8_t numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads *= 2)
+    {
+        const long long microsecondsPerFrame = MeasureMicrosecondsPerFrame(numberOfThreads);
+        EXPECT_GT(microsecondsPerFrame, 0);
+        const std::string key = "FramesPerSecondWith" + std::to_string(numberOfThreads) + "Threads";
+        RecordProperty(key.c_str(), (microsecondsPerFrame > 0) ? (int)(1000000 / microsecondsPerFrame) : 0);
+    }
+}
@@ -72,6 +72,10 @@ uint32_t RendererStub::LoadFontIntoTexture(const bool* /*fontPicture*/)
     return 0u;
 }
 
+void RendererStub::UnloadTexture(const uint32_t /*textureId*/)
+{
+}
+
 void RendererStub::RenderTextLeftAligned(const char* /*text*/, const Font* /*font*/, const egaColor /*colorIndex*/, const uint16_t /*offsetX*/, const uint16_t /*offsetY*/)
 {
 }
@@ -108,6 +112,15 @@ void RendererStub::RenderRadarBlip(const float /*x*/, const float /*y*/, const e
 {
 }
 
+void RendererStub::CaptureLayer(const uint8_t /*layerId*/, const uint16_t /*offsetX*/, const uint16_t /*offsetY*/, const uint16_t /*width*/, const uint16_t /*height*/)
+{
+}
+
+bool RendererStub::RenderLayer(const uint8_t /*layerId*/)
+{
+    return false;
+}
+
 void RendererStub::Prepare3DRendering(const bool /*depthShading*/, const float /*aspectRatio*/, uint16_t /*fov*/)
 {
 }
@@ -128,11 +141,7 @@ void RendererStub::Render3DSprite(const Picture* /*picture*/, const float /*offs
 {
 }
 
-void RendererStub::AddSprite(const Picture* /*picture*/, const float /*offsetX*/, const float /*offsetY*/)
-{
-}
-
-void RendererStub::RenderAllSprites()
+void RendererStub::RenderSprites(const SpriteQueue& /*spriteQueue*/)
 {
 }
 
@@ -14,7 +14,7 @@
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
 #pragma once
 
-#include "..\Engine\IRenderer.h"
+#include "../Engine/IRenderer.h"
 
 class RendererStub : public IRenderer
 {
@@ -33,6 +33,7 @@ public:
     uint32_t LoadMaskedFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height) override;
     uint32_t LoadTilesSize8MaskedIntoTexture(const FileChunk* decompressedChunk) override;
     uint32_t LoadFontIntoTexture(const bool* fontPicture) override;
+    void UnloadTexture(const uint32_t textureId) override;
 
     void RenderTextLeftAligned(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) override;
     void RenderTextCentered(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) override;
@@ -44,6 +45,8 @@ public:
     void Render2DTileSize8Masked(const Picture* tiles, const uint16_t tileIndex, const uint16_t offsetX, const uint16_t offsetY) override;
     void Render2DBar(const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height, const egaColor colorIndex) override;
     void RenderRadarBlip(const float x, const float y, const egaColor colorIndex) override;
+    void CaptureLayer(const uint8_t layerId, const uint16_t offsetX, const uint16_t offsetY, const uint16_t width, const uint16_t height) override;
+    bool RenderLayer(const uint8_t layerId) override;
 
     void Prepare3DRendering(const bool depthShading, const float aspectRatio, uint16_t fov) override;
 
@@ -52,8 +55,7 @@ public:
     void Render3DWall(const Picture* picture, const int16_t tileX, const int16_t tileY, const int16_t orientation) override;
     void Render3DSprite(const Picture* picture, const float offsetX, const float offsetY) override;
 
-    void AddSprite(const Picture* picture, const float offsetX, const float offsetY) override;
-    void RenderAllSprites();
+    void RenderSprites(const SpriteQueue& spriteQueue) override;
     void PrepareFloorAndCeiling() override;
     void UnprepareFloorAndCeiling() override;
     void RenderFloor(const uint16_t tileX, const uint16_t tileY, const egaColor colorIndex) override;
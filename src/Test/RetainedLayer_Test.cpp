@@ -0,0 +1,93 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "RetainedLayer_Test.h"
+#include "../Engine/RetainedLayer.h"
+#include "../Engine/RendererSoftware.h"
+
+RetainedLayer_Test::RetainedLayer_Test()
+{
+
+}
+
+RetainedLayer_Test::~RetainedLayer_Test()
+{
+
+}
+
+TEST(RetainedLayer_Test, NothingIsRenderedBeforeCapture)
+{
+    RendererSoftware renderer;
+    RetainedLayer layer(0, 0, 120, 320, 80);
+    layer.ResetHash();
+    layer.AddToHash(std::string("Level 1"));
+    EXPECT_FALSE(layer.RenderIfUnchanged(renderer));
+    EXPECT_EQ(0u, layer.GetNumberOfCaptures());
+}
+
+TEST(RetainedLayer_Test, UnchangedContentIsRestoredFromCapture)
+{
+    RendererSoftware renderer;
+    RetainedLayer layer(0, 0, 120, 320, 80);
+    const int16_t health = 100;
+
+    renderer.Prepare2DRendering();
+    layer.ResetHash();
+    layer.AddToHash(&health, sizeof(health));
+    EXPECT_FALSE(layer.RenderIfUnchanged(renderer));
+    renderer.Render2DBar(10, 130, 20, 10, EgaBrightRed);
+    layer.Capture(renderer);
+    EXPECT_EQ(1u, layer.GetNumberOfCaptures());
+
+    // Overwrite the layer area, as the next frame would.
+    renderer.Render2DBar(0, 120, 320, 80, EgaBlack);
+    EXPECT_EQ(EgaBlack, renderer.GetPixel(15, 135));
+
+    layer.ResetHash();
+    layer.AddToHash(&health, sizeof(health));
+    EXPECT_TRUE(layer.RenderIfUnchanged(renderer));
+    EXPECT_EQ(EgaBrightRed, renderer.GetPixel(15, 135));
+    EXPECT_EQ(EgaBlack, renderer.GetPixel(5, 135));
+    EXPECT_EQ(1u, layer.GetNumberOfCaptures());
+}
+
+TEST(RetainedLayer_Test, ChangedContentIsRenderedAgain)
+{
+    RendererSoftware renderer;
+    RetainedLayer layer(0, 0, 120, 320, 80);
+    int16_t health = 100;
+
+    layer.ResetHash();
+    layer.AddToHash(&health, sizeof(health));
+    layer.AddToHash(std::string("Level 1"));
+    layer.Capture(renderer);
+
+    health = 90;
+    layer.ResetHash();
+    layer.AddToHash(&health, sizeof(health));
+    layer.AddToHash(std::string("Level 1"));
+    EXPECT_FALSE(layer.RenderIfUnchanged(renderer));
+
+    health = 100;
+    layer.ResetHash();
+    layer.AddToHash(&health, sizeof(health));
+    layer.AddToHash(std::string("Level 2"));
+    EXPECT_FALSE(layer.RenderIfUnchanged(renderer));
+
+    layer.ResetHash();
+    layer.AddToHash(&health, sizeof(health));
+    layer.AddToHash(std::string("Level 1"));
+    layer.Invalidate();
+    EXPECT_FALSE(layer.RenderIfUnchanged(renderer));
+}
@@ -0,0 +1,157 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "SpatialHash_Test.h"
+#include "../Engine/SpatialHash.h"
+#include "../Engine/Actor.h"
+#include "../Abyss/DecorateMisc.h"
+#include <chrono>
+
+SpatialHash_Test::SpatialHash_Test()
+{
+
+}
+
+SpatialHash_Test::~SpatialHash_Test()
+{
+
+}
+
+TEST(SpatialHash_Test, ActorBetweenTilesIsFoundInBoth)
+{
+    SpatialHash spatialHash(8, 8);
+    Actor actor(3.0f, 1.5f, 0, decoratePlayer);
+    std::vector<Actor*> actors = { &actor };
+    spatialHash.Build(actors);
+
+    std::vector<Actor*> actorsInLeftTile;
+    spatialHash.GetActorsInBox(2.1f, 1.1f, 2.9f, 1.9f, actorsInLeftTile);
+    EXPECT_EQ(1u, actorsInLeftTile.size());
+
+    std::vector<Actor*> actorsInRightTile;
+    spatialHash.GetActorsInBox(3.1f, 1.1f, 3.9f, 1.9f, actorsInRightTile);
+    EXPECT_EQ(1u, actorsInRightTile.size());
+
+    std::vector<Actor*> actorsInBothTiles;
+    spatialHash.GetActorsInBox(2.0f, 1.0f, 4.0f, 2.0f, actorsInBothTiles);
+    EXPECT_EQ(1u, actorsInBothTiles.size());
+}
+
+TEST(SpatialHash_Test, ActorsOnPathInOrderOfHit)
+{
+    SpatialHash spatialHash(8, 8);
+    Actor farActor(6.5f, 1.5f, 0, decoratePlayer);
+    Actor nearActor(3.5f, 1.5f, 0, decoratePlayer);
+    Actor actorBesidePath(4.5f, 4.5f, 0, decoratePlayer);
+    std::vector<Actor*> actors = { &farActor, &actorBesidePath, &nearActor };
+    spatialHash.Build(actors);
+
+    std::vector<Actor*> actorsOnPath;
+    spatialHash.GetActorsOnPath(1.5f, 1.5f, 7.5f, 1.5f, 0.2f, actorsOnPath);
+    ASSERT_EQ(2u, actorsOnPath.size());
+    EXPECT_EQ(&nearActor, actorsOnPath.at(0));
+    EXPECT_EQ(&farActor, actorsOnPath.at(1));
+}
+
+TEST(SpatialHash_Test, FastProjectileDoesNotPassThrough)
+{
+    SpatialHash spatialHash(8, 8);
+    Actor actor(3.5f, 1.5f, 0, decoratePlayer);
+    std::vector<Actor*> actors = { &actor };
+    spatialHash.Build(actors);
+
+    // Neither the start nor the end position overlaps the actor
+    std::vector<Actor*> actorsOnPath;
+    spatialHash.GetActorsOnPath(2.4f, 1.5f, 4.6f, 1.5f, 0.1f, actorsOnPath);
+    EXPECT_EQ(1u, actorsOnPath.size());
+}
+
+TEST(SpatialHash_Test, TouchingIsNoHit)
+{
+    float entryTime = 0.0f;
+    EXPECT_FALSE(SpatialHash::SweepBoxes(1.0f, 1.0f, 1.0f, 2.0f, 0.5f, 2.0f, 1.5f, 0.5f, entryTime));
+    EXPECT_TRUE(SpatialHash::SweepBoxes(1.0f, 1.0f, 3.0f, 1.0f, 0.5f, 2.5f, 1.5f, 0.5f, entryTime));
+    EXPECT_FLOAT_EQ(0.25f, entryTime);
+}
+
+TEST(SpatialHash_Test, RemovedActorIsNotFound)
+{
+    SpatialHash spatialHash(8, 8);
+    Actor actor(3.5f, 1.5f, 0, decoratePlayer);
+    std::vector<Actor*> actors = { &actor };
+    spatialHash.Build(actors);
+    spatialHash.Remove(&actor);
+
+    std::vector<Actor*> actorsOnPath;
+    spatialHash.GetActorsOnPath(1.5f, 1.5f, 5.5f, 1.5f, 0.2f, actorsOnPath);
+    EXPECT_TRUE(actorsOnPath.empty());
+}
+
+TEST(SpatialHash_Test, RemovingAnActorKeepsTheOthers)
+{
+    SpatialHash spatialHash(8, 8);
+    Actor firstActor(2.5f, 1.5f, 0, decoratePlayer);
+    Actor secondActor(3.5f, 1.5f, 0, decoratePlayer);
+    Actor unknownActor(4.5f, 1.5f, 0, decoratePlayer);
+    std::vector<Actor*> actors = { &firstActor, &secondActor };
+    spatialHash.Build(actors);
+    spatialHash.Remove(&firstActor);
+    spatialHash.Remove(&unknownActor);
+
+    std::vector<Actor*> actorsOnPath;
+    spatialHash.GetActorsOnPath(1.5f, 1.5f, 5.5f, 1.5f, 0.2f, actorsOnPath);
+    ASSERT_EQ(1u, actorsOnPath.size());
+    EXPECT_EQ(&secondActor, actorsOnPath.at(0));
+}
+
+TEST(SpatialHash_Test, DISABLED_BenchmarkProjectileQueries)
+{
+    const uint16_t mapWidth = 128;
+    const uint16_t mapHeight = 128;
+    const uint32_t numberOfActors = 10000;
+    const uint32_t numberOfProjectiles = 1000;
+    const uint32_t numberOfFrames = 100;
+
+    SpatialHash spatialHash(mapWidth, mapHeight);
+    std::vector<Actor*> actors;
+    for (uint32_t i = 0; i < numberOfActors; i++)
+    {
+        actors.push_back(new Actor((i % mapWidth) + 0.5f, (i / mapWidth) + 0.5f, 0, decoratePlayer));
+    }
+
+    uint32_t numberOfHits = 0;
+    std::vector<Actor*> actorsOnPath;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (uint32_t frame = 0; frame < numberOfFrames; frame++)
+    {
+        spatialHash.Build(actors);
+        for (uint32_t i = 0; i < numberOfProjectiles; i++)
+        {
+            const float x = (float)((i * 7) % mapWidth) + 0.1f;
+            const float y = (float)((i * 13) % mapHeight) + 0.1f;
+            actorsOnPath.clear();
+            spatialHash.GetActorsOnPath(x, y, x + 0.7f, y + 0.3f, 0.2f, actorsOnPath);
+            numberOfHits += (uint32_t)actorsOnPath.size();
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    RecordProperty("MicrosecondsPerFrame", (int)(microseconds / numberOfFrames));
+    RecordProperty("HitsPerFrame", (int)(numberOfHits / numberOfFrames));
+
+    for (Actor* actor : actors)
+    {
+        delete actor;
+    }
+}
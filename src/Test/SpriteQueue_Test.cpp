@@ -0,0 +1,123 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+#include "SpriteQueue_Test.h"
+#include "../Engine/SpriteQueue.h"
+#include <chrono>
+#include <stdlib.h>
+
+SpriteQueue_Test::SpriteQueue_Test()
+{
+
+}
+
+SpriteQueue_Test::~SpriteQueue_Test()
+{
+
+}
+
+static bool IsSortedBackToFront(const SpriteQueue& spriteQueue)
+{
+    const SpriteQueue::spriteToRender* sprites = spriteQueue.GetSprites();
+    for (uint32_t i = 1; i < spriteQueue.GetNumberOfSprites(); i++)
+    {
+        if (sprites[i - 1].squaredDistance < sprites[i].squaredDistance)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST(SpriteQueue_Test, EmptyAfterReset)
+{
+    SpriteQueue spriteQueue;
+    spriteQueue.AddSprite(NULL, 1.0f, 1.0f);
+    spriteQueue.Reset(0.0f, 0.0f);
+    EXPECT_EQ(0u, spriteQueue.GetNumberOfSprites());
+}
+
+TEST(SpriteQueue_Test, SortedFromFarToNear)
+{
+    SpriteQueue spriteQueue;
+    spriteQueue.Reset(10.0f, 10.0f);
+    spriteQueue.AddSprite(NULL, 11.0f, 10.0f);
+    spriteQueue.AddSprite(NULL, 10.0f, 40.0f);
+    spriteQueue.AddSprite(NULL, 10.25f, 10.0f);
+    spriteQueue.AddSprite(NULL, 5.0f, 5.0f);
+    spriteQueue.SortBackToFront();
+
+    const SpriteQueue::spriteToRender* sprites = spriteQueue.GetSprites();
+    ASSERT_EQ(4u, spriteQueue.GetNumberOfSprites());
+    EXPECT_FLOAT_EQ(40.0f, sprites[0].offsetY);
+    EXPECT_FLOAT_EQ(5.0f, sprites[1].offsetX);
+    EXPECT_FLOAT_EQ(11.0f, sprites[2].offsetX);
+    EXPECT_FLOAT_EQ(10.25f, sprites[3].offsetX);
+}
+
+TEST(SpriteQueue_Test, NoSpritesDroppedBeyondHundred)
+{
+    SpriteQueue spriteQueue;
+    spriteQueue.Reset(0.0f, 0.0f);
+    for (uint16_t i = 0; i < 500; i++)
+    {
+        spriteQueue.AddSprite(NULL, (float)(i % 37), (float)(i % 23));
+    }
+    spriteQueue.SortBackToFront();
+
+    EXPECT_EQ(500u, spriteQueue.GetNumberOfSprites());
+    EXPECT_TRUE(IsSortedBackToFront(spriteQueue));
+}
+
+TEST(SpriteQueue_Test, EqualDistancesKeepOrderOfAdding)
+{
+    SpriteQueue spriteQueue;
+    spriteQueue.Reset(0.0f, 0.0f);
+    spriteQueue.AddSprite(NULL, 1.0f, 0.0f);
+    spriteQueue.AddSprite(NULL, 0.0f, 1.0f);
+    spriteQueue.AddSprite(NULL, -1.0f, 0.0f);
+    spriteQueue.SortBackToFront();
+
+    const SpriteQueue::spriteToRender* sprites = spriteQueue.GetSprites();
+    EXPECT_FLOAT_EQ(1.0f, sprites[0].offsetX);
+    EXPECT_FLOAT_EQ(1.0f, sprites[1].offsetY);
+    EXPECT_FLOAT_EQ(-1.0f, sprites[2].offsetX);
+}
+
+TEST(SpriteQueue_Test, DISABLED_Benchmark10000Sprites)
+{
+    const uint32_t numberOfSprites = 10000;
+    const uint32_t numberOfFrames = 100;
+    SpriteQueue spriteQueue;
+    srand(1);
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    for (uint32_t frame = 0; frame < numberOfFrames; frame++)
+    {
+        spriteQueue.Reset(32.0f, 32.0f);
+        for (uint32_t i = 0; i < numberOfSprites; i++)
+        {
+            spriteQueue.AddSprite(NULL, (float)(rand() % 6400) / 100.0f, (float)(rand() % 6400) / 100.0f);
+        }
+        spriteQueue.SortBackToFront();
+    }
+    const auto endTime = std::chrono::high_resolution_clock::now();
+
+    EXPECT_EQ(numberOfSprites, spriteQueue.GetNumberOfSprites());
+    EXPECT_TRUE(IsSortedBackToFront(spriteQueue));
+
+    const long long microsecondsPerFrame = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count() / numberOfFrames;
+    RecordProperty("MicrosecondsPerFrame", (int)microsecondsPerFrame);
+}
@@ -0,0 +1,89 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+
+#include "TextLayoutCache_Test.h"
+#include "../Engine/TextLayoutCache.h"
+#include "../Engine/Font.h"
+
+TextLayoutCache_Test::TextLayoutCache_Test()
+{
+
+}
+
+TextLayoutCache_Test::~TextLayoutCache_Test()
+{
+
+}
+
+static Font* CreateFont()
+{
+    uint8_t widths[256];
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        widths[i] = (i == 'i') ? 4 : 8;
+    }
+    return new Font(widths, 1);
+}
+
+TEST(TextLayoutCache_Test, GlyphsAreLaidOutFromLeftToRight)
+{
+    Font* font = CreateFont();
+    TextLayoutCache cache;
+
+    const TextLayoutCache::textRun& textRun = cache.GetTextRun("Hi!", font, EgaBrightYellow);
+    ASSERT_EQ(3u, textRun.glyphs.size());
+    EXPECT_EQ(20, textRun.width);
+    EXPECT_EQ(0, textRun.glyphs[0].offsetX);
+    EXPECT_EQ(8, textRun.glyphs[1].offsetX);
+    EXPECT_EQ(12, textRun.glyphs[2].offsetX);
+    EXPECT_EQ(('H' % 16) * 16, textRun.glyphs[0].sourceX);
+    EXPECT_EQ(('H' / 16) * 10, textRun.glyphs[0].sourceY);
+    EXPECT_FLOAT_EQ(4.0f / 256.0f, textRun.glyphs[1].textureWidth);
+
+    delete font;
+}
+
+TEST(TextLayoutCache_Test, RepeatedTextIsAHit)
+{
+    Font* font = CreateFont();
+    TextLayoutCache cache;
+
+    cache.GetTextRun("Gem", font, EgaBrightYellow);
+    cache.GetTextRun("Gem", font, EgaBrightYellow);
+    cache.GetTextRun("Gem", font, EgaBrightYellow);
+    cache.GetTextRun("Gem", font, EgaDarkGray);
+
+    EXPECT_EQ(2u, cache.GetHits());
+    EXPECT_EQ(2u, cache.GetMisses());
+    EXPECT_FLOAT_EQ(0.5f, cache.GetHitRate());
+    EXPECT_EQ(2u, cache.GetNumberOfRuns());
+
+    delete font;
+}
+
+TEST(TextLayoutCache_Test, CacheStartsOverWhenFull)
+{
+    Font* font = CreateFont();
+    TextLayoutCache cache(2);
+
+    cache.GetTextRun("1", font, EgaBrightYellow);
+    cache.GetTextRun("2", font, EgaBrightYellow);
+    EXPECT_EQ(2u, cache.GetNumberOfRuns());
+    cache.GetTextRun("3", font, EgaBrightYellow);
+    EXPECT_EQ(1u, cache.GetNumberOfRuns());
+    EXPECT_EQ(3u, cache.GetMisses());
+
+    delete font;
+}
@@ -0,0 +1,187 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "TextureResidency_Test.h"
+#include "RendererStub.h"
+#include "../Engine/TextureResidency.h"
+#include "../Engine/Picture.h"
+
+TextureResidency_Test::TextureResidency_Test()
+{
+
+}
+
+TextureResidency_Test::~TextureResidency_Test()
+{
+
+}
+
+// Each picture of 16x16 texels takes 1 KB.
+static const uint32_t PictureSize = 16 * 16 * TextureResidency::BytesPerTexel;
+
+static void Decode(TextureResidency& residency, Picture** slots, const uint32_t firstEntry, const uint16_t index)
+{
+    if (slots[index] == NULL)
+    {
+        slots[index] = new Picture(index + 1, 16, 16);
+        residency.SetResident(firstEntry + index);
+    }
+    residency.Touch(firstEntry + index);
+}
+
+static void DeleteAll(Picture** slots, const uint16_t numberOfSlots)
+{
+    for (uint16_t i = 0; i < numberOfSlots; i++)
+    {
+        delete slots[i];
+        slots[i] = NULL;
+    }
+}
+
+TEST(TextureResidency_Test, KeepsTrackOfResidentBytes)
+{
+    RendererStub renderer;
+    TextureResidency residency(renderer, 10 * PictureSize);
+    Picture* slots[4] = { NULL, NULL, NULL, NULL };
+    const uint32_t firstEntry = residency.AddSlots(slots, 4);
+
+    Decode(residency, slots, firstEntry, 0);
+    Decode(residency, slots, firstEntry, 2);
+    Decode(residency, slots, firstEntry, 2);
+    EXPECT_EQ(2u, residency.GetNumberOfResidentPictures());
+    EXPECT_EQ(2 * PictureSize, residency.GetResidentBytes());
+
+    residency.BeginFrame();
+    EXPECT_EQ(0u, residency.GetNumberOfEvictions());
+    EXPECT_TRUE(slots[0] != NULL);
+
+    DeleteAll(slots, 4);
+}
+
+TEST(TextureResidency_Test, EvictsLeastRecentlyUsedWhenOverBudget)
+{
+    RendererStub renderer;
+    TextureResidency residency(renderer, 3 * PictureSize);
+    Picture* slots[8] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL };
+    const uint32_t firstEntry = residency.AddSlots(slots, 8);
+
+    // Use a different picture in each frame; picture 0 is evicted after frame 3 and used again in frame 4.
+    for (uint16_t i = 0; i < 5; i++)
+    {
+        Decode(residency, slots, firstEntry, i);
+        if (i == 4)
+        {
+            Decode(residency, slots, firstEntry, 0);
+        }
+        residency.BeginFrame();
+    }
+
+    // Picture 0 and 4 were used in the previous frame; picture 3 is the most recently used of the others.
+    EXPECT_TRUE(slots[0] != NULL);
+    EXPECT_TRUE(slots[1] == NULL);
+    EXPECT_TRUE(slots[2] == NULL);
+    EXPECT_TRUE(slots[3] != NULL);
+    EXPECT_TRUE(slots[4] != NULL);
+    EXPECT_EQ(3u, residency.GetNumberOfResidentPictures());
+    EXPECT_EQ(3 * PictureSize, residency.GetResidentBytes());
+    EXPECT_EQ(3u, residency.GetNumberOfEvictions());
+    EXPECT_EQ(1u, residency.GetNumberOfRedecodes());
+
+    Decode(residency, slots, firstEntry, 1);
+    EXPECT_EQ(2u, residency.GetNumberOfRedecodes());
+
+    DeleteAll(slots, 8);
+}
+
+TEST(TextureResidency_Test, RecentlyUsedPicturesMoveToTheEndOfTheList)
+{
+    RendererStub renderer;
+    TextureResidency residency(renderer, 2 * PictureSize);
+    Picture* slots[3] = { NULL, NULL, NULL };
+    const uint32_t firstEntry = residency.AddSlots(slots, 3);
+
+    Decode(residency, slots, firstEntry, 0);
+    residency.BeginFrame();
+    Decode(residency, slots, firstEntry, 1);
+    residency.BeginFrame();
+    Decode(residency, slots, firstEntry, 0);
+    residency.BeginFrame();
+    Decode(residency, slots, firstEntry, 2);
+    residency.BeginFrame();
+    residency.BeginFrame();
+
+    // Picture 1 was decoded after picture 0, but picture 0 was drawn again later.
+    EXPECT_TRUE(slots[0] != NULL);
+    EXPECT_TRUE(slots[1] == NULL);
+    EXPECT_TRUE(slots[2] != NULL);
+    EXPECT_EQ(1u, residency.GetNumberOfEvictions());
+
+    DeleteAll(slots, 3);
+}
+
+TEST(TextureResidency_Test, PicturesOfPreviousFrameAreNotEvicted)
+{
+    RendererStub renderer;
+    TextureResidency residency(renderer, PictureSize);
+    Picture* slots[4] = { NULL, NULL, NULL, NULL };
+    const uint32_t firstEntry = residency.AddSlots(slots, 4);
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        Decode(residency, slots, firstEntry, i);
+    }
+    residency.BeginFrame();
+
+    // The budget is exceeded by the working set, rather than decoding the same pictures every frame.
+    EXPECT_EQ(4u, residency.GetNumberOfResidentPictures());
+    EXPECT_EQ(0u, residency.GetNumberOfEvictions());
+    EXPECT_EQ(PictureSize, residency.GetBudget());
+
+    // Once the pictures were not used for a frame, just enough of them are evicted to get within budget.
+    residency.BeginFrame();
+    EXPECT_EQ(3u, residency.GetNumberOfEvictions());
+    EXPECT_EQ(PictureSize, residency.GetResidentBytes());
+
+    DeleteAll(slots, 4);
+}
+
+TEST(TextureResidency_Test, BudgetIsMetAgainAfterHeavyFrame)
+{
+    RendererStub renderer;
+    TextureResidency residency(renderer, 2 * PictureSize);
+    Picture* slots[8] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL };
+    const uint32_t firstEntry = residency.AddSlots(slots, 8);
+
+    // A single frame draws all pictures
+    for (uint16_t i = 0; i < 8; i++)
+    {
+        Decode(residency, slots, firstEntry, i);
+    }
+    residency.BeginFrame();
+    EXPECT_EQ(8 * PictureSize, residency.GetResidentBytes());
+    EXPECT_EQ(2 * PictureSize, residency.GetBudget());
+
+    // The next frames only draw a single picture
+    for (uint16_t frame = 0; frame < 3; frame++)
+    {
+        Decode(residency, slots, firstEntry, 5);
+        residency.BeginFrame();
+    }
+    EXPECT_EQ(2 * PictureSize, residency.GetBudget());
+    EXPECT_LE(residency.GetResidentBytes(), residency.GetBudget());
+    EXPECT_TRUE(slots[5] != NULL);
+    EXPECT_EQ(6u, residency.GetNumberOfEvictions());
+
+    DeleteAll(slots, 8);
+}
@@ -0,0 +1,177 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "TimerWheel_Test.h"
+#include "../Engine/TimerWheel.h"
+#include "../Engine/Actor.h"
+#include "../Abyss/DecorateMisc.h"
+
+TimerWheel_Test::TimerWheel_Test()
+{
+
+}
+
+TimerWheel_Test::~TimerWheel_Test()
+{
+
+}
+
+TEST(TimerWheel_Test, WakeUpWhenDue)
+{
+    TimerWheel wheel;
+    Actor actor(1.5f, 1.5f, 0, decoratePlayer);
+    std::vector<Actor*> dueActors;
+    wheel.Schedule(&actor, 100);
+
+    wheel.Advance(99, dueActors);
+    EXPECT_TRUE(dueActors.empty());
+    EXPECT_TRUE(wheel.IsScheduled(&actor));
+
+    wheel.Advance(100, dueActors);
+    ASSERT_EQ(1u, dueActors.size());
+    EXPECT_EQ(&actor, dueActors.at(0));
+    EXPECT_FALSE(wheel.IsScheduled(&actor));
+}
+
+TEST(TimerWheel_Test, WakeUpsAcrossAllLevels)
+{
+    TimerWheel wheel;
+    std::vector<Actor*> dueActors;
+    wheel.Advance(12345, dueActors);
+
+    // One wake-up for each level of the wheel, plus one beyond its reach
+    const uint32_t delays[] = { 7, 1000, 100000, 5000000, 20000000 };
+    std::vector<Actor*> actors;
+    for (const uint32_t delay : delays)
+    {
+        actors.push_back(new Actor(1.5f, 1.5f, 0, decoratePlayer));
+        wheel.Schedule(actors.back(), 12345 + delay);
+    }
+
+    for (uint8_t i = 0; i < actors.size(); i++)
+    {
+        wheel.Advance(12345 + delays[i] - 1, dueActors);
+        EXPECT_TRUE(dueActors.empty());
+        wheel.Advance(12345 + delays[i], dueActors);
+        ASSERT_EQ(1u, dueActors.size());
+        EXPECT_EQ(actors.at(i), dueActors.at(0));
+        dueActors.clear();
+    }
+
+    for (Actor* actor : actors)
+    {
+        delete actor;
+    }
+}
+
+TEST(TimerWheel_Test, CancelAndReschedule)
+{
+    TimerWheel wheel;
+    Actor cancelledActor(1.5f, 1.5f, 0, decoratePlayer);
+    Actor rescheduledActor(2.5f, 1.5f, 0, decoratePlayer);
+    std::vector<Actor*> dueActors;
+    wheel.Schedule(&cancelledActor, 50);
+    wheel.Schedule(&rescheduledActor, 50);
+    wheel.Cancel(&cancelledActor);
+    wheel.Schedule(&rescheduledActor, 5000);
+
+    wheel.Advance(4999, dueActors);
+    EXPECT_TRUE(dueActors.empty());
+    wheel.Advance(5000, dueActors);
+    ASSERT_EQ(1u, dueActors.size());
+    EXPECT_EQ(&rescheduledActor, dueActors.at(0));
+    EXPECT_EQ(0u, wheel.GetNumberOfScheduledActors());
+}
+
+TEST(TimerWheel_Test, StandsStillWhileTimeIsFrozen)
+{
+    TimerWheel wheel;
+    Actor actor(1.5f, 1.5f, 0, decoratePlayer);
+    std::vector<Actor*> dueActors;
+    wheel.Advance(1000, dueActors);
+    wheel.Schedule(&actor, 1500);
+
+    // The time of the world does not move while time is frozen
+    for (uint32_t frame = 0; frame < 100; frame++)
+    {
+        wheel.Advance(1200, dueActors);
+    }
+    EXPECT_TRUE(dueActors.empty());
+    EXPECT_EQ(1200u, wheel.GetCurrentTime());
+
+    wheel.Advance(1500, dueActors);
+    EXPECT_EQ(1u, dueActors.size());
+}
+
+TEST(TimerWheel_Test, PastWakeUpIsDueAtNextAdvance)
+{
+    TimerWheel wheel;
+    Actor actor(1.5f, 1.5f, 0, decoratePlayer);
+    std::vector<Actor*> dueActors;
+    wheel.Advance(1000, dueActors);
+    wheel.Schedule(&actor, 900);
+
+    wheel.Advance(1001, dueActors);
+    EXPECT_EQ(1u, dueActors.size());
+}
+
+TEST(TimerWheel_Test, CancelAndScheduleAtTheSameTimeWakesUpOnce)
+{
+    TimerWheel wheel;
+    Actor actor(1.5f, 1.5f, 0, decoratePlayer);
+    std::vector<Actor*> dueActors;
+    wheel.Schedule(&actor, 3000);
+    wheel.Cancel(&actor);
+    wheel.Schedule(&actor, 3000);
+
+    wheel.Advance(3000, dueActors);
+    ASSERT_EQ(1u, dueActors.size());
+    EXPECT_EQ(&actor, dueActors.at(0));
+}
+
+TEST(TimerWheel_Test, CancelKeepsOtherWakeUpsInTheSameSlot)
+{
+    TimerWheel wheel;
+    Actor firstActor(1.5f, 1.5f, 0, decoratePlayer);
+    Actor secondActor(2.5f, 1.5f, 0, decoratePlayer);
+    Actor thirdActor(3.5f, 1.5f, 0, decoratePlayer);
+    std::vector<Actor*> dueActors;
+    wheel.Schedule(&firstActor, 20);
+    wheel.Schedule(&secondActor, 20);
+    wheel.Schedule(&thirdActor, 20);
+    wheel.Cancel(&firstActor);
+    wheel.Cancel(&thirdActor);
+    wheel.Schedule(&thirdActor, 20);
+    EXPECT_EQ(2u, wheel.GetNumberOfScheduledActors());
+
+    wheel.Advance(20, dueActors);
+    ASSERT_EQ(2u, dueActors.size());
+    EXPECT_EQ(&secondActor, dueActors.at(0));
+    EXPECT_EQ(&thirdActor, dueActors.at(1));
+}
+
+TEST(TimerWheel_Test, JumpsOverLongStretchesWithoutWakeUps)
+{
+    TimerWheel wheel;
+    Actor actor(1.5f, 1.5f, 0, decoratePlayer);
+    std::vector<Actor*> dueActors;
+    wheel.Schedule(&actor, 4000000);
+
+    wheel.Advance(3999999, dueActors);
+    EXPECT_TRUE(dueActors.empty());
+    EXPECT_EQ(3999999u, wheel.GetCurrentTime());
+    wheel.Advance(UINT32_MAX - 1, dueActors);
+    ASSERT_EQ(1u, dueActors.size());
+    EXPECT_EQ(UINT32_MAX - 1, wheel.GetCurrentTime());
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2018 Arno Ansems
+// 
+// This program is free software: you can redistribute it and/or modify 
+// it under the terms of the GNU General Public License as published by 
+// the Free Software Foundation, either version 3 of the License, or 
+// (at your option) any later version. 
+// 
+// This program is distributed in the hope that it will be useful, 
+// but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+// GNU General Public License for more details. 
+// 
+// You should have received a copy of the GNU General Public License 
+// along with this program.  If not, see http://www.gnu.org/licenses/ 
+#include "TripleBuffer_Test.h"
+#include "../Engine/TripleBuffer.h"
+#include <thread>
+
+TripleBuffer_Test::TripleBuffer_Test()
+{
+
+}
+
+TripleBuffer_Test::~TripleBuffer_Test()
+{
+
+}
+
+TEST(TripleBuffer_Test, NothingToAcquireBeforePublish)
+{
+    TripleBuffer<uint32_t> tripleBuffer;
+    EXPECT_FALSE(tripleBuffer.Acquire());
+}
+
+TEST(TripleBuffer_Test, NewDataAvailableUntilAcquired)
+{
+    TripleBuffer<uint32_t> tripleBuffer;
+    EXPECT_FALSE(tripleBuffer.IsNewDataAvailable());
+    tripleBuffer.GetWriteBuffer() = 1;
+    tripleBuffer.Publish();
+    EXPECT_TRUE(tripleBuffer.IsNewDataAvailable());
+    EXPECT_TRUE(tripleBuffer.Acquire());
+    EXPECT_FALSE(tripleBuffer.IsNewDataAvailable());
+}
+
+TEST(TripleBuffer_Test, AcquireMostRecentlyPublished)
+{
+    TripleBuffer<uint32_t> tripleBuffer;
+    tripleBuffer.GetWriteBuffer() = 1;
+    tripleBuffer.Publish();
+    tripleBuffer.GetWriteBuffer() = 2;
+    tripleBuffer.Publish();
+
+    EXPECT_TRUE(tripleBuffer.Acquire());
+    EXPECT_EQ(2u, tripleBuffer.GetReadBuffer());
+
+    // Without a new publication, the same buffer remains readable.
+    EXPECT_FALSE(tripleBuffer.Acquire());
+    EXPECT_EQ(2u, tripleBuffer.GetReadBuffer());
+
+    tripleBuffer.GetWriteBuffer() = 3;
+    tripleBuffer.Publish();
+    EXPECT_TRUE(tripleBuffer.Acquire());
+    EXPECT_EQ(3u, tripleBuffer.GetReadBuffer());
+}
+
+TEST(TripleBuffer_Test, WriteBufferIsNeverTheReadBuffer)
+{
+    TripleBuffer<uint32_t> tripleBuffer;
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        tripleBuffer.GetWriteBuffer() = i;
+        tripleBuffer.Publish();
+        if (i % 3 == 0)
+        {
+            tripleBuffer.Acquire();
+        }
+        EXPECT_NE(&tripleBuffer.GetReadBuffer(), &tripleBuffer.GetWriteBuffer());
+    }
+}
+
+TEST(TripleBuffer_Test, ConsumerOnlySeesCompletePublications)
+{
+    typedef struct
+    {
+        uint32_t values[64];
+    } publication;
+
+    TripleBuffer<publication> tripleBuffer;
+    const uint32_t numberOfPublications = 100000;
+
+    std::thread producer([&tripleBuffer, numberOfPublications]()
+    {
+        for (uint32_t i = 1; i <= numberOfPublications; i++)
+        {
+            publication& buffer = tripleBuffer.GetWriteBuffer();
+            for (uint32_t j = 0; j < 64; j++)
+            {
+                buffer.values[j] = i;
+            }
+            tripleBuffer.Publish();
+        }
+    });
+
+    uint32_t lastValue = 0;
+    bool consistent = true;
+    while (lastValue < numberOfPublications && consistent)
+    {
+        if (tripleBuffer.Acquire())
+        {
+            const publication& buffer = tripleBuffer.GetReadBuffer();
+            consistent = (buffer.values[0] > lastValue);
+            for (uint32_t j = 1; j < 64; j++)
+            {
+                consistent &= (buffer.values[j] == buffer.values[0]);
+            }
+            lastValue = buffer.values[0];
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(numberOfPublications, lastValue);
+}
@@ -27,24 +27,27 @@
 
 // Windows specific includes
 #include <windows.h>
-#include <gl\gl.h>
+#include <gl/gl.h>
 #include <Shlwapi.h>
 #include <time.h>
+#include <thread>
+#include <atomic>
+#include <sstream>
 #include "RendererOpenGLWin32.h"
 #include "SystemWin32.h"
 
-#include "..\Engine\EngineCore.h"
-#include "..\Engine\PlayerInput.h"
-#include "..\Engine\GameDetection.h"
+#include "../Engine/EngineCore.h"
+#include "../Engine/PlayerInput.h"
+#include "../Engine/GameDetection.h"
 
-#include "..\Abyss\GameAbyss.h"
-#include "..\Abyss\GameDetectionAbyss.h"
-#include "..\Armageddon\GameArmageddon.h"
-#include "..\Armageddon\GameDetectionArmageddon.h"
+#include "../Abyss/GameAbyss.h"
+#include "../Abyss/GameDetectionAbyss.h"
+#include "../Armageddon/GameArmageddon.h"
+#include "../Armageddon/GameDetectionArmageddon.h"
 
-#include "..\..\ThirdParty\RefKeen\be_st.h"
-#include "..\..\ThirdParty\RefKeen\id_sd.h"
-#include "..\..\ThirdParty\SDL\include\SDL_mouse.h"
+#include "../../ThirdParty/RefKeen/be_st.h"
+#include "../../ThirdParty/RefKeen/id_sd.h"
+#include "../../ThirdParty/SDL/include/SDL_mouse.h"
 
 HDC			hDC=NULL;		// Private GDI Device Context
 HGLRC		hRC=NULL;		// Permanent Rendering Context
@@ -62,6 +65,8 @@ RendererOpenGLWin32 renderer;
 PlayerInput playerInput;
 SystemWin32 systemWin32;
 int32_t cursorDisplayCount = 0;
+std::atomic<bool> renderThreadActive(false);
+std::atomic<uint32_t> windowDimensions(0);
 
 GLvoid ReSizeGLScene(GLsizei width, GLsizei height)		// Resize And Initialize The GL Window
 {
@@ -70,7 +75,36 @@ GLvoid ReSizeGLScene(GLsizei width, GLsizei height)		// Resize And Initialize Th
 		height=1;										// Making Height Equal One
 	}
 
-	renderer.SetWindowDimensions(width, height);
+    // Applied by the render thread, which is the only thread that uses the renderer.
+    windowDimensions = ((uint32_t)width << 16) | (uint16_t)height;
+}
+
+// The render thread owns the OpenGL context. It continuously draws the most recent snapshot of the game that
+// was published by the main thread, which handles the window messages and runs the simulation.
+void RenderThread()
+{
+    wglMakeCurrent(hDC, hRC);
+    uint32_t appliedWindowDimensions = 0;
+    while (renderThreadActive)
+    {
+        // A frame is only drawn when there is a new snapshot; without vsync the loop would otherwise spin.
+        if (!engineCore->IsNewSnapshotAvailable())
+        {
+            Sleep(1);
+            continue;
+        }
+
+        const uint32_t dimensions = windowDimensions;
+        if (dimensions != appliedWindowDimensions)
+        {
+            renderer.SetWindowDimensions((uint16_t)(dimensions >> 16), (uint16_t)(dimensions & 0xFFFF));
+            appliedWindowDimensions = dimensions;
+        }
+
+        engineCore->DrawScene(renderer);
+        SwapBuffers(hDC);					// Swap Buffers (Double Buffering)
+    }
+    wglMakeCurrent(NULL, NULL);
 }
 
 bool GetCatacombsPackGOGPath(std::string& path)
@@ -87,6 +121,21 @@ bool GetCatacombsPackGOGPath(std::string& path)
     return isGogCatacombsPathFound;
 }
 
+// Looks up the value that follows the given option on the command line, e.g. "-playdemo demo.dem".
+bool GetCommandLineOption(const std::string& commandLine, const std::string& option, std::string& value)
+{
+    std::istringstream arguments(commandLine);
+    std::string argument;
+    while (arguments >> argument)
+    {
+        if (argument.compare(option) == 0)
+        {
+            return static_cast<bool>(arguments >> value);
+        }
+    }
+    return false;
+}
+
 GLvoid KillGLWindow(GLvoid)								// Properly Kill The Window
 {
 	if (hRC)											// Do We Have A Rendering Context?
@@ -505,6 +554,26 @@ int WINAPI WinMain(	HINSTANCE	hInstance,			// Instance
 		return 0;									// Quit If Window Was Not Created
 	}
 
+    // A demo is recorded with -recorddemo <file>, starting from the next level that is entered, and stored when the
+    // game ends. It is played back with -playdemo <file>.
+    const std::string commandLine = (lpCmdLine != NULL) ? lpCmdLine : "";
+    std::string demoFilename;
+    if (GetCommandLineOption(commandLine, "-recorddemo", demoFilename))
+    {
+        engineCore->SetDemoFilename(demoFilename);
+        engineCore->StartDemoRecording();
+    }
+    else if (GetCommandLineOption(commandLine, "-playdemo", demoFilename))
+    {
+        engineCore->SetDemoFilename(demoFilename);
+        Demo demo;
+        if (!demo.LoadFromFile(demoFilename) || !engineCore->StartDemoPlayback(demo))
+        {
+            const std::string errorMessage = "Failed to play back demo " + demoFilename;
+            MessageBox(NULL,errorMessage.c_str(),"CatacombGL ERROR",MB_OK | MB_ICONERROR);
+        }
+    }
+
     RAWINPUTDEVICE Rid[1];
 
     Rid[0].usUsagePage = 0x01; 
@@ -515,6 +584,14 @@ int WINAPI WinMain(	HINSTANCE	hInstance,			// Instance
     RegisterRawInputDevices(Rid, 1, sizeof(Rid[0]));
     GetClipCursor(&orgMouseClipArea);
 
+    // Hand over the OpenGL context to the render thread.
+    wglMakeCurrent(NULL, NULL);
+    renderThreadActive = true;
+    std::thread renderThread(RenderThread);
+
+    // Allow the simulation loop below to sleep for a single millisecond.
+    timeBeginPeriod(1);
+
     BOOL done = FALSE;								// Bool Variable To Exit Loop
 	while(!done)									// Loop That Runs While done=FALSE
 	{
@@ -536,11 +613,9 @@ int WINAPI WinMain(	HINSTANCE	hInstance,			// Instance
             {
                 done=TRUE;
             }
-			else								// Not Time To Quit, Update Screen
+			else								// Not Time To Quit; the screen is updated by the render thread
 			{
                 playerInput.SetHasFocus(GetFocus() != NULL);
-                engineCore->DrawScene(renderer);
-				SwapBuffers(hDC);					// Swap Buffers (Double Buffering)
 			}
 
             if (engineCore->RequiresMouseCapture())
@@ -568,9 +643,17 @@ int WINAPI WinMain(	HINSTANCE	hInstance,			// Instance
                     cursorDisplayCount = ShowCursor(TRUE);
                 }
             }
+
+            // The simulation runs in fixed ticks; there is no need to run Think() more than once per millisecond.
+            Sleep(1);
 		}
 	}
 
+    timeEndPeriod(1);
+    renderThreadActive = false;
+    renderThread.join();
+    wglMakeCurrent(hDC, hRC);
+
 	// Shutdown
     SD_Shutdown();
     BE_ST_ShutdownAll();
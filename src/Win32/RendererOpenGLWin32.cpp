@@ -14,8 +14,10 @@
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
 
 #include "RendererOpenGLWin32.h"
-#include <gl\gl.h>
-#include <gl\glu.h>
+#include "../Engine/SpriteQueue.h"
+#include "../Engine/MipChain.h"
+#include <gl/gl.h>
+#include <gl/glu.h>
 
 const float FloorZ = 2.0f;
 const float CeilingZ = 1.0f;
@@ -39,22 +41,23 @@ RendererOpenGLWin32::RendererOpenGLWin32()
     m_playerPosX = 2.5f;
     m_playerPosY = 2.5f;
 
-    m_spritesToRender = new spriteToRender[100];
-    m_numberOfSprites = 0;
     m_textureFilter = GL_LINEAR;
+    m_mipmapFilter = GL_LINEAR_MIPMAP_LINEAR;
 
     memset(&m_singleColorTexture, 0, sizeof(m_singleColorTexture[0]) * EgaRange);
 
     m_currentSwapInterval = -1;
+
+    m_orthoLeft = 0.0;
+    m_orthoRight = 320.0;
+    m_orthoTop = 0.0;
+    m_orthoBottom = 200.0;
 }
 
 // Destructor
 RendererOpenGLWin32::~RendererOpenGLWin32()
 {
-    if (m_spritesToRender)
-    {
-        delete m_spritesToRender;
-    }
+
 }
 
 void RendererOpenGLWin32::Setup()
@@ -162,74 +165,33 @@ void RendererOpenGLWin32::SetPlayerPosition(const float posX, const float posY)
 
 uint32_t RendererOpenGLWin32::LoadFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height, const bool transparent)
 {
-    GLuint textureId;
-    glGenTextures(1, &textureId);
-    glBindTexture(GL_TEXTURE_2D, textureId);
-    const uint32_t bytesPerPixel = transparent ? 4 : 3;
-    GLubyte* textureImage = new GLubyte[decompressedChunk->GetSize() * 2 * bytesPerPixel];
-    const uint32_t planeSize = decompressedChunk->GetSize() / 4;
-    unsigned char* chunk = decompressedChunk->GetChunk();
-
-    for (uint32_t i = 0; i < planeSize; i++)
-    {
-        for (int j = 0; j < 8; j++)
-        {
-            bool blueplane = ((chunk[i] & (1 <<j)) > 0);
-            bool greenplane =  ((chunk[i + planeSize] & (1 << j)) > 0);
-            bool redplane =  ((chunk[i + (2 * planeSize)] & (1 << j)) > 0);
-            bool intensityplane = ((chunk[i + (3 * planeSize)] & (1 << j)) > 0);
-            const egaColor colorIndex = (egaColor)((intensityplane ? EgaDarkGray : EgaBlack) + (redplane ? EgaRed : EgaBlack) + (greenplane ? EgaGreen : EgaBlack) + (blueplane ? EgaBlue : EgaBlack));
-            const bool transparentPixel = transparent && (colorIndex == 5);
-            const rgbColor color1 = EgaToRgb(transparentPixel ? EgaBlack : colorIndex);
-            textureImage[(i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel)] = color1.red;
-            textureImage[(i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel) + 1] = color1.green;
-            textureImage[(i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel) + 2] = color1.blue;
-            if (transparent)
-            {
-                textureImage[(i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel) + 3] = transparentPixel ? 0 : 255;
-            }
-        }
-    }
-    const int16_t format = transparent ? GL_RGBA : GL_RGB;
-    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, textureImage);
-    //glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,GL_LINEAR );
-    //glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MAG_FILTER,GL_LINEAR );   // GL_NEAREST
-
-    delete textureImage;
-
-    return textureId;
+    IndexedPicture indexedPicture(width, height);
+    indexedPicture.DecodePlanes(decompressedChunk->GetChunk(), decompressedChunk->GetSize() / 4, false, transparent, 0);
+    return LoadIndexedPictureIntoTexture(indexedPicture, transparent);
 }
 
 uint32_t RendererOpenGLWin32::LoadMaskedFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height)
+{
+    IndexedPicture indexedPicture(width, height);
+    indexedPicture.DecodePlanes(decompressedChunk->GetChunk(), decompressedChunk->GetSize() / 5, true, false, 0);
+    return LoadIndexedPictureIntoTexture(indexedPicture, true);
+}
+
+// The palette lookup of an indexed picture happens here, when it is uploaded into a texture. All levels of the
+// mip chain are uploaded, such that walls and sprites can be minified without aliasing.
+uint32_t RendererOpenGLWin32::LoadIndexedPictureIntoTexture(const IndexedPicture& indexedPicture, const bool transparent) const
 {
     GLuint textureId;
     glGenTextures(1, &textureId);
     glBindTexture(GL_TEXTURE_2D, textureId);
-    const uint32_t bytesPerPixel = 4;
-    GLubyte* textureImage = new GLubyte[width * height * bytesPerPixel];
-    const uint32_t planeSize = decompressedChunk->GetSize() / 5;
-    unsigned char* chunk = decompressedChunk->GetChunk();
 
-    for (uint32_t i = 0; i < planeSize; i++)
+    const MipChain mipChain(indexedPicture, egaToRgbMap);
+    const GLint internalFormat = transparent ? GL_RGBA : GL_RGB;
+    for (uint8_t level = 0; level < mipChain.GetNumberOfLevels(); level++)
     {
-        for (int j = 0; j < 8; j++)
-        {
-            bool transparencyplane =  ((chunk[i] & (1 <<j)) > 0);
-            bool blueplane = ((chunk[i + planeSize] & (1 << j)) > 0);
-            bool greenplane =  ((chunk[i + (2 * planeSize)] & (1 << j)) > 0);
-            bool redplane = ((chunk[i + (3 * planeSize)] & (1 << j)) > 0);
-            bool intensityplane = ((chunk[i + (4 * planeSize)] & (1 << j)) > 0);
-            const egaColor colorIndex = (egaColor)((intensityplane ? EgaDarkGray : EgaBlack) + (redplane ? EgaRed : EgaBlack) + (greenplane ? EgaGreen : EgaBlack) + (blueplane ? EgaBlue : EgaBlack));
-            const rgbColor color1 = EgaToRgb(transparencyplane ? EgaBlack : colorIndex);
-            textureImage[(i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel)] = color1.red;
-            textureImage[(i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel) + 1] = color1.green;
-            textureImage[(i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel) + 2] = color1.blue;
-            textureImage[(i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel) + 3] = transparencyplane ? 0 : 255;
-        }
+        const MipChain::mipLevel& mipLevel = mipChain.GetLevel(level);
+        glTexImage2D(GL_TEXTURE_2D, level, internalFormat, mipLevel.width, mipLevel.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, mipLevel.texels.data());
     }
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, textureImage);
-
-    delete textureImage;
 
     return textureId;
 }
@@ -262,45 +224,17 @@ uint32_t RendererOpenGLWin32::generateSingleColorTexture(const egaColor color) c
 
 uint32_t RendererOpenGLWin32::LoadTilesSize8MaskedIntoTexture(const FileChunk* decompressedChunk)
 {
-    GLuint textureId;
-    glGenTextures(1, &textureId);
-    glBindTexture(GL_TEXTURE_2D, textureId);
-    const uint32_t bytesPerPixel = 4;
     const uint32_t numberOfTiles = decompressedChunk->GetSize() / 40;
-    GLubyte* textureImage = new GLubyte[numberOfTiles * 8 * 8 * bytesPerPixel];
-    const uint32_t planeSize = 8;
-    unsigned char* chunk = decompressedChunk->GetChunk();
+    IndexedPicture indexedPicture(8, (uint16_t)(numberOfTiles * 8));
+    const uint8_t* chunk = decompressedChunk->GetChunk();
 
+    // Each tile consists of five planes of 8 bytes, with the transparency plane first
     for (uint32_t tile = 0; tile < numberOfTiles; tile++)
     {
-        const uint32_t tileChunkOffset = tile * 40;
-        const uint32_t tileTextureOffset = tile * 8 * 8 * bytesPerPixel;
-        for (uint32_t i = 0; i < planeSize; i++)
-        {
-            for (int j = 0; j < 8; j++)
-            {
-
-                bool transparencyplane =  ((chunk[tileChunkOffset + i] & (1 <<j)) > 0);
-                bool blueplane = ((chunk[tileChunkOffset + i + planeSize] & (1 << j)) > 0);
-                bool greenplane =  ((chunk[tileChunkOffset + i + (2 * planeSize)] & (1 << j)) > 0);
-                bool redplane = ((chunk[tileChunkOffset + i + (3 * planeSize)] & (1 << j)) > 0);
-                bool intensityplane = ((chunk[tileChunkOffset + i + (4 * planeSize)] & (1 << j)) > 0);
-                const egaColor colorIndex = (egaColor)((intensityplane ? EgaDarkGray : EgaBlack) + (redplane ? EgaRed : EgaBlack) + (greenplane ? EgaGreen : EgaBlack) + (blueplane ? EgaBlue : EgaBlack));
-                const rgbColor color1 = EgaToRgb(transparencyplane ? EgaBlack : colorIndex);
-                textureImage[tileTextureOffset + (i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel)] = color1.red;
-                textureImage[tileTextureOffset + (i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel) + 1] = color1.green;
-                textureImage[tileTextureOffset + (i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel) + 2] = color1.blue;
-                textureImage[tileTextureOffset + (i * 8 * bytesPerPixel) + ((7 - j) * bytesPerPixel) + 3] = transparencyplane ? 0 : 255;
-            }
-        }
+        indexedPicture.DecodePlanes(chunk + (tile * 40), 8, true, false, (uint16_t)(tile * 8));
     }
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 8, numberOfTiles * 8, 0, GL_RGBA, GL_UNSIGNED_BYTE, textureImage);
-    //glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,GL_LINEAR );
-    //glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MAG_FILTER,GL_LINEAR );   // GL_NEAREST
-
-    delete textureImage;
 
-    return textureId;
+    return LoadIndexedPictureIntoTexture(indexedPicture, true);
 }
 
 uint32_t RendererOpenGLWin32::LoadFontIntoTexture(const bool* fontPicture)
@@ -327,6 +261,12 @@ uint32_t RendererOpenGLWin32::LoadFontIntoTexture(const bool* fontPicture)
     return textureId;
 }
 
+void RendererOpenGLWin32::UnloadTexture(const uint32_t textureId)
+{
+    const GLuint texture = textureId;
+    glDeleteTextures(1, &texture);
+}
+
 void RendererOpenGLWin32::RenderTextCentered(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY)
 {
     if (text == NULL || font == NULL)
@@ -335,16 +275,10 @@ void RendererOpenGLWin32::RenderTextCentered(const char* text, const Font* font,
         return;
     }
 
-    uint16_t totalWidth = 0;
-    for (uint16_t chari = 0; chari < strlen(text); chari++)
-    {
-        const uint8_t charIndex = text[chari];
-        totalWidth += font->GetCharacterWidth(charIndex);
-    }
-
-    const uint16_t halfTotalWidth = totalWidth / 2;
+    const TextLayoutCache::textRun& textRun = m_textLayoutCache.GetTextRun(text, font, colorIndex);
+    const uint16_t halfTotalWidth = textRun.width / 2;
     const uint16_t leftAlignedOffsetX = offsetX - halfTotalWidth;
-    RenderTextLeftAligned(text, font, colorIndex, leftAlignedOffsetX, offsetY);
+    RenderTextRun(textRun, leftAlignedOffsetX, offsetY);
 }
 
 void RendererOpenGLWin32::RenderTextLeftAligned(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY)
@@ -355,13 +289,18 @@ void RendererOpenGLWin32::RenderTextLeftAligned(const char* text, const Font* fo
         return;
     }
 
+    RenderTextRun(m_textLayoutCache.GetTextRun(text, font, colorIndex), offsetX, offsetY);
+}
+
+void RendererOpenGLWin32::RenderTextRun(const TextLayoutCache::textRun& textRun, const uint16_t offsetX, const uint16_t offsetY)
+{
     // Set the MODELVIEW matrix to the requested offset
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
     glTranslatef(GLfloat(offsetX), GLfloat(offsetY), 0.0f);
 
     // Select the texture from the picture
-    glBindTexture(GL_TEXTURE_2D, font->GetTextureId());
+    glBindTexture(GL_TEXTURE_2D, textRun.font->GetTextureId());
 
     // Do not wrap the texture
     glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_WRAP_S,GL_CLAMP);
@@ -369,27 +308,21 @@ void RendererOpenGLWin32::RenderTextLeftAligned(const char* text, const Font* fo
     glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MAG_FILTER,m_textureFilter);
     glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,m_textureFilter);
 
-    rgbColor color = EgaToRgb(colorIndex);
+    rgbColor color = EgaToRgb(textRun.colorIndex);
 
-    // Draw the texture as a quad
-    uint16_t combinedWidth = 0;
+    // Draw all glyphs of the run as quads in a single batch
+    const float textureHeight = TextLayoutCache::GlyphTextureHeight;
+    const GLint glyphHeight = TextLayoutCache::GlyphHeight;
     glBegin(GL_QUADS);
     glColor3f((float)(color.red) / 256.0f, (float)(color.green) / 256.0f, (float)(color.blue) / 256.0f);
-    for (uint16_t chari = 0; chari < strlen(text); chari++)
+    for (const TextLayoutCache::glyphQuad& glyph : textRun.glyphs)
     {
-        const uint8_t charIndex = text[chari];
-        uint16_t charWidth =  font->GetCharacterWidth(charIndex);
-        float textureHeight = 1.0f / 16.0f;
-        float textureWidth = (float)(charWidth) / 256.0f;
-        float textureOffsetX = float(charIndex % 16) / 16.0f;
-        float textureOffsetY = float(charIndex / 16) / 16.0f;
-        
-
-        glTexCoord2f(textureOffsetX, textureOffsetY + textureHeight); glVertex2i(combinedWidth, 10);
-        glTexCoord2f(textureOffsetX + textureWidth, textureOffsetY + textureHeight); glVertex2i(combinedWidth + charWidth, 10);
-        glTexCoord2f(textureOffsetX + textureWidth, textureOffsetY); glVertex2i(combinedWidth + charWidth, 0);
-        glTexCoord2f(textureOffsetX, textureOffsetY); glVertex2i(combinedWidth, 0);
-        combinedWidth += charWidth;
+        const GLint left = glyph.offsetX;
+        const GLint right = glyph.offsetX + glyph.width;
+        glTexCoord2f(glyph.textureOffsetX, glyph.textureOffsetY + textureHeight); glVertex2i(left, glyphHeight);
+        glTexCoord2f(glyph.textureOffsetX + glyph.textureWidth, glyph.textureOffsetY + textureHeight); glVertex2i(right, glyphHeight);
+        glTexCoord2f(glyph.textureOffsetX + glyph.textureWidth, glyph.textureOffsetY); glVertex2i(right, 0);
+        glTexCoord2f(glyph.textureOffsetX, glyph.textureOffsetY); glVertex2i(left, 0);
     }
     glEnd();
 
@@ -408,6 +341,11 @@ void RendererOpenGLWin32::RenderNumber(const uint16_t value, const Font* font, c
     RenderTextLeftAligned(str, font, colorIndex, offsetX + widthOfBlanks, offsetY);
 }
 
+const TextLayoutCache& RendererOpenGLWin32::GetTextLayoutCache() const
+{
+    return m_textLayoutCache;
+}
+
 void RendererOpenGLWin32::Prepare2DRendering()
 {
     // Set the viewport to the entire window
@@ -453,6 +391,10 @@ void RendererOpenGLWin32::Prepare2DRendering()
     }
 
     gluOrtho2D(left, right, bottom, top);
+    m_orthoLeft = left;
+    m_orthoRight = right;
+    m_orthoTop = top;
+    m_orthoBottom = bottom;
 
     glDisable(GL_LIGHTING);
 }
@@ -486,14 +428,17 @@ void RendererOpenGLWin32::Render2DPicture(const Picture* picture, const uint16_t
     glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MAG_FILTER,m_textureFilter);
     glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,m_textureFilter);
 
-    // Draw the texture as a quad
-    const GLint width = (uint16_t)picture->GetWidth();
-    const GLint height = (uint16_t)picture->GetHeight();
+    // Draw the trimmed part of the picture as a quad
+    const pictureRect& trimmedRect = picture->GetTrimmedRect();
+    const GLfloat textureLeft = picture->GetTextureCoordinateLeft();
+    const GLfloat textureTop = picture->GetTextureCoordinateTop();
+    const GLfloat textureRight = picture->GetTextureCoordinateRight();
+    const GLfloat textureBottom = picture->GetTextureCoordinateBottom();
     glBegin(GL_QUADS);
-    glTexCoord2i(0, 1); glVertex2i(0, height);
-    glTexCoord2i(1, 1); glVertex2i(width, height);
-    glTexCoord2i(1, 0); glVertex2i(width, 0);
-    glTexCoord2i(0, 0); glVertex2i(0, 0);
+    glTexCoord2f(textureLeft, textureBottom); glVertex2i(trimmedRect.left, trimmedRect.bottom);
+    glTexCoord2f(textureRight, textureBottom); glVertex2i(trimmedRect.right, trimmedRect.bottom);
+    glTexCoord2f(textureRight, textureTop); glVertex2i(trimmedRect.right, trimmedRect.top);
+    glTexCoord2f(textureLeft, textureTop); glVertex2i(trimmedRect.left, trimmedRect.top);
     glEnd();
 }
 
@@ -581,6 +526,79 @@ void RendererOpenGLWin32::RenderRadarBlip(const float x, const float y, const eg
     glEnable(GL_TEXTURE_2D);
 }
 
+void RendererOpenGLWin32::CaptureLayer(const uint8_t layerId, const uint16_t offsetX, const uint16_t offsetY, const uint16_t width, const uint16_t height)
+{
+    // Determine the rectangle in window pixels that covers the requested part of the 320x200 screen.
+    const double scaleX = (double)m_windowWidth / (m_orthoRight - m_orthoLeft);
+    const double scaleY = (double)m_windowHeight / (m_orthoBottom - m_orthoTop);
+    const GLint windowX = (GLint)(((offsetX - m_orthoLeft) * scaleX) + 0.5);
+    const GLsizei windowWidth = (GLsizei)((width * scaleX) + 0.5);
+    const GLsizei windowHeight = (GLsizei)((height * scaleY) + 0.5);
+    // Window coordinates in OpenGL start at the bottom
+    const GLint windowY = m_windowHeight - (GLint)(((offsetY - m_orthoTop) * scaleY) + 0.5) - windowHeight;
+
+    std::map<uint8_t, retainedLayer>::iterator it = m_retainedLayers.find(layerId);
+    if (it == m_retainedLayers.end())
+    {
+        retainedLayer newLayer;
+        glGenTextures(1, &newLayer.textureId);
+        it = m_retainedLayers.insert(std::make_pair(layerId, newLayer)).first;
+    }
+
+    retainedLayer& layer = it->second;
+    layer.offsetX = offsetX;
+    layer.offsetY = offsetY;
+    layer.width = width;
+    layer.height = height;
+    layer.windowWidth = m_windowWidth;
+    layer.windowHeight = m_windowHeight;
+
+    // Copy the rendered pixels from the back buffer into the texture of the layer
+    glBindTexture(GL_TEXTURE_2D, layer.textureId);
+    glCopyTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, windowX, windowY, windowWidth, windowHeight, 0);
+}
+
+bool RendererOpenGLWin32::RenderLayer(const uint8_t layerId)
+{
+    std::map<uint8_t, retainedLayer>::const_iterator it = m_retainedLayers.find(layerId);
+    if (it == m_retainedLayers.end())
+    {
+        return false;
+    }
+
+    const retainedLayer& layer = it->second;
+    if (layer.windowWidth != m_windowWidth || layer.windowHeight != m_windowHeight)
+    {
+        // The captured pixels no longer match the size of the window
+        return false;
+    }
+
+    // Set the MODELVIEW matrix to the requested offset
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+    glTranslatef(GLfloat(layer.offsetX), GLfloat(layer.offsetY), 0.0f);
+
+    glBindTexture(GL_TEXTURE_2D, layer.textureId);
+
+    // The captured pixels map one-to-one on the window
+    glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_WRAP_S,GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_WRAP_T,GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MAG_FILTER,GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,GL_NEAREST);
+
+    // Draw the texture as a quad; the first row of the texture is the bottom of the layer.
+    const GLint width = layer.width;
+    const GLint height = layer.height;
+    glBegin(GL_QUADS);
+    glTexCoord2i(0, 0); glVertex2i(0, height);
+    glTexCoord2i(1, 0); glVertex2i(width, height);
+    glTexCoord2i(1, 1); glVertex2i(width, 0);
+    glTexCoord2i(0, 1); glVertex2i(0, 0);
+    glEnd();
+
+    return true;
+}
+
 void RendererOpenGLWin32::Prepare3DRendering(const bool depthShading, const float aspectRatio, uint16_t fov)
 {
     const float configuredAspectRatio = aspectRatio; //1920.0 / 1080.0;
@@ -701,7 +719,7 @@ void RendererOpenGLWin32::Render3DWall(const Picture* picture, const int16_t til
     glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_WRAP_S,GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_WRAP_T,GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MAG_FILTER,m_textureFilter);
-    glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,m_textureFilter);
+    glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,m_mipmapFilter);
 
     glNormal3f( 0.0f, 0.0f, -1.0f);
 
@@ -722,7 +740,17 @@ void RendererOpenGLWin32::Render3DSprite(const Picture* picture, const float off
     glTranslatef(offsetX, offsetY, 0.0f);
     glRotatef(m_playerAngle, 0.0f, 0.0f, 1.0f);
     const GLfloat halfWidth = (float)(picture->GetWidth()) / 128.0f;
-    const GLfloat topZ = CeilingZ + ((float)(picture->GetHeight()) / 64.0f) * (FloorZ - CeilingZ);
+
+    // Only the trimmed part of the billboard is drawn, which saves on blended fill
+    const pictureRect& trimmedRect = picture->GetTrimmedRect();
+    const GLfloat leftX = ((float)trimmedRect.left / 64.0f) - halfWidth;
+    const GLfloat rightX = ((float)trimmedRect.right / 64.0f) - halfWidth;
+    const GLfloat upperZ = CeilingZ + ((float)trimmedRect.top / 64.0f) * (FloorZ - CeilingZ);
+    const GLfloat lowerZ = CeilingZ + ((float)trimmedRect.bottom / 64.0f) * (FloorZ - CeilingZ);
+    const GLfloat textureLeft = picture->GetTextureCoordinateLeft();
+    const GLfloat textureTop = picture->GetTextureCoordinateTop();
+    const GLfloat textureRight = picture->GetTextureCoordinateRight();
+    const GLfloat textureBottom = picture->GetTextureCoordinateBottom();
 
     // Select the texture from the picture
     glBindTexture(GL_TEXTURE_2D, picture->GetTextureId());
@@ -731,97 +759,35 @@ void RendererOpenGLWin32::Render3DSprite(const Picture* picture, const float off
     glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_WRAP_S,GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_WRAP_T,GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MAG_FILTER,m_textureFilter);
-    glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,m_textureFilter);
+    glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,m_mipmapFilter);
 
     glNormal3f( 0.0f, 0.0f, -1.0f);
 
     // Draw the texture as a quad
     glBegin(GL_QUADS);
-    glTexCoord2i(0, 0); glVertex3f(-halfWidth, 0.0f, CeilingZ + 0.0625f);
-    glTexCoord2i(1, 0); glVertex3f(halfWidth, 0.0f, CeilingZ + 0.0625f);
-    glTexCoord2i(1, 1); glVertex3f(halfWidth, 0.0f, topZ + 0.0625f);
-    glTexCoord2i(0, 1); glVertex3f(-halfWidth, 0.0f, topZ + 0.0625f);
+    glTexCoord2f(textureLeft, textureTop); glVertex3f(leftX, 0.0f, upperZ + 0.0625f);
+    glTexCoord2f(textureRight, textureTop); glVertex3f(rightX, 0.0f, upperZ + 0.0625f);
+    glTexCoord2f(textureRight, textureBottom); glVertex3f(rightX, 0.0f, lowerZ + 0.0625f);
+    glTexCoord2f(textureLeft, textureBottom); glVertex3f(leftX, 0.0f, lowerZ + 0.0625f);
     glEnd();
 }
 
-void RendererOpenGLWin32::AddSprite(const Picture* picture, const float offsetX, const float offsetY)
-{
-    if (m_numberOfSprites == 100)
-    {
-        return;
-    }
-
-    m_spritesToRender[m_numberOfSprites].picture = picture;
-    m_spritesToRender[m_numberOfSprites].offsetX = offsetX;
-    m_spritesToRender[m_numberOfSprites].offsetY = offsetY;
-    m_spritesToRender[m_numberOfSprites].squaredDistance = (int32_t)(((offsetX - m_playerPosX) * (offsetX - m_playerPosX)) + ((offsetY - m_playerPosY) * (offsetY - m_playerPosY)));
-
-    m_numberOfSprites++;
-}
-
-void RendererOpenGLWin32::RenderAllSprites()
+void RendererOpenGLWin32::RenderSprites(const SpriteQueue& spriteQueue)
 {
+    // The sprite textures have premultiplied alpha
     glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
     glDepthMask(GL_FALSE);
 
-    quickSort(0, m_numberOfSprites);
-
-    for (int16_t i = m_numberOfSprites - 1; i >= 0; i--)
+    // The sprites are already sorted from back to front
+    const SpriteQueue::spriteToRender* sprites = spriteQueue.GetSprites();
+    for (uint32_t i = 0; i < spriteQueue.GetNumberOfSprites(); i++)
     {
-        Render3DSprite(m_spritesToRender[i].picture, m_spritesToRender[i].offsetX, m_spritesToRender[i].offsetY);
+        Render3DSprite(sprites[i].picture, sprites[i].offsetX, sprites[i].offsetY);
     }
 
     glDepthMask(GL_TRUE);
     glDisable(GL_BLEND);
-
-    m_numberOfSprites = 0;
-}
-
-void RendererOpenGLWin32::quickSort(uint16_t p,uint16_t q)
-{
-    if(p<q)
-    {
-        int r=partition(p,q);
-        quickSort(p,r);  
-        quickSort(r+1,q);
-    }
-}
-
-
-uint16_t RendererOpenGLWin32::partition(uint16_t p,uint16_t q)
-{
-    const int32_t x= m_spritesToRender[p].squaredDistance;
-    uint16_t i=p;
-
-    for(uint16_t j=p+1; j<q; j++)
-    {
-        if(m_spritesToRender[j].squaredDistance<=x)
-        {
-            i=i+1;
-            swap(i,j);
-        }
-    }
-
-    swap(i,p);
-    return i;
-}
-
-void RendererOpenGLWin32::swap(uint16_t p,uint16_t q)
-{
-    spriteToRender dummy;
-    dummy.picture = m_spritesToRender[p].picture;
-    dummy.offsetX = m_spritesToRender[p].offsetX;
-    dummy.offsetY = m_spritesToRender[p].offsetY;
-    dummy.squaredDistance = m_spritesToRender[p].squaredDistance;
-    m_spritesToRender[p].picture = m_spritesToRender[q].picture;
-    m_spritesToRender[p].offsetX = m_spritesToRender[q].offsetX;
-    m_spritesToRender[p].offsetY = m_spritesToRender[q].offsetY;
-    m_spritesToRender[p].squaredDistance = m_spritesToRender[q].squaredDistance;
-    m_spritesToRender[q].picture = dummy.picture;
-    m_spritesToRender[q].offsetX = dummy.offsetX;
-    m_spritesToRender[q].offsetY = dummy.offsetY;
-    m_spritesToRender[q].squaredDistance = dummy.squaredDistance;
 }
 
 void RendererOpenGLWin32::PrepareFloorAndCeiling()
@@ -880,6 +846,7 @@ void RendererOpenGLWin32::RenderCeiling(const uint16_t tileX, const uint16_t til
 void RendererOpenGLWin32::SetTextureFilter(const TextureFilterSetting textureFilter)
 {
     m_textureFilter = (textureFilter == Nearest) ? GL_NEAREST : GL_LINEAR;
+    m_mipmapFilter = (textureFilter == Nearest) ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
 }
 
 void RendererOpenGLWin32::SetVSync(const bool enabled)
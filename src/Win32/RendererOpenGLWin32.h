@@ -14,15 +14,18 @@
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
 #pragma once
 
-#include "..\Engine\Picture.h"
-#include "..\Engine\Font.h"
-#include "..\Engine\FileChunk.h"
-#include "..\Engine\Decompressor.h"
-#include "..\Engine\EgaColor.h"
-#include "..\Engine\IRenderer.h"
+#include "../Engine/Picture.h"
+#include "../Engine/Font.h"
+#include "../Engine/FileChunk.h"
+#include "../Engine/Decompressor.h"
+#include "../Engine/EgaColor.h"
+#include "../Engine/IRenderer.h"
+#include "../Engine/TextLayoutCache.h"
+#include "../Engine/IndexedPicture.h"
+#include <map>
 
 #include <windows.h>		// Header File For Windows
-#include <gl\gl.h>			// Header File For The OpenGL32 Library
+#include <gl/gl.h>			// Header File For The OpenGL32 Library
 
 class RendererOpenGLWin32: public IRenderer
 {
@@ -41,6 +44,7 @@ public:
     uint32_t LoadMaskedFileChunkIntoTexture(const FileChunk* decompressedChunk, const uint16_t width, const uint16_t height) override;
     uint32_t LoadTilesSize8MaskedIntoTexture(const FileChunk* decompressedChunk) override;
     uint32_t LoadFontIntoTexture(const bool* fontPicture) override;
+    void UnloadTexture(const uint32_t textureId) override;
 
     void RenderTextLeftAligned(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) override;
     void RenderTextCentered(const char* text, const Font* font, const egaColor colorIndex, const uint16_t offsetX, const uint16_t offsetY) override;
@@ -52,6 +56,8 @@ public:
     void Render2DTileSize8Masked(const Picture* tiles, const uint16_t tileIndex, const uint16_t offsetX, const uint16_t offsetY) override;
     void Render2DBar(const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height, const egaColor colorIndex) override;
     void RenderRadarBlip(const float x, const float y, const egaColor colorIndex) override;
+    void CaptureLayer(const uint8_t layerId, const uint16_t offsetX, const uint16_t offsetY, const uint16_t width, const uint16_t height) override;
+    bool RenderLayer(const uint8_t layerId) override;
 
     void Prepare3DRendering(const bool depthShading, const float aspectRatio, uint16_t fov) override;
 
@@ -60,8 +66,7 @@ public:
     void Render3DWall(const Picture* picture, const int16_t tileX, const int16_t tileY, const int16_t orientation) override;
     void Render3DSprite(const Picture* picture, const float offsetX, const float offsetY) override;
 
-    void AddSprite(const Picture* picture, const float offsetX, const float offsetY) override;
-    void RenderAllSprites();
+    void RenderSprites(const SpriteQueue& spriteQueue) override;
     void PrepareFloorAndCeiling() override;
     void UnprepareFloorAndCeiling() override;
     void RenderFloor(const uint16_t tileX, const uint16_t tileY, const egaColor colorIndex) override;
@@ -70,32 +75,38 @@ public:
     void PrepareVisibilityMap() override;
     void UnprepareVisibilityMap() override;
 
+    const TextLayoutCache& GetTextLayoutCache() const;
+
 private:
     typedef struct
     {
-        const Picture* picture;
-        float offsetX;
-        float offsetY;
-        int32_t squaredDistance;
-    } spriteToRender;
+        GLuint textureId;
+        uint16_t offsetX;
+        uint16_t offsetY;
+        uint16_t width;
+        uint16_t height;
+        uint16_t windowWidth;
+        uint16_t windowHeight;
+    } retainedLayer;
 
     static rgbColor EgaToRgb(const egaColor ega);
     static bool IsWGLExtensionSupported(const char *extension_name);
 
-    void quickSort(uint16_t p,uint16_t q);
-    uint16_t partition(uint16_t p,uint16_t q);
-    void swap(uint16_t p,uint16_t q);
     uint32_t generateSingleColorTexture(const egaColor color) const;
+    uint32_t LoadIndexedPictureIntoTexture(const IndexedPicture& indexedPicture, const bool transparent) const;
+    void RenderTextRun(const TextLayoutCache::textRun& textRun, const uint16_t offsetX, const uint16_t offsetY);
 
     uint16_t m_windowWidth;
     uint16_t m_windowHeight;
     float m_playerAngle;
     float m_playerPosX, m_playerPosY;
-    spriteToRender* m_spritesToRender;
-    uint16_t m_numberOfSprites;
     uint32_t m_singleColorTexture[EgaRange];
+    TextLayoutCache m_textLayoutCache;
+    std::map<uint8_t, retainedLayer> m_retainedLayers;
+    double m_orthoLeft, m_orthoRight, m_orthoTop, m_orthoBottom;
 
     GLint m_textureFilter;
+    GLint m_mipmapFilter;
     int32_t m_currentSwapInterval;
     bool m_isVSyncSupported;
 };
@@ -13,7 +13,7 @@
 // You should have received a copy of the GNU General Public License 
 // along with this program.  If not, see http://www.gnu.org/licenses/ 
 #pragma once
-#include "..\Engine\ISystem.h"
+#include "../Engine/ISystem.h"
 
 class SystemWin32: public ISystem
 {